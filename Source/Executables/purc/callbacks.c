@@ -86,6 +86,8 @@ foil_handle_event(pcmcth_renderer *rdr, unsigned long long timeout_usec)
 {
     if (rdr->impl->term_mode == FOIL_TERM_MODE_LINE) {
         if (tty_got_winch(timeout_usec)) {
+            /* merge the events, or the event loop wakes up again at once */
+            tty_flush_winch();
             // TODO: handle change of terminal size
         }
     }
@@ -93,6 +95,16 @@ foil_handle_event(pcmcth_renderer *rdr, unsigned long long timeout_usec)
     return 0;
 }
 
+static int
+foil_event_fd(pcmcth_renderer *rdr)
+{
+    if (rdr->impl->term_mode == FOIL_TERM_MODE_LINE) {
+        return tty_get_winch_fd();
+    }
+
+    return -1;
+}
+
 static void foil_cleanup(pcmcth_renderer *rdr)
 {
     if (rdr->impl->term_mode == FOIL_TERM_MODE_LINE) {
@@ -508,6 +520,7 @@ void pcmcth_set_renderer_callbacks(pcmcth_renderer *rdr)
 
     rdr->cbs.prepare = foil_prepare;
     rdr->cbs.handle_event = foil_handle_event;
+    rdr->cbs.event_fd = foil_event_fd;
     rdr->cbs.cleanup = foil_cleanup;
     rdr->cbs.create_session = foil_create_session;
     rdr->cbs.remove_session = foil_remove_session;
@@ -1011,6 +1011,7 @@ static int update_dom(pcmcth_renderer* rdr, pcmcth_endpoint* endpoint,
     int retv;
     pcmcth_udom *dom = NULL;
     pcrdr_msg response = { };
+    uint64_t failed_idx = 0;
 
     if (msg->target == PCRDR_MSG_TARGET_DOM) {
         dom = (pcmcth_udom *)(uintptr_t)msg->targetValue;
@@ -1026,9 +1027,10 @@ static int update_dom(pcmcth_renderer* rdr, pcmcth_endpoint* endpoint,
     }
 
     uint64_t element_handle = 0;
-    if (msg->elementType == PCRDR_MSG_ELEMENT_TYPE_HANDLE) {
-        const char *element_value =
-            purc_variant_get_string_const(msg->elementValue);
+    const char *element_value = NULL;
+    if (msg->elementType == PCRDR_MSG_ELEMENT_TYPE_HANDLE ||
+            msg->elementType == PCRDR_MSG_ELEMENT_TYPE_HANDLES) {
+        element_value = purc_variant_get_string_const(msg->elementValue);
         if (element_value == NULL) {
             retv = PCRDR_SC_BAD_REQUEST;
             goto done;
@@ -1043,16 +1045,49 @@ static int update_dom(pcmcth_renderer* rdr, pcmcth_endpoint* endpoint,
         goto done;
     }
 
-    retv = rdr->cbs.update_udom(endpoint->session, dom,
-            op, element_handle, purc_variant_get_string_const(msg->property),
-            msg->data);
+    const char *property = purc_variant_get_string_const(msg->property);
+    if (msg->elementType == PCRDR_MSG_ELEMENT_TYPE_HANDLES) {
+        /* apply the same change to all elements; the first error wins,
+           and the result value tells the index of the element failed */
+        retv = PCRDR_SC_OK;
+        for (uint64_t idx = 0; *element_value; idx++) {
+            char *end;
+            element_handle = strtoull(element_value, &end, 16);
+            if (end == element_value) {
+                if (retv == PCRDR_SC_OK) {
+                    retv = PCRDR_SC_BAD_REQUEST;
+                    failed_idx = idx;
+                }
+                break;
+            }
+
+            int r = rdr->cbs.update_udom(endpoint->session, dom,
+                    op, element_handle, property, msg->data);
+            if (retv == PCRDR_SC_OK && r != PCRDR_SC_OK) {
+                retv = r;
+                failed_idx = idx;
+            }
+
+            element_value = end;
+            if (*element_value == ',')
+                element_value++;
+        }
+    }
+    else {
+        retv = rdr->cbs.update_udom(endpoint->session, dom,
+                op, element_handle, property, msg->data);
+    }
 
 done:
     response.type = PCRDR_MSG_TYPE_RESPONSE;
     response.requestId = msg->requestId;
     response.sourceURI = PURC_VARIANT_INVALID;
     response.retCode = retv;
-    response.resultValue = (uint64_t)(uintptr_t)dom;
+    if (retv != PCRDR_SC_OK &&
+            msg->elementType == PCRDR_MSG_ELEMENT_TYPE_HANDLES)
+        response.resultValue = failed_idx;
+    else
+        response.resultValue = (uint64_t)(uintptr_t)dom;
     response.dataType = PCRDR_MSG_DATA_TYPE_VOID;
     return send_simple_response(rdr, endpoint, &response);
 }
@@ -29,6 +29,8 @@
 #include <pthread.h>
 #include <semaphore.h>
 #include <fcntl.h>           /* For O_* constants */
+#include <poll.h>
+#include <unistd.h>
 #include <sys/stat.h>        /* For mode constants */
 
 #include "foil.h"
@@ -122,12 +124,65 @@ no_any_endpoints:
     return false;
 }
 
+static void drain_fd(int fd)
+{
+    char buf[64];
+    ssize_t n;
+
+    /* the descriptor is non-blocking */
+    do {
+        n = read(fd, buf, sizeof(buf));
+    } while (n > 0 || (n < 0 && errno == EINTR));
+}
+
+/* Blocks until a message is moved in or the renderer has an event
+   to handle; returns non-zero to quit the event loop. */
+static int wait_for_events(pcmcth_renderer *rdr,
+        struct pollfd *fds, nfds_t nr_fds)
+{
+    if (poll(fds, nr_fds, -1) < 0) {
+        if (errno == EINTR)
+            return 0;
+
+        purc_log_error("Failed poll(): %s\n", strerror(errno));
+        return -1;
+    }
+
+    /* reset the notification before checking the move buffer again */
+    if (fds[0].revents & POLLIN)
+        drain_fd(fds[0].fd);
+
+    if (nr_fds > 1 && (fds[1].revents & POLLIN))
+        return rdr->cbs.handle_event(rdr, 0);
+
+    return 0;
+}
+
 static void event_loop(pcmcth_renderer *rdr)
 {
-    (void)rdr;
     size_t n;
     int ret;
 
+    struct pollfd fds[2];
+    nfds_t nr_fds = 0;
+
+    int fd = purc_inst_move_buffer_fd();
+    if (fd >= 0) {
+        fds[nr_fds].fd = fd;
+        fds[nr_fds].events = POLLIN;
+        nr_fds++;
+
+        fd = rdr->cbs.event_fd ? rdr->cbs.event_fd(rdr) : -1;
+        if (fd >= 0) {
+            fds[nr_fds].fd = fd;
+            fds[nr_fds].events = POLLIN;
+            nr_fds++;
+        }
+    }
+    else {
+        purc_log_warn("No notification of the move buffer; polling...\n");
+    }
+
     do {
         ret = purc_inst_holding_messages_count(&n);
 
@@ -135,8 +190,14 @@ static void event_loop(pcmcth_renderer *rdr)
             purc_log_error("purc_inst_holding_messages_count failed: %d\n", ret);
         }
         else if (n == 0) {
-            if (rdr->cbs.handle_event(rdr, 10000))  // timeout value: 10ms
+            if (nr_fds > 0) {
+                if (wait_for_events(rdr, fds, nr_fds))
+                    break;
+            }
+            else if (rdr->cbs.handle_event(rdr, 10000)) {
+                // timeout value: 10ms
                 break;
+            }
 
             rdr->t_elapsed = purc_get_monotoic_time() - rdr->t_start;
             if (UNLIKELY(rdr->t_elapsed != rdr->t_elapsed_last)) {
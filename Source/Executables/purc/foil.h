@@ -51,7 +51,7 @@
     FOIL_RDR_NAME ":" PURC_VERSION_STRING "\n" \
     "HTML:5.3\n" \
     "workspace:0/tabbedWindow:-1/plainWindow:-1/widgetInTabbedWindow:8\n" \
-    "DOMElementSelectors:handle"
+    "DOMElementSelectors:handle,handles"
 
 #ifdef NDEBUG
 #   define LOG_DEBUG(x, ...)
@@ -59,6 +59,9 @@ typedef struct pcmcth_udom pcmcth_udom;
 typedef struct pcmcth_rdr_cbs {
     int  (*prepare)(pcmcth_renderer *);
     int  (*handle_event)(pcmcth_renderer *, unsigned long long timeout_usec);
+    /* nullable; the descriptor becomes readable when handle_event has
+       something to handle; -1 for none */
+    int  (*event_fd)(pcmcth_renderer *);
     void (*cleanup)(pcmcth_renderer *);
 
     pcmcth_session *(*create_session)(pcmcth_renderer *, pcmcth_endpoint *);
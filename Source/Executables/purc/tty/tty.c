@@ -239,6 +239,15 @@ tty_flush_winch (void)
 
 /* --------------------------------------------------------------------------------------------- */
 
+/* the descriptor becomes readable on SIGWINCH; for an external event loop */
+int
+tty_get_winch_fd (void)
+{
+    return sigwinch_pipe[0];
+}
+
+/* --------------------------------------------------------------------------------------------- */
+
 void
 tty_print_one_hline (gboolean single)
 {
@@ -82,6 +82,7 @@ extern gboolean tty_got_interrupt (void);
 
 extern gboolean tty_got_winch (unsigned long long timeout_usec);
 extern void tty_flush_winch (void);
+extern int tty_get_winch_fd (void);
 
 extern void tty_reset_prog_mode (void);
 extern void tty_reset_shell_mode (void);
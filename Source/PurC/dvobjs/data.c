@@ -1934,6 +1934,9 @@ shuffle_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         ssize_t sz = purc_variant_array_get_size(argv[0]);
 
         if (sz > 1) {
+            if (pcvariant_container_unshare(argv[0]))
+                goto failed;
+
             struct pcutils_array_list *al = variant_array_get_data(argv[0]);
             struct pcutils_array_list_node *p;
             array_list_for_each(al, p) {
@@ -2060,6 +2063,69 @@ static void map_free_val(void *val)
     pcutils_map_destroy(sort_arg.map);
 #endif
 
+static bool
+is_numeric_member(purc_variant_t v)
+{
+    switch (purc_variant_get_type(v)) {
+    case PURC_VARIANT_TYPE_NUMBER:
+    case PURC_VARIANT_TYPE_LONGINT:
+    case PURC_VARIANT_TYPE_ULONGINT:
+    case PURC_VARIANT_TYPE_LONGDOUBLE:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/*
+ * Decide how to compare the members as purc_variant_compare_ex() does.
+ * Returns false if the members of the automatic comparison are mixed with
+ * numbers and others; they are compared pair by pair then.
+ */
+static bool
+sort_key_type(purc_variant_t container, uintptr_t sort_opt,
+        enum pcvariant_sort_key_type *type)
+{
+    switch (sort_opt & PCVARIANT_CMPOPT_MASK) {
+    case PCVARIANT_COMPARE_OPT_NUMBER:
+        *type = PCVARIANT_SORT_KEY_NUMBER;
+        return true;
+
+    case PCVARIANT_COMPARE_OPT_CASE:
+        *type = PCVARIANT_SORT_KEY_CASE;
+        return true;
+
+    case PCVARIANT_COMPARE_OPT_CASELESS:
+        *type = PCVARIANT_SORT_KEY_CASELESS;
+        return true;
+
+    default:
+        break;
+    }
+
+    bool is_array = purc_variant_is_array(container);
+    size_t sz = is_array ? purc_variant_array_get_size(container) :
+        purc_variant_set_get_size(container);
+    size_t nr_numbers = 0;
+
+    for (size_t i = 0; i < sz; i++) {
+        purc_variant_t v = is_array ? purc_variant_array_get(container, i) :
+            purc_variant_set_get_by_index(container, i);
+        if (is_numeric_member(v))
+            nr_numbers++;
+    }
+
+    if (nr_numbers == sz)
+        *type = PCVARIANT_SORT_KEY_NUMBER;
+    else if (nr_numbers == 0)
+        *type = PCVARIANT_SORT_KEY_CASE;
+    else
+        return false;
+
+    return true;
+}
+
 static purc_variant_t
 sort_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         unsigned call_flags)
@@ -2166,8 +2232,15 @@ sort_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         }
     }
 
+    /* extract the keys once and sort them if the way to compare is known */
+    struct pcvariant_sort_key key = { NULL, PCVARIANT_SORT_KEY_NUMBER };
+    if (sort_key_type(argv[0], sort_opt, &key.type)) {
+        if (pcvariant_sort_by_keys(argv[0], &key, 1,
+                    sort_opt & PCVARIANT_SORT_DESC))
+            goto failed;
+    }
     /* use the default variant comparison function */
-    if (purc_variant_is_array(argv[0])) {
+    else if (purc_variant_is_array(argv[0])) {
         pcvariant_array_sort(argv[0], (void *)sort_opt, NULL);
     }
     else {
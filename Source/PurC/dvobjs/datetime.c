@@ -183,9 +183,22 @@ static void unset_tz(char *tz_old)
     }
 }
 
+/* Returns the cached rules of the timezone; NULL for the system timezone or
+   a zone which cannot be loaded, in which case we fall back to set_tz(). */
+static inline const struct pcdvobjs_tzinfo *get_tzinfo(const char *timezone)
+{
+    return timezone ? pcdvobjs_get_tzinfo(timezone) : NULL;
+}
+
 static void get_local_broken_down_time(struct tm *result,
         time_t sec, const char *timezone)
 {
+    const struct pcdvobjs_tzinfo *tzi = get_tzinfo(timezone);
+    if (tzi) {
+        pcdvobjs_tzinfo_localtime(tzi, sec, result);
+        return;
+    }
+
     char *tz_old = set_tz(timezone);
     localtime_r(&sec, result);
     unset_tz(tz_old);
@@ -194,6 +207,10 @@ static void get_local_broken_down_time(struct tm *result,
 static time_t get_time_from_broken_down_time(struct tm *tm,
         const char *timezone)
 {
+    const struct pcdvobjs_tzinfo *tzi = get_tzinfo(timezone);
+    if (tzi)
+        return pcdvobjs_tzinfo_mktime(tzi, tm);
+
     char *tz_old = set_tz(timezone);
     time_t t = mktime(tm);
     unset_tz(tz_old);
@@ -483,7 +500,9 @@ format_broken_down_time(const char *timeformat, const struct tm *tm,
         return PURC_VARIANT_INVALID;
     }
 
-    char *tz_old = set_tz(timezone);
+    /* tm_gmtoff and tm_zone are already right if the broken-down time
+       was made from the cached rules; strftime() needs no TZ then. */
+    char *tz_old = get_tzinfo(timezone) ? NULL : set_tz(timezone);
     if (strftime(result, max, timeformat, tm) == 0) {
         // should not occur.
         PC_ERROR("Too small buffer to format time\n");
@@ -1141,11 +1160,7 @@ get_broken_down_time(purc_variant_t bdtime, struct tm *tm, suseconds_t *usec)
     if (number < 0)
         tm->tm_isdst = -1;
 
-    char *tz_old = set_tz(timezone);
-    time_t t = mktime(tm);
-    localtime_r(&t, tm);
-    unset_tz(tz_old);
-
+    get_time_from_broken_down_time(tm, timezone);
     return timezone;
 
 failed:
@@ -186,6 +186,10 @@ static int _init_once(void)
         if (keywords2atoms[i].atom - keywords2atoms[0].atom != i)
             return -1;
     }
+
+    if (pcdvobjs_tzinfo_init_once())
+        return -1;
+
     // initialize others
     return 0;
 }
@@ -26,6 +26,7 @@
 #include "private/errors.h"
 #include "private/dvobjs.h"
 #include "private/utils.h"
+#include "private/regex.h"
 #include "purc-variant.h"
 #include "helper.h"
 
@@ -34,40 +35,25 @@
 
 static bool reg_cmp(const char *buf1, const char *buf2)
 {
-    regex_t reg;
-    int err = 0;
-    int number = 10;
-    regmatch_t pmatch[number];
+    struct pcregex_cached *cached;
+    regmatch_t pmatch[10];
+    bool matched = false;
 
     if ((buf1 == NULL) || (buf2 == NULL))
         return false;
 
-    if (regcomp(&reg, buf1, REG_EXTENDED) < 0) {
-        goto error;
-    }
-
-    err = regexec(&reg, buf2, number, pmatch, 0);
-
-    if (err == REG_NOMATCH) {
-        goto error_free;
-    }
-    else if (err) {
-        goto error_free;
-    }
+    cached = pcregex_cache_get_posix(buf1, REG_EXTENDED);
+    if (cached == NULL)
+        return false;
 
-    if (pmatch[0].rm_so == -1) {
-        goto error_free;
+    if (regexec(pcregex_cached_posix(cached), buf2,
+                PCA_TABLESIZE(pmatch), pmatch, 0) == 0 &&
+            pmatch[0].rm_so != -1) {
+        matched = true;
     }
 
-    regfree(&reg);
-
-    return true;
-
-error_free:
-    regfree(&reg);
-
-error:
-    return false;
+    pcregex_cached_release(cached);
+    return matched;
 }
 
 static purc_variant_t
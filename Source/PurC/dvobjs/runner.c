@@ -28,10 +28,14 @@
 #include "private/dvobjs.h"
 #include "private/url.h"
 #include "private/channel.h"
+#include "private/executor.h"
+#include "private/interpreter.h"
+#include "private/msg-queue.h"
 #include "purc-variant.h"
 #include "helper.h"
 
 #include <limits.h>
+#include <string.h>
 #include <errno.h>
 
 #include <sys/types.h>
@@ -40,6 +44,9 @@
 
 #define KN_USER_OBJ     "myObj"
 
+#define KW_LOCAL        "local"
+#define KW_GLOBAL       "global"
+
 static purc_variant_t
 user_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         unsigned call_flags)
@@ -188,6 +195,11 @@ chan_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         return pcchan_make_entity(chan);
     }
 
+    /* fall back to the global channel */
+    purc_variant_t retv = pcchan_global_make_entity(chan_name);
+    if (retv)
+        return retv;
+
 failed:
     if (call_flags & PCVRT_CALL_FLAG_SILENTLY)
         return purc_variant_make_undefined();
@@ -221,7 +233,34 @@ chan_setter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         }
     }
 
-    PC_DEBUG("chan_setter(%s, %u)\n", chan_name, cap);
+    bool global = false;
+    if (nr_args > 2) {
+        const char *scope = purc_variant_get_string_const(argv[2]);
+        if (scope == NULL) {
+            pcinst_set_error(PURC_ERROR_WRONG_DATA_TYPE);
+            goto failed;
+        }
+
+        if (strcmp(scope, KW_GLOBAL) == 0) {
+            global = true;
+        }
+        else if (strcmp(scope, KW_LOCAL) != 0) {
+            pcinst_set_error(PURC_ERROR_INVALID_VALUE);
+            goto failed;
+        }
+    }
+
+    PC_DEBUG("chan_setter(%s, %u, %s)\n", chan_name, cap,
+            global ? KW_GLOBAL : KW_LOCAL);
+
+    if (global) {
+        if (!pcchan_global_ctrl(chan_name, cap)) {
+            // error set by pcchan_global_ctrl()
+            goto failed;
+        }
+
+        return purc_variant_make_boolean(true);
+    }
 
     pcchan_t chan = pcchan_retrieve(chan_name);
     if (chan) {
@@ -247,6 +286,247 @@ failed:
     return PURC_VARIANT_INVALID;
 }
 
+static bool
+set_number(purc_variant_t obj, const char *key, double d)
+{
+    purc_variant_t val = purc_variant_make_number(d);
+    if (val == PURC_VARIANT_INVALID)
+        return false;
+
+    bool ok = purc_variant_object_set_by_static_ckey(obj, key, val);
+    purc_variant_unref(val);
+    return ok;
+}
+
+static bool
+set_ulongint(purc_variant_t obj, const char *key, uint64_t u64)
+{
+    purc_variant_t val = purc_variant_make_ulongint(u64);
+    if (val == PURC_VARIANT_INVALID)
+        return false;
+
+    bool ok = purc_variant_object_set_by_static_ckey(obj, key, val);
+    purc_variant_unref(val);
+    return ok;
+}
+
+/* Adds an empty object as the property of `obj`, and returns it as
+   a borrowed reference, so that a failure later only needs to release
+   the root object. */
+static purc_variant_t
+add_object(purc_variant_t obj, const char *key)
+{
+    purc_variant_t val = purc_variant_make_object(0,
+            PURC_VARIANT_INVALID, PURC_VARIANT_INVALID);
+    if (val == PURC_VARIANT_INVALID)
+        return PURC_VARIANT_INVALID;
+
+    bool ok = purc_variant_object_set_by_static_ckey(obj, key, val);
+    purc_variant_unref(val);
+    return ok ? val : PURC_VARIANT_INVALID;
+}
+
+static bool
+variants_stats(purc_variant_t retv)
+{
+    const struct purc_variant_stat *stat = purc_variant_usage_stat();
+    if (stat == NULL)
+        return false;
+
+    purc_variant_t obj = add_object(retv, "variants");
+    if (obj == PURC_VARIANT_INVALID ||
+            !set_ulongint(obj, "total", stat->nr_total_values) ||
+            !set_ulongint(obj, "memory", stat->sz_total_mem) ||
+            !set_ulongint(obj, "reserved", stat->nr_reserved))
+        return false;
+
+    purc_variant_t by_type = add_object(obj, "byType");
+    if (by_type == PURC_VARIANT_INVALID)
+        return false;
+
+    for (int i = 0; i < PURC_VARIANT_TYPE_NR; i++) {
+        if (stat->nr_values[i] == 0)
+            continue;
+
+        purc_variant_t one = add_object(by_type, purc_variant_typename(i));
+        if (one == PURC_VARIANT_INVALID ||
+                !set_ulongint(one, "count", stat->nr_values[i]) ||
+                !set_ulongint(one, "memory", stat->sz_mem[i]))
+            return false;
+    }
+
+    return true;
+}
+
+struct crtns_stats {
+    size_t nr_ready;
+    size_t nr_running;
+    size_t nr_observing;
+    size_t nr_stopped;
+    size_t nr_exiting;
+    size_t nr_queued_msgs;
+    size_t nr_inflight_fetches;
+};
+
+static void
+count_coroutines(struct list_head *crtns, struct crtns_stats *stats)
+{
+    pcintr_coroutine_t co;
+    list_for_each_entry(co, crtns, ln) {
+        switch (co->state) {
+        case CO_STATE_READY:
+            stats->nr_ready++;
+            break;
+        case CO_STATE_RUNNING:
+            stats->nr_running++;
+            break;
+        case CO_STATE_OBSERVING:
+            stats->nr_observing++;
+            break;
+        case CO_STATE_STOPPED:
+            stats->nr_stopped++;
+            break;
+        default:
+            stats->nr_exiting++;
+            break;
+        }
+
+        if (co->mq) {
+            purc_rwlock_reader_lock(&co->mq->lock);
+            stats->nr_queued_msgs += co->mq->nr_msgs;
+            purc_rwlock_reader_unlock(&co->mq->lock);
+        }
+
+        if (co->stack.async_request_ids) {
+            stats->nr_inflight_fetches +=
+                purc_variant_array_get_size(co->stack.async_request_ids);
+        }
+    }
+}
+
+static bool
+renderer_stats(struct pcinst *inst, purc_variant_t retv)
+{
+    struct pcrdr_conn_stats stats;
+    if (inst->conn_to_rdr == NULL ||
+            pcrdr_conn_get_stats(inst->conn_to_rdr, &stats)) {
+        purc_variant_t null = purc_variant_make_null();
+        bool ok = purc_variant_object_set_by_static_ckey(retv,
+                "renderer", null);
+        purc_variant_unref(null);
+        return ok;
+    }
+
+    purc_variant_t obj = add_object(retv, "renderer");
+    if (obj == PURC_VARIANT_INVALID ||
+            !set_ulongint(obj, "pending", stats.nr_pending) ||
+            !set_ulongint(obj, "requests", stats.nr_requests) ||
+            !set_ulongint(obj, "responses", stats.nr_responses) ||
+            !set_ulongint(obj, "timeouts", stats.nr_timeouts))
+        return false;
+
+    /* in microseconds */
+    purc_variant_t rtt = add_object(obj, "roundTrip");
+    if (rtt == PURC_VARIANT_INVALID ||
+            !set_ulongint(rtt, "p50", stats.rtt_p50) ||
+            !set_ulongint(rtt, "p90", stats.rtt_p90) ||
+            !set_ulongint(rtt, "p99", stats.rtt_p99) ||
+            !set_ulongint(rtt, "max", stats.rtt_max))
+        return false;
+
+    return true;
+}
+
+static purc_variant_t
+stats_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
+        unsigned call_flags)
+{
+    UNUSED_PARAM(root);
+    UNUSED_PARAM(nr_args);
+    UNUSED_PARAM(argv);
+
+    struct pcinst *inst = pcinst_current();
+    struct pcintr_heap *heap = inst->intr_heap;
+    purc_variant_t retv = PURC_VARIANT_INVALID;
+    purc_variant_t obj;
+
+    if (heap == NULL) {
+        pcinst_set_error(PURC_ERROR_NOT_SUPPORTED);
+        goto failed;
+    }
+
+    struct crtns_stats crtns = { };
+    count_coroutines(&heap->crtns, &crtns);
+    count_coroutines(&heap->stopped_crtns, &crtns);
+
+    size_t nr_holding = 0;
+    purc_inst_holding_messages_count(&nr_holding);
+
+    retv = purc_variant_make_object(0,
+            PURC_VARIANT_INVALID, PURC_VARIANT_INVALID);
+    if (retv == PURC_VARIANT_INVALID)
+        goto failed;
+
+    if (!variants_stats(retv))
+        goto failed;
+
+    obj = add_object(retv, "coroutines");
+    if (obj == PURC_VARIANT_INVALID ||
+            !set_ulongint(obj, "ready", crtns.nr_ready) ||
+            !set_ulongint(obj, "running", crtns.nr_running) ||
+            !set_ulongint(obj, "observing", crtns.nr_observing) ||
+            !set_ulongint(obj, "stopped", crtns.nr_stopped) ||
+            !set_ulongint(obj, "exiting", crtns.nr_exiting))
+        goto failed;
+
+    obj = add_object(retv, "messages");
+    if (obj == PURC_VARIANT_INVALID ||
+            !set_ulongint(obj, "queued", crtns.nr_queued_msgs) ||
+            !set_ulongint(obj, "moveBuffer", nr_holding) ||
+            !set_ulongint(obj, "handled", heap->nr_msgs_handled) ||
+            !set_number(obj, "perSecond", heap->msgs_per_second))
+        goto failed;
+
+    if (!renderer_stats(inst, retv))
+        goto failed;
+
+    if (!set_ulongint(retv, "fetcherInflight", crtns.nr_inflight_fetches) ||
+            !set_ulongint(retv, "timersArmed", heap->timer_wheel ?
+                pcutils_timer_wheel_count(heap->timer_wheel) : 0))
+        goto failed;
+
+    if (inst->executor_heap) {
+        struct pcexecutor_heap *exe_heap = inst->executor_heap;
+        obj = add_object(retv, "executorRules");
+        if (obj == PURC_VARIANT_INVALID ||
+                !set_ulongint(obj, "cached", exe_heap->nr_rules) ||
+                !set_ulongint(obj, "hits", exe_heap->nr_rule_hits) ||
+                !set_ulongint(obj, "misses", exe_heap->nr_rule_misses) ||
+                !set_ulongint(obj, "evictions", exe_heap->nr_rule_evictions))
+            goto failed;
+    }
+
+    const struct purc_regex_cache_stat *regex = purc_regex_cache_stat();
+    if (regex) {
+        obj = add_object(retv, "regexCache");
+        if (obj == PURC_VARIANT_INVALID ||
+                !set_ulongint(obj, "cached", regex->nr_entries) ||
+                !set_ulongint(obj, "hits", regex->nr_hits) ||
+                !set_ulongint(obj, "misses", regex->nr_misses) ||
+                !set_ulongint(obj, "evictions", regex->nr_evictions))
+            goto failed;
+    }
+
+    return retv;
+
+failed:
+    PURC_VARIANT_SAFE_CLEAR(retv);
+    if (call_flags & PCVRT_CALL_FLAG_SILENTLY)
+        return purc_variant_make_null();
+
+    return PURC_VARIANT_INVALID;
+}
+
 purc_variant_t
 purc_dvobj_runner_new(void)
 {
@@ -259,6 +539,7 @@ purc_dvobj_runner_new(void)
         { "rid",    rid_getter,     NULL },
         { "uri",    uri_getter,     NULL },
         { "chan",   chan_getter,    chan_setter },
+        { "stats",  stats_getter,   NULL },
 #if ENABLE(CHINESE_NAMES)
         { "用户",   user_getter,    user_setter },
         { "应用名", app_getter,     NULL },
@@ -266,6 +547,7 @@ purc_dvobj_runner_new(void)
         { "行者标识符", rid_getter,     NULL },
         { "统一资源标识符",    uri_getter,     NULL },
         { "通道",   chan_getter,    chan_setter },
+        { "统计",   stats_getter,   NULL },
 #endif
     };
 
@@ -37,6 +37,7 @@
 
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -46,6 +47,9 @@
 
 #define BUFFER_SIZE                 1024
 
+/* the initial size of the read-ahead buffer; doubled for long lines */
+#define READ_AHEAD_SIZE             (1024 * 16)
+
 #define ENDIAN_PLATFORM             0
 #define ENDIAN_LITTLE               1
 #define ENDIAN_BIG                  2
@@ -57,6 +61,7 @@
 #define STREAM_EVENT_NAME           "event"
 #define STREAM_SUB_EVENT_READ       "readable"
 #define STREAM_SUB_EVENT_WRITE      "writable"
+#define STREAM_SUB_EVENT_LINE       "line"
 #define STREAM_SUB_EVENT_ALL        "*"
 
 #define FILE_DEFAULT_MODE           0644
@@ -183,6 +188,15 @@ struct pcdvobjs_stream {
 
     pid_t cpid;                 /* only for pipe, the pid of child */
     purc_atom_t cid;
+
+    /* the read-ahead buffer of stm4r; the unconsumed bytes are
+       in [rpos, rlen) and are carried over between the reads. */
+    unsigned char *rbuf;
+    size_t sz_rbuf;
+    size_t rpos, rlen;
+
+    unsigned int line_events:1; /* observed for `event:line` */
+    unsigned int reached_eof:1; /* the end of `event:line` posted */
 };
 
 static
@@ -220,6 +234,13 @@ static void native_stream_close(struct pcdvobjs_stream *stream)
     stream->stm4w = NULL;
     stream->stm4r = NULL;
 
+    if (stream->rbuf) {
+        free(stream->rbuf);
+        stream->rbuf = NULL;
+    }
+    stream->sz_rbuf = 0;
+    stream->rpos = stream->rlen = 0;
+
     if (stream->option) {
         purc_variant_unref(stream->option);
         stream->option = PURC_VARIANT_INVALID;
@@ -290,6 +311,118 @@ struct pcdvobjs_stream *get_stream(void *native_entity)
     return (struct pcdvobjs_stream*)native_entity;
 }
 
+static inline size_t read_ahead_pending(struct pcdvobjs_stream *stream)
+{
+    return stream->rlen - stream->rpos;
+}
+
+static inline void read_ahead_discard(struct pcdvobjs_stream *stream)
+{
+    stream->rpos = stream->rlen = 0;
+}
+
+/*
+ * Read more bytes from stm4r into the read-ahead buffer. The unconsumed
+ * bytes are moved to the head first, and the buffer grows if it is full.
+ *
+ * Returns the number of bytes read, 0 for the end of the stream, or -1
+ * if no byte is available now or on error.
+ */
+static ssize_t read_ahead_fill(struct pcdvobjs_stream *stream)
+{
+    if (stream->rpos > 0) {
+        size_t pending = read_ahead_pending(stream);
+        memmove(stream->rbuf, stream->rbuf + stream->rpos, pending);
+        stream->rpos = 0;
+        stream->rlen = pending;
+    }
+
+    if (stream->rlen == stream->sz_rbuf) {
+        size_t sz = stream->sz_rbuf ? stream->sz_rbuf * 2 : READ_AHEAD_SIZE;
+        unsigned char *buf = realloc(stream->rbuf, sz);
+        if (buf == NULL) {
+            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            return -1;
+        }
+
+        stream->rbuf = buf;
+        stream->sz_rbuf = sz;
+    }
+
+    ssize_t n = purc_rwstream_read(stream->stm4r, stream->rbuf + stream->rlen,
+            stream->sz_rbuf - stream->rlen);
+    if (n > 0)
+        stream->rlen += n;
+    return n;
+}
+
+/*
+ * Take the next line (without the line feed) from the read-ahead buffer.
+ * The last line which is not terminated is only taken at the end of
+ * the stream; otherwise it is carried over to the next fill.
+ */
+static bool read_ahead_next_line(struct pcdvobjs_stream *stream, bool at_eof,
+        const char **line, size_t *length)
+{
+    size_t pending = read_ahead_pending(stream);
+    if (pending == 0)
+        return false;
+
+    const char *head = (const char *)stream->rbuf + stream->rpos;
+    /* memchr() of libc scans the bytes by vector instructions */
+    const char *lf = memchr(head, '\n', pending);
+    if (lf) {
+        *line = head;
+        *length = lf - head;
+        stream->rpos += *length + 1;
+        return true;
+    }
+
+    if (at_eof) {
+        *line = head;
+        *length = pending;
+        stream->rpos = stream->rlen;
+        return true;
+    }
+
+    return false;
+}
+
+/* Read the buffered bytes first, then the bytes from stm4r directly. */
+static ssize_t read_through(struct pcdvobjs_stream *stream, void *buf,
+        size_t count)
+{
+    size_t n = read_ahead_pending(stream);
+    if (n > count)
+        n = count;
+
+    if (n) {
+        memcpy(buf, stream->rbuf + stream->rpos, n);
+        stream->rpos += n;
+        if (n == count)
+            return n;
+    }
+
+    ssize_t r = purc_rwstream_read(stream->stm4r, (char *)buf + n, count - n);
+    if (r < 0)
+        return n ? (ssize_t)n : r;
+    return n + r;
+}
+
+static ssize_t read_through_cb(void *ctxt, void *buf, size_t count)
+{
+    return read_through((struct pcdvobjs_stream *)ctxt, buf, count);
+}
+
+/* Give the bytes read ahead back to a regular file before writing to it. */
+static void read_ahead_rewind(struct pcdvobjs_stream *stream)
+{
+    size_t pending = read_ahead_pending(stream);
+    if (pending && stream->type == STREAM_TYPE_FILE &&
+            purc_rwstream_seek(stream->stm4r, -(off_t)pending, SEEK_CUR) >= 0)
+        read_ahead_discard(stream);
+}
+
 static purc_variant_t
 readstruct_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
                 unsigned call_flags)
@@ -334,8 +467,21 @@ readstruct_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
         goto out;
     }
 
-    return purc_dvobj_read_struct(rwstream, formats, formats_left,
+    if (read_ahead_pending(stream) == 0) {
+        return purc_dvobj_read_struct(rwstream, formats, formats_left,
+                (call_flags & PCVRT_CALL_FLAG_SILENTLY));
+    }
+
+    /* consume the bytes read ahead by readlines() first */
+    purc_variant_t ret_var;
+    rwstream = purc_rwstream_new_for_read(stream, read_through_cb);
+    if (rwstream == NULL)
+        goto out;
+
+    ret_var = purc_dvobj_read_struct(rwstream, formats, formats_left,
             (call_flags & PCVRT_CALL_FLAG_SILENTLY));
+    purc_rwstream_destroy(rwstream);
+    return ret_var;
 
 out:
     if (call_flags & PCVRT_CALL_FLAG_SILENTLY) {
@@ -369,6 +515,7 @@ writestruct_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
         purc_set_error(PURC_ERROR_INVALID_VALUE);
         goto out;
     }
+    read_ahead_rewind(stream);
 
     if (nr_args < 2) {
         purc_set_error(PURC_ERROR_ARGUMENT_MISSED);
@@ -422,49 +569,69 @@ out:
     return PURC_VARIANT_INVALID;
 }
 
-#define LINE_FLAG           "\n"
-static int read_lines(purc_rwstream_t stream, int line_num,
-        purc_variant_t array)
+static int append_line(purc_variant_t array, const char *line, size_t length)
 {
-    unsigned char buffer[BUFFER_SIZE];
-    ssize_t read_size = 0;
-    size_t length = 0;
-    const char *head = NULL;
-    const char *end = NULL;
-
-    while (line_num) {
-        read_size = purc_rwstream_read(stream, buffer, BUFFER_SIZE);
-        if (read_size < 0)
-            break;
+    purc_variant_t var = purc_variant_make_string_ex(line, length, false);
+    if (!var) {
+        return -1;
+    }
 
-        end = (const char*)(buffer + read_size);
+    bool ok = purc_variant_array_append(array, var);
+    purc_variant_unref(var);
+    return ok ? 0 : -1;
+}
 
-        head = pcutils_get_next_token_len((const char*)buffer, read_size,
-                LINE_FLAG, &length);
-        while (head && head < end) {
-            purc_variant_t var = purc_variant_make_string_ex(head, length,
-                    false);
-            if (!var) {
-                return -1;
-            }
-            if (!purc_variant_array_append(array, var)) {
-                purc_variant_unref(var);
-                return -1;
-            }
-            purc_variant_unref(var);
-            line_num --;
+/*
+ * Whether more bytes can be read from stm4r without blocking. A regular
+ * file never blocks; for other streams, the descriptor is polled.
+ */
+static bool read_ahead_available(struct pcdvobjs_stream *stream)
+{
+    if (stream->type == STREAM_TYPE_FILE)
+        return true;
+    if (stream->fd4r < 0)
+        return false;
 
-            if (line_num == 0)
-                break;
+    struct pollfd pfd = { stream->fd4r, POLLIN, 0 };
+    return poll(&pfd, 1, 0) > 0;
+}
 
-            head = pcutils_get_next_token_len(head + length, end - head - length,
-                LINE_FLAG, &length);
+/*
+ * Take at most @line_num non-empty lines. The stream is read once if there
+ * are not enough lines buffered, and read again only while more bytes are
+ * available, so a blocking pipe is not waited for more than the first read.
+ */
+static int read_lines(struct pcdvobjs_stream *stream, int64_t line_num,
+        purc_variant_t array)
+{
+    const char *line;
+    size_t length;
+    bool at_eof = false;
+    bool has_read = false;
+
+    while (line_num > 0) {
+        if (read_ahead_next_line(stream, at_eof, &line, &length)) {
+            /* the empty lines are skipped */
+            if (length == 0)
+                continue;
+
+            if (append_line(array, line, length))
+                return -1;
+            line_num--;
+            continue;
         }
-        if (read_size < BUFFER_SIZE)           // to the end
+
+        if (at_eof || (has_read && !read_ahead_available(stream)))
             break;
 
-        if (line_num == 0)
+        /* keep the partial line for the next call if not at the end */
+        ssize_t n = read_ahead_fill(stream);
+        if (n < 0)
             break;
+
+        has_read = true;
+        if (n == 0)
+            at_eof = true;
     }
 
     return 0;
@@ -507,7 +674,7 @@ readlines_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
     }
 
     if (line_num > 0) {
-        int ret = read_lines(rwstream, line_num, ret_var);
+        int ret = read_lines(stream, line_num, ret_var);
         if (ret != 0) {
             goto out;
         }
@@ -546,6 +713,7 @@ writelines_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
         purc_set_error(PURC_ERROR_INVALID_VALUE);
         goto out;
     }
+    read_ahead_rewind(stream);
 
     if (nr_args < 1) {
         purc_set_error(PURC_ERROR_ARGUMENT_MISSED);
@@ -651,18 +819,39 @@ readbytes_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
         ret_var = purc_variant_make_byte_sequence_empty();
     }
     else {
-        char * content = malloc(byte_num);
+        unsigned char *content;
+        size_t sz_content = byte_num;
         size_t size = 0;
+        size_t pending = read_ahead_pending(stream);
+
+        if (pending && stream->rpos == 0 && byte_num >= stream->sz_rbuf) {
+            /* hand the read-ahead buffer over to the byte sequence */
+            content = realloc(stream->rbuf, sz_content);
+            if (content == NULL) {
+                purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+                goto out;
+            }
 
-        if (content == NULL) {
-            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-            goto out;
+            size = pending;
+            stream->rbuf = NULL;
+            stream->sz_rbuf = 0;
+            read_ahead_discard(stream);
+        }
+        else {
+            content = malloc(sz_content);
+            if (content == NULL) {
+                purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+                goto out;
+            }
         }
 
-        size = purc_rwstream_read(rwstream, content, byte_num);
+        ssize_t n = read_through(stream, content + size, byte_num - size);
+        if (n > 0)
+            size += n;
+
         if (size > 0) {
             ret_var = purc_variant_make_byte_sequence_reuse_buff(content,
-                    size, size);
+                    size, sz_content);
         }
         else {
             free(content);
@@ -699,6 +888,7 @@ writebytes_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
         purc_set_error(PURC_ERROR_INVALID_VALUE);
         goto out;
     }
+    read_ahead_rewind(stream);
 
     if (nr_args < 1) {
         purc_set_error(PURC_ERROR_ARGUMENT_MISSED);
@@ -907,6 +1097,11 @@ seek_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
         whence = SEEK_END;
     }
 
+    /* the bytes read ahead are not consumed yet */
+    if (whence == SEEK_CUR)
+        byte_num -= read_ahead_pending(stream);
+    read_ahead_discard(stream);
+
     off = purc_rwstream_seek(rwstream, byte_num, (int)whence);
     if (off == -1) {
         goto out;
@@ -947,11 +1142,65 @@ struct io_callback_data {
     struct pcdvobjs_stream       *stream;
 };
 
+static void post_line_event(struct pcdvobjs_stream *stream,
+        purc_variant_t line)
+{
+    pcintr_coroutine_post_event(stream->cid,
+            PCRDR_MSG_EVENT_REDUCE_OPT_KEEP,
+            stream->observed, STREAM_EVENT_NAME, STREAM_SUB_EVENT_LINE,
+            line, PURC_VARIANT_INVALID);
+}
+
+/*
+ * Read what is available and post an `event:line` for every complete line
+ * which is not empty; the partial line is carried over to the next time the stream is readable.
+ * At the end of the stream, the last line is posted and followed by
+ * an `event:line` with null as the payload.
+ */
+static void post_lines(struct pcdvobjs_stream *stream)
+{
+    const char *line;
+    size_t length;
+
+    if (stream->reached_eof)
+        return;
+
+    ssize_t n = read_ahead_fill(stream);
+    while (read_ahead_next_line(stream, n == 0, &line, &length)) {
+        if (length == 0)
+            continue;
+
+        purc_variant_t v = purc_variant_make_string_ex(line, length, false);
+        if (v) {
+            post_line_event(stream, v);
+            purc_variant_unref(v);
+        }
+    }
+
+    if (n == 0) {
+        purc_variant_t null = purc_variant_make_null();
+        post_line_event(stream, null);
+        purc_variant_unref(null);
+        stream->reached_eof = 1;
+
+        /* the end of the stream stays readable; stop watching it */
+        if (stream->monitor4r) {
+            purc_runloop_remove_fd_monitor(purc_runloop_get_current(),
+                    stream->monitor4r);
+            stream->monitor4r = 0;
+        }
+    }
+}
+
 static void on_stream_io_callback(struct io_callback_data *data)
 {
     purc_runloop_io_event event = data->io_event;
     struct pcdvobjs_stream *stream = data->stream;
 
+    if ((event & PCRUNLOOP_IO_IN) && stream->line_events && stream->cid) {
+        post_lines(stream);
+    }
+
     const char* sub = NULL;
     if (event & PCRUNLOOP_IO_IN) {
         sub = STREAM_SUB_EVENT_READ;
@@ -997,6 +1246,7 @@ on_observe(void *native_entity, const char *event_name,
         return false;
     }
 
+    struct pcdvobjs_stream *stream = (struct pcdvobjs_stream*)native_entity;
     purc_runloop_io_event event = PCRUNLOOP_IO_IN;
     if (strcmp(event_subname, STREAM_SUB_EVENT_READ) == 0) {
         event = PCRUNLOOP_IO_IN;
@@ -1007,12 +1257,18 @@ on_observe(void *native_entity, const char *event_name,
     else if (strcmp(event_subname, STREAM_SUB_EVENT_ALL) == 0) {
         event = PCRUNLOOP_IO_IN | PCRUNLOOP_IO_OUT;
     }
+    else if (strcmp(event_subname, STREAM_SUB_EVENT_LINE) == 0) {
+        event = PCRUNLOOP_IO_IN;
+        stream->line_events = 1;
+        stream->reached_eof = 0;
+    }
 
-    struct pcdvobjs_stream *stream = (struct pcdvobjs_stream*)native_entity;
     if (event & PCRUNLOOP_IO_IN && stream->fd4r >= 0) {
-        stream->monitor4r = purc_runloop_add_fd_monitor(
-                purc_runloop_get_current(), stream->fd4r, PCRUNLOOP_IO_IN,
-                stream_io_callback, stream);
+        /* `line` and `readable` share the monitor */
+        if (stream->monitor4r == 0)
+            stream->monitor4r = purc_runloop_add_fd_monitor(
+                    purc_runloop_get_current(), stream->fd4r, PCRUNLOOP_IO_IN,
+                    stream_io_callback, stream);
         if (stream->monitor4r) {
             pcintr_coroutine_t co = pcintr_get_coroutine();
             if (co) {
@@ -1060,6 +1316,7 @@ on_forget(void *native_entity, const char *event_name,
         stream->monitor4w = 0;
     }
     stream->cid = 0;
+    stream->line_events = 0;
 
     return true;
 }
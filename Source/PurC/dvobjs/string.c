@@ -31,31 +31,6 @@
 #include "purc-variant.h"
 #include "helper.h"
 
-static const char * get_next_segment (const char *data,
-        const char *delim, size_t *length)
-{
-    const char *head = NULL;
-    char *temp = NULL;
-
-    *length = 0;
-
-    if ((*data == 0x00) || (*delim == 0x00))
-        return NULL;
-
-    head = data;
-
-    temp = strstr (head, delim);
-
-    if (temp) {
-        *length =  temp - head;
-    }
-    else {
-        *length = strlen (head);
-    }
-
-    return head;
-}
-
 static purc_variant_t
 nr_bytes_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         unsigned call_flags)
@@ -148,7 +123,8 @@ contains_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         result  = pcutils_strcasestr(haystack, needle) != NULL;
     }
     else {
-        result = strstr(haystack, needle) != NULL;
+        result = pcutils_memmem(haystack, len_haystack,
+                needle, len_needle) != NULL;
     }
 
     return purc_variant_make_boolean(result);
@@ -625,7 +601,6 @@ explode_getter (purc_variant_t root, size_t nr_args, purc_variant_t *argv,
 
     purc_variant_t ret_var = PURC_VARIANT_INVALID;
     purc_variant_t val = PURC_VARIANT_INVALID;
-    char *buf = NULL;
 
     if ((argv == NULL) || (nr_args < 2)) {
         purc_set_error (PURC_ERROR_ARGUMENT_MISSED);
@@ -643,33 +618,38 @@ explode_getter (purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         return PURC_VARIANT_INVALID;
     }
 
-    const char *source = purc_variant_get_string_const (argv[0]);
-    const char *delim = purc_variant_get_string_const (argv[1]);
-    size_t len_delim = purc_variant_string_size (argv[1]) - 1;
-    size_t length = 0;
-    const char *head = get_next_segment (source, delim, &length);
+    size_t len_source, len_delim;
+    const char *source = purc_variant_get_string_const_ex (argv[0],
+            &len_source);
+    const char *delim = purc_variant_get_string_const_ex (argv[1],
+            &len_delim);
 
     ret_var = purc_variant_make_array (0, PURC_VARIANT_INVALID);
+    if (ret_var == PURC_VARIANT_INVALID)
+        return PURC_VARIANT_INVALID;
 
-    while (head) {
-        buf = malloc (length + 1);
-        if (buf == NULL) {
-            purc_set_error (PURC_ERROR_OUT_OF_MEMORY);
+    /* an empty source or delimiter gives an empty array */
+    if (len_source == 0 || len_delim == 0)
+        return ret_var;
+
+    const char *head = source;
+    const char *end = source + len_source;
+    while (head < end) {
+        const char *found = pcutils_memmem (head, end - head,
+                delim, len_delim);
+        const char *tail = found ? found : end;
+
+        val = purc_variant_make_string_ex (head, tail - head, true);
+        if (val == PURC_VARIANT_INVALID) {
             purc_variant_unref (ret_var);
             return PURC_VARIANT_INVALID;
         }
-
-        strncpy (buf, head, length + 1);
-        *(buf + length)= 0x00;
-        val = purc_variant_make_string_reuse_buff (buf, length, true);
         purc_variant_array_append (ret_var, val);
         purc_variant_unref (val);
 
-        if (*(head + length) != 0x00)
-            head = get_next_segment (head + length + len_delim,
-                    delim, &length);
-        else
+        if (found == NULL)
             break;
+        head = found + len_delim;
     }
 
     return ret_var;
@@ -806,36 +786,47 @@ replace_getter (purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         return PURC_VARIANT_INVALID;
     }
 
-    const char *source = purc_variant_get_string_const (argv[0]);
+    size_t len_source, len_replace;
+    const char *source = purc_variant_get_string_const_ex (argv[0],
+            &len_source);
     const char *delim = purc_variant_get_string_const (argv[1]);
-    const char *replace = purc_variant_get_string_const (argv[2]);
-    purc_rwstream_t rwstream = purc_rwstream_new_buffer (32, STREAM_SIZE);
-
-    size_t len_replace = purc_variant_string_size (argv[2]) - 1;
-    size_t length = 0;
-    const char *head = get_next_segment (source, delim, &length);
-
-    while (head) {
-        purc_rwstream_write (rwstream, head, length);
-
-        if (*(head + length) != 0x00) {
-            purc_rwstream_write (rwstream, replace, len_replace);
-            head = get_next_segment (head + length + len_delim,
-                    delim, &length);
-        } else
-            break;
-    }
-
-    size_t rw_size = 0;
-    const char *rw_string = purc_rwstream_get_mem_buffer (rwstream, &rw_size);
-
-    if ((rw_size == 0) || (rw_string == NULL))
-        ret_var = PURC_VARIANT_INVALID;
-    else {
-        ret_var = purc_variant_make_string (rw_string, false);
+    const char *replace = purc_variant_get_string_const_ex (argv[2],
+            &len_replace);
+
+    /* count the occurrences first to allocate the result only once */
+    size_t nr_found = pcutils_memmem_count (source, len_source,
+            delim, len_delim);
+    if (nr_found == 0)
+        return purc_variant_ref (argv[0]);
+
+    size_t len_result = len_source - nr_found * len_delim +
+        nr_found * len_replace;
+    char *result = malloc (len_result + 1);
+    if (result == NULL) {
+        purc_set_error (PURC_ERROR_OUT_OF_MEMORY);
+        return PURC_VARIANT_INVALID;
     }
 
-    purc_rwstream_destroy (rwstream);
+    const char *head = source;
+    const char *end = source + len_source;
+    char *p = result;
+    for (size_t i = 0; i < nr_found; i++) {
+        const char *found = pcutils_memmem (head, end - head,
+                delim, len_delim);
+        memcpy (p, head, found - head);
+        p += found - head;
+        memcpy (p, replace, len_replace);
+        p += len_replace;
+        head = found + len_delim;
+    }
+    memcpy (p, head, end - head);
+    p += end - head;
+    *p = 0x00;
+
+    ret_var = purc_variant_make_string_reuse_buff (result,
+            len_result + 1, false);
+    if (ret_var == PURC_VARIANT_INVALID)
+        free (result);
 
     return ret_var;
 }
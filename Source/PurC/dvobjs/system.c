@@ -869,6 +869,23 @@ failed:
     return PURC_VARIANT_INVALID;
 }
 
+/* make the remaining time in seconds in the type of the argument */
+static purc_variant_t
+make_remaining_time(int arg_type, long double ld_rem)
+{
+    if (arg_type == PURC_VARIANT_TYPE_LONGINT) {
+        return purc_variant_make_longint((int64_t)ld_rem);
+    }
+    else if (arg_type == PURC_VARIANT_TYPE_ULONGINT) {
+        return purc_variant_make_ulongint((uint64_t)ld_rem);
+    }
+    else if (arg_type == PURC_VARIANT_TYPE_NUMBER) {
+        return purc_variant_make_number((double)ld_rem);
+    }
+
+    return purc_variant_make_longdouble(ld_rem);
+}
+
 static purc_variant_t
 sleep_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
         unsigned call_flags)
@@ -887,23 +904,13 @@ sleep_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
     pcintr_coroutine_t crtn;
     if (call_flags & PCVRT_CALL_FLAG_AGAIN) {
         crtn = pcintr_get_coroutine();
-        PC_ASSERT(call_flags & PCVRT_CALL_FLAG_TIMEOUT);
         PC_ASSERT(crtn);
 
-        // TODO: get the remaining time from crtn and return it
-        ld_rem = 0;
-
-        if (arg_type == PURC_VARIANT_TYPE_LONGINT) {
-            return purc_variant_make_ulongint((int64_t)ld_rem);
-        }
-        else if (arg_type == PURC_VARIANT_TYPE_ULONGINT) {
-            return purc_variant_make_ulongint((uint64_t)ld_rem);
-        }
-        else if (arg_type == PURC_VARIANT_TYPE_ULONGINT) {
-            return purc_variant_make_number((double)ld_rem);
-        }
-
-        return purc_variant_make_longdouble(ld_rem);
+        /* not zero if an observed event resumed the coroutine before the
+           deadline */
+        uint64_t ns = pcintr_coroutine_remaining_time(crtn);
+        ld_rem = ns / 1000000000 + (ns % 1000000000) / 1000000000.0L;
+        return make_remaining_time(arg_type, ld_rem);
     }
 
     uint64_t ul_sec = 0;
@@ -981,20 +988,10 @@ sleep_getter(purc_variant_t root, size_t nr_args, purc_variant_t *argv,
             }
         }
 
-        if (arg_type == PURC_VARIANT_TYPE_LONGINT) {
-            return purc_variant_make_ulongint((int64_t)ld_rem);
-        }
-        else if (arg_type == PURC_VARIANT_TYPE_ULONGINT) {
-            return purc_variant_make_ulongint((uint64_t)ld_rem);
-        }
-        else if (arg_type == PURC_VARIANT_TYPE_ULONGINT) {
-            return purc_variant_make_number((double)ld_rem);
-        }
-
-        return purc_variant_make_longdouble(ld_rem);
+        return make_remaining_time(arg_type, ld_rem);
     }
     else {
-        pcintr_stop_coroutine(crtn, &req);
+        pcintr_sleep_coroutine(crtn, &req);
         purc_set_error(PURC_ERROR_AGAIN);
         return PURC_VARIANT_INVALID;
     }
@@ -0,0 +1,738 @@
+/*
+ * @file timezone.c
+ * @brief The cache of the timezone rules loaded from zoneinfo files.
+ *
+ * Copyright (C) 2026 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// #undef NDEBUG
+
+#include "config.h"
+
+#include "purc-ports.h"
+#include "private/dvobjs.h"
+#include "private/map.h"
+#include "private/debug.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+
+/*
+ * The conversions between UTC and the local time of a named timezone
+ * used to set TZ temporarily and call tzset(), which re-reads the zoneinfo
+ * file and changes the process-global state of libc. Here we parse the
+ * zoneinfo file (TZif, see RFC 8536) once, keep the rules in a process-wide
+ * cache, and do the conversions with the rules directly.
+ *
+ * The cached rules are immutable and live until the process exits, so the
+ * callers can use them without holding any lock. A name which cannot be
+ * loaded is cached too, as an entry without any local time type, so that
+ * a bad name does not cost a file lookup on every call.
+ */
+
+#define TZIF_HEADER_SIZE        44
+#define TZIF_MAX_FILE_SIZE      (256 * 1024)
+#define TZ_MAX_ABBR             16
+/* the names failed to load are not cached after reaching this limit */
+#define TZ_MAX_BAD_NAMES        256
+
+/* the default time of a transition defined by a POSIX TZ rule: 02:00:00 */
+#define TZ_RULE_DEF_TIME        7200
+
+struct tz_type {
+    int32_t         utoff;
+    bool            isdst;
+    uint8_t         abbr_idx;
+};
+
+/* a date in a POSIX TZ rule: Jn, n, or Mm.w.d */
+struct tz_rule_date {
+    char            kind;
+    int             n, m, w, d;
+    int32_t         time;
+};
+
+/* the POSIX TZ rule for the times after the last transition */
+struct tz_rule {
+    int32_t         std_off;
+    int32_t         dst_off;
+    char            std_abbr[TZ_MAX_ABBR];
+    char            dst_abbr[TZ_MAX_ABBR];
+    bool            has_dst;
+
+    struct tz_rule_date start;
+    struct tz_rule_date end;
+};
+
+struct pcdvobjs_tzinfo {
+    char               *name;
+
+    size_t              nr_trans;
+    int64_t            *trans;
+    uint8_t            *trans_types;
+
+    size_t              nr_types;
+    struct tz_type     *types;
+
+    char               *abbrs;
+    size_t              sz_abbrs;
+
+    bool                has_rule;
+    struct tz_rule      rule;
+};
+
+/* the local time type in effect at a time */
+struct tz_local {
+    int32_t             utoff;
+    bool                isdst;
+    const char         *abbr;
+};
+
+static purc_rwlock      tz_lock;
+static pcutils_map     *tz_cache;
+static size_t           nr_bad_names;
+
+static uint32_t get_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+        ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static int64_t get_be64(const uint8_t *p)
+{
+    return (int64_t)(((uint64_t)get_be32(p) << 32) | get_be32(p + 4));
+}
+
+static void tzinfo_destroy(struct pcdvobjs_tzinfo *tzi)
+{
+    free(tzi->name);
+    free(tzi->trans);
+    free(tzi->trans_types);
+    free(tzi->types);
+    free(tzi->abbrs);
+    free(tzi);
+}
+
+static int64_t floor_div(int64_t a, int64_t b)
+{
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+static bool is_leap_year(int64_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static int days_in_month(int64_t year, int month)
+{
+    static const int mdays[] = {
+        31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+    };
+
+    if (month == 2 && is_leap_year(year))
+        return 29;
+    return mdays[month - 1];
+}
+
+/* the days since 1970-01-01 of a date in the proleptic Gregorian calendar */
+static int64_t days_from_civil(int64_t year, int month, int mday)
+{
+    year -= (month <= 2);
+    int64_t era = floor_div(year, 400);
+    int64_t yoe = year - era * 400;
+    int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + mday - 1;
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static int64_t year_of_time(int64_t t)
+{
+    time_t tt = (time_t)t;
+    struct tm tm;
+
+    if (gmtime_r(&tt, &tm) == NULL)
+        return 1970;
+    return tm.tm_year + 1900LL;
+}
+
+static const char *parse_abbr(const char *s, char *buf)
+{
+    const char *start;
+    size_t len;
+
+    if (*s == '<') {
+        start = ++s;
+        while (*s && *s != '>')
+            s++;
+        if (*s != '>')
+            return NULL;
+        len = s - start;
+        s++;
+    }
+    else {
+        start = s;
+        while (isalpha((unsigned char)*s))
+            s++;
+        len = s - start;
+    }
+
+    if (len < 3 || len >= TZ_MAX_ABBR)
+        return NULL;
+
+    memcpy(buf, start, len);
+    buf[len] = '\0';
+    return s;
+}
+
+static const char *parse_number(const char *s, int max, int *n)
+{
+    if (!isdigit((unsigned char)*s))
+        return NULL;
+
+    int v = 0;
+    while (isdigit((unsigned char)*s)) {
+        v = v * 10 + (*s - '0');
+        if (v > max)
+            return NULL;
+        s++;
+    }
+
+    *n = v;
+    return s;
+}
+
+/* [+|-]hh[:mm[:ss]]; the hours may be up to 167 in a transition time */
+static const char *parse_hms(const char *s, int32_t *secs)
+{
+    int sign = 1, h, m = 0, sec = 0;
+
+    if (*s == '+' || *s == '-') {
+        if (*s == '-')
+            sign = -1;
+        s++;
+    }
+
+    if ((s = parse_number(s, 167, &h)) == NULL)
+        return NULL;
+    if (*s == ':') {
+        if ((s = parse_number(s + 1, 59, &m)) == NULL)
+            return NULL;
+        if (*s == ':') {
+            if ((s = parse_number(s + 1, 59, &sec)) == NULL)
+                return NULL;
+        }
+    }
+
+    *secs = sign * (h * 3600 + m * 60 + sec);
+    return s;
+}
+
+static const char *parse_rule_date(const char *s, struct tz_rule_date *date)
+{
+    if (*s == 'J') {
+        date->kind = 'J';
+        if ((s = parse_number(s + 1, 365, &date->n)) == NULL || date->n < 1)
+            return NULL;
+    }
+    else if (*s == 'M') {
+        date->kind = 'M';
+        if ((s = parse_number(s + 1, 12, &date->m)) == NULL || date->m < 1
+                || *s != '.')
+            return NULL;
+        if ((s = parse_number(s + 1, 5, &date->w)) == NULL || date->w < 1
+                || *s != '.')
+            return NULL;
+        if ((s = parse_number(s + 1, 6, &date->d)) == NULL)
+            return NULL;
+    }
+    else {
+        date->kind = 'D';
+        if ((s = parse_number(s, 365, &date->n)) == NULL)
+            return NULL;
+    }
+
+    date->time = TZ_RULE_DEF_TIME;
+    if (*s == '/') {
+        s = parse_hms(s + 1, &date->time);
+    }
+
+    return s;
+}
+
+/* std offset [dst [offset] [,start[/time],end[/time]]] */
+static bool parse_posix_tz(const char *s, struct tz_rule *rule)
+{
+    int32_t off;
+
+    if ((s = parse_abbr(s, rule->std_abbr)) == NULL)
+        return false;
+    if ((s = parse_hms(s, &off)) == NULL)
+        return false;
+    /* the offset in a POSIX TZ string is west of UTC */
+    rule->std_off = -off;
+    rule->dst_off = rule->std_off;
+    rule->has_dst = false;
+
+    if (*s == '\0')
+        return true;
+
+    if ((s = parse_abbr(s, rule->dst_abbr)) == NULL)
+        return false;
+    rule->dst_off = rule->std_off + 3600;
+    if (*s && *s != ',') {
+        if ((s = parse_hms(s, &off)) == NULL)
+            return false;
+        rule->dst_off = -off;
+    }
+
+    /* the footer of a zoneinfo file always gives the rule if any DST */
+    if (*s != ',')
+        return false;
+    if ((s = parse_rule_date(s + 1, &rule->start)) == NULL || *s != ',')
+        return false;
+    if ((s = parse_rule_date(s + 1, &rule->end)) == NULL || *s != '\0')
+        return false;
+
+    rule->has_dst = true;
+    return true;
+}
+
+static size_t tzif_data_size(const uint8_t *header, size_t time_size)
+{
+    size_t isutcnt = get_be32(header + 20);
+    size_t isstdcnt = get_be32(header + 24);
+    size_t leapcnt = get_be32(header + 28);
+    size_t timecnt = get_be32(header + 32);
+    size_t typecnt = get_be32(header + 36);
+    size_t charcnt = get_be32(header + 40);
+
+    return timecnt * time_size + timecnt + typecnt * 6 + charcnt +
+        leapcnt * (time_size + 4) + isstdcnt + isutcnt;
+}
+
+static bool parse_tzif(struct pcdvobjs_tzinfo *tzi,
+        const uint8_t *data, size_t len)
+{
+    const uint8_t *end = data + len;
+    const uint8_t *p = data;
+    size_t time_size = 4;
+
+    if (len < TZIF_HEADER_SIZE || memcmp(p, "TZif", 4))
+        return false;
+
+    if (p[4] >= '2') {
+        /* skip the version 1 data block; use the 64-bit one */
+        size_t sz = tzif_data_size(p, 4);
+        if (sz > len - TZIF_HEADER_SIZE)
+            return false;
+
+        p += TZIF_HEADER_SIZE + sz;
+        if ((size_t)(end - p) < TZIF_HEADER_SIZE || memcmp(p, "TZif", 4))
+            return false;
+        time_size = 8;
+    }
+
+    size_t timecnt = get_be32(p + 32);
+    size_t typecnt = get_be32(p + 36);
+    size_t charcnt = get_be32(p + 40);
+    if (typecnt == 0 || typecnt > 256 || charcnt == 0)
+        return false;
+
+    size_t sz = tzif_data_size(p, time_size);
+    p += TZIF_HEADER_SIZE;
+    if (sz > (size_t)(end - p))
+        return false;
+    const uint8_t *footer = p + sz;
+
+    tzi->nr_trans = timecnt;
+    tzi->nr_types = typecnt;
+    tzi->sz_abbrs = charcnt;
+    tzi->trans = malloc(sizeof(int64_t) * (timecnt ? timecnt : 1));
+    tzi->trans_types = malloc(timecnt ? timecnt : 1);
+    tzi->types = malloc(sizeof(struct tz_type) * typecnt);
+    tzi->abbrs = malloc(charcnt + 1);
+    if (!tzi->trans || !tzi->trans_types || !tzi->types || !tzi->abbrs)
+        return false;
+
+    for (size_t i = 0; i < timecnt; i++) {
+        tzi->trans[i] = (time_size == 8) ? get_be64(p) :
+            (int64_t)(int32_t)get_be32(p);
+        p += time_size;
+    }
+
+    for (size_t i = 0; i < timecnt; i++) {
+        if (p[i] >= typecnt)
+            return false;
+        tzi->trans_types[i] = p[i];
+    }
+    p += timecnt;
+
+    for (size_t i = 0; i < typecnt; i++) {
+        tzi->types[i].utoff = (int32_t)get_be32(p);
+        tzi->types[i].isdst = p[4] != 0;
+        tzi->types[i].abbr_idx = p[5];
+        if (p[5] >= charcnt)
+            return false;
+        p += 6;
+    }
+
+    memcpy(tzi->abbrs, p, charcnt);
+    tzi->abbrs[charcnt] = '\0';
+
+    /* the footer: a POSIX TZ string between two newlines */
+    tzi->has_rule = false;
+    if (time_size == 8) {
+        if (footer < end && *footer == '\n') {
+            const uint8_t *nl = memchr(footer + 1, '\n', end - footer - 1);
+            if (nl && nl > footer + 1 && nl - footer < 64) {
+                char tz[64];
+                memcpy(tz, footer + 1, nl - footer - 1);
+                tz[nl - footer - 1] = '\0';
+                tzi->has_rule = parse_posix_tz(tz, &tzi->rule);
+            }
+        }
+    }
+
+    return true;
+}
+
+/* on failure, set *bad if loading the timezone again would fail too,
+   i.e., the failure is not caused by the lack of memory or descriptors */
+static struct pcdvobjs_tzinfo *tzinfo_load(const char *timezone, bool *bad)
+{
+    struct pcdvobjs_tzinfo *tzi = NULL;
+    uint8_t *data = NULL;
+    FILE *fp = NULL;
+    char path[PATH_MAX + 1];
+
+    *bad = true;
+
+    /* the name must be a path relative to the zoneinfo directory */
+    if (timezone[0] == '/' || strstr(timezone, "..") ||
+            strlen(timezone) >= PATH_MAX - sizeof(PURC_SYS_TZ_DIR))
+        goto failed;
+
+    strcpy(path, PURC_SYS_TZ_DIR);
+    strcat(path, timezone);
+    if ((fp = fopen(path, "rb")) == NULL) {
+        if (errno == ENOMEM || errno == EMFILE || errno == ENFILE)
+            *bad = false;
+        goto failed;
+    }
+
+    data = malloc(TZIF_MAX_FILE_SIZE);
+    tzi = calloc(1, sizeof(*tzi));
+    if (data == NULL || tzi == NULL || (tzi->name = strdup(timezone)) == NULL) {
+        *bad = false;
+        goto failed;
+    }
+
+    size_t len = fread(data, 1, TZIF_MAX_FILE_SIZE, fp);
+    if (len == 0 || len == TZIF_MAX_FILE_SIZE)
+        goto failed;
+
+    if (!parse_tzif(tzi, data, len)) {
+        PC_WARN("Bad zoneinfo file: %s\n", path);
+        goto failed;
+    }
+
+    free(data);
+    fclose(fp);
+    return tzi;
+
+failed:
+    if (tzi)
+        tzinfo_destroy(tzi);
+    if (data)
+        free(data);
+    if (fp)
+        fclose(fp);
+    return NULL;
+}
+
+/* the seconds since the start of the year of the date in a rule */
+static int64_t rule_date_secs(const struct tz_rule_date *date, int64_t year)
+{
+    int64_t yday;
+
+    switch (date->kind) {
+    case 'J':
+        /* 1 <= n <= 365; February 29 is never counted */
+        yday = date->n - 1;
+        if (is_leap_year(year) && date->n >= 60)
+            yday++;
+        break;
+
+    case 'D':
+        yday = date->n;
+        break;
+
+    default: {
+        /* the d'th day (0 is Sunday) of the week w (5 is the last) */
+        int64_t first = days_from_civil(year, date->m, 1);
+        int wday = (int)(((first + 4) % 7 + 7) % 7);
+        int mday = 1 + (date->d - wday + 7) % 7 + (date->w - 1) * 7;
+        int mdays = days_in_month(year, date->m);
+        while (mday > mdays)
+            mday -= 7;
+        yday = first + mday - 1 - days_from_civil(year, 1, 1);
+        break;
+    }
+    }
+
+    return yday * 86400 + date->time;
+}
+
+static void rule_lookup(const struct tz_rule *rule, int64_t t,
+        struct tz_local *lt)
+{
+    bool isdst = false;
+
+    if (rule->has_dst) {
+        int64_t year = year_of_time(t + rule->std_off);
+        int64_t year_start = days_from_civil(year, 1, 1) * 86400;
+
+        /* the start time is in the standard time, and the end time is
+           in the daylight saving time */
+        int64_t start = year_start + rule_date_secs(&rule->start, year) -
+            rule->std_off;
+        int64_t end = year_start + rule_date_secs(&rule->end, year) -
+            rule->dst_off;
+
+        if (start < end)
+            isdst = (t >= start && t < end);
+        else    /* the southern hemisphere */
+            isdst = !(t >= end && t < start);
+    }
+
+    lt->isdst = isdst;
+    lt->utoff = isdst ? rule->dst_off : rule->std_off;
+    lt->abbr = isdst ? rule->dst_abbr : rule->std_abbr;
+}
+
+static void type_lookup(const struct pcdvobjs_tzinfo *tzi, size_t idx,
+        struct tz_local *lt)
+{
+    const struct tz_type *type = tzi->types + idx;
+
+    lt->utoff = type->utoff;
+    lt->isdst = type->isdst;
+    lt->abbr = tzi->abbrs + type->abbr_idx;
+}
+
+static void tz_lookup(const struct pcdvobjs_tzinfo *tzi, int64_t t,
+        struct tz_local *lt)
+{
+    size_t nr = tzi->nr_trans;
+
+    if (nr == 0 || t >= tzi->trans[nr - 1]) {
+        if (tzi->has_rule)
+            rule_lookup(&tzi->rule, t, lt);
+        else
+            type_lookup(tzi, nr ? tzi->trans_types[nr - 1] : 0, lt);
+        return;
+    }
+
+    if (t < tzi->trans[0]) {
+        type_lookup(tzi, 0, lt);
+        return;
+    }
+
+    /* the last transition not after t */
+    size_t low = 0, high = nr - 1;
+    while (high - low > 1) {
+        size_t mid = low + (high - low) / 2;
+        if (tzi->trans[mid] <= t)
+            low = mid;
+        else
+            high = mid;
+    }
+
+    type_lookup(tzi, tzi->trans_types[low], lt);
+}
+
+const struct pcdvobjs_tzinfo *
+pcdvobjs_get_tzinfo(const char *timezone)
+{
+    struct pcdvobjs_tzinfo *tzi = NULL;
+
+    if (tz_cache == NULL)
+        return NULL;
+
+    purc_rwlock_reader_lock(&tz_lock);
+    pcutils_map_entry *entry = pcutils_map_find(tz_cache, timezone);
+    if (entry)
+        tzi = entry->val;
+    purc_rwlock_reader_unlock(&tz_lock);
+
+    if (tzi)
+        return tzi->nr_types ? tzi : NULL;
+
+    /* load the zoneinfo file without holding the lock */
+    bool bad;
+    if ((tzi = tzinfo_load(timezone, &bad)) == NULL) {
+        if (!bad)
+            return NULL;
+
+        /* remember the failure with an entry having no local time type */
+        tzi = calloc(1, sizeof(*tzi));
+        if (tzi == NULL)
+            return NULL;
+        if ((tzi->name = strdup(timezone)) == NULL) {
+            free(tzi);
+            return NULL;
+        }
+    }
+
+    purc_rwlock_writer_lock(&tz_lock);
+    entry = pcutils_map_find(tz_cache, timezone);
+    if (entry) {
+        /* another thread won */
+        tzinfo_destroy(tzi);
+        tzi = entry->val;
+    }
+    else if ((tzi->nr_types == 0 && nr_bad_names >= TZ_MAX_BAD_NAMES) ||
+            pcutils_map_insert(tz_cache, tzi->name, tzi)) {
+        tzinfo_destroy(tzi);
+        tzi = NULL;
+    }
+    else if (tzi->nr_types == 0) {
+        nr_bad_names++;
+    }
+    purc_rwlock_writer_unlock(&tz_lock);
+
+    return (tzi && tzi->nr_types) ? tzi : NULL;
+}
+
+void
+pcdvobjs_tzinfo_localtime(const struct pcdvobjs_tzinfo *tzi, time_t t,
+        struct tm *tm)
+{
+    struct tz_local lt;
+    tz_lookup(tzi, t, &lt);
+
+    time_t local = t + lt.utoff;
+    gmtime_r(&local, tm);
+    tm->tm_isdst = lt.isdst;
+    tm->tm_gmtoff = lt.utoff;
+    tm->tm_zone = (char *)lt.abbr;
+}
+
+time_t
+pcdvobjs_tzinfo_mktime(const struct pcdvobjs_tzinfo *tzi, struct tm *tm)
+{
+    /* the local time as if it were UTC; the fields may be out of range */
+    int64_t year = tm->tm_year + 1900LL + floor_div(tm->tm_mon, 12);
+    int month = (int)(tm->tm_mon - floor_div(tm->tm_mon, 12) * 12) + 1;
+    int64_t local = (days_from_civil(year, month, 1) + tm->tm_mday - 1) *
+        86400 + tm->tm_hour * 3600LL + tm->tm_min * 60LL + tm->tm_sec;
+
+    struct tz_local lt, at;
+    tz_lookup(tzi, local, &lt);
+    int64_t t = local - lt.utoff;
+    tz_lookup(tzi, t, &lt);
+    t = local - lt.utoff;
+
+    tz_lookup(tzi, t, &at);
+    if (at.utoff != lt.utoff) {
+        /* the local time is skipped by a transition; like mktime(3), take
+           it in the type before the transition, which is in effect at the
+           earlier one of the two candidates */
+        int64_t other = local - at.utoff;
+        if (other > t) {
+            lt = at;
+            t = other;
+        }
+    }
+
+    /* respect the DST hint like mktime(3) does: use the offset of the
+       nearest time (within about a year and a half) whose DST flag
+       matches the hint */
+    if (tm->tm_isdst >= 0 && lt.isdst != (tm->tm_isdst > 0)) {
+        for (int64_t delta = 43200; delta <= 536 * 86400LL; delta += 43200) {
+            struct tz_local alt;
+            tz_lookup(tzi, t - delta, &alt);
+            if (alt.isdst == (tm->tm_isdst > 0)) {
+                t = local - alt.utoff;
+                break;
+            }
+            tz_lookup(tzi, t + delta, &alt);
+            if (alt.isdst == (tm->tm_isdst > 0)) {
+                t = local - alt.utoff;
+                break;
+            }
+        }
+    }
+
+    pcdvobjs_tzinfo_localtime(tzi, (time_t)t, tm);
+    return (time_t)t;
+}
+
+static int free_tzinfo(void *key, void *val, void *ud)
+{
+    UNUSED_PARAM(key);
+    UNUSED_PARAM(ud);
+    tzinfo_destroy((struct pcdvobjs_tzinfo *)val);
+    return 0;
+}
+
+static void tz_cleanup_once(void)
+{
+    if (tz_cache) {
+        pcutils_map_traverse(tz_cache, NULL, free_tzinfo);
+        pcutils_map_destroy(tz_cache);
+        tz_cache = NULL;
+    }
+
+    if (tz_lock.native_impl) {
+        purc_rwlock_clear(&tz_lock);
+        tz_lock.native_impl = NULL;
+    }
+}
+
+int
+pcdvobjs_tzinfo_init_once(void)
+{
+    purc_rwlock_init(&tz_lock);
+    if (tz_lock.native_impl == NULL)
+        goto fail_lock;
+
+    tz_cache = pcutils_map_create(NULL, NULL, NULL, NULL,
+            comp_key_string, false);
+    if (tz_cache == NULL)
+        goto fail_map;
+
+    if (atexit(tz_cleanup_once))
+        goto fail_atexit;
+
+    return 0;
+
+fail_atexit:
+    pcutils_map_destroy(tz_cache);
+    tz_cache = NULL;
+
+fail_map:
+    purc_rwlock_clear(&tz_lock);
+    tz_lock.native_impl = NULL;
+
+fail_lock:
+    return -1;
+}
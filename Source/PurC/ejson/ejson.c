@@ -25,6 +25,7 @@
 #include "private/ejson.h"
 #include "private/errors.h"
 #include "private/instance.h"
+#include "private/vcm.h"
 
 #include "purc-utils.h"
 #include "purc-errors.h"
@@ -61,7 +62,7 @@ static struct err_msg_seg _ejson_err_msgs_seg = {
 static int ejson_init_once (void)
 {
     pcinst_register_error_message_segment(&_ejson_err_msgs_seg);
-    return 0;
+    return pcvcm_eval_init_once();
 }
 
 struct pcmodule _module_ejson = {
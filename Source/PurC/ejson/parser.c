@@ -417,6 +417,8 @@ void pcejson_destroy(struct pcejson *parser)
         pcejson_token_stack_destroy(parser->tkz_stack);
         tkz_sbst_destroy(parser->sbst);
         tkz_buffer_destroy(parser->raw_buffer);
+        tkz_reader_destroy(parser->chunk_reader);
+        pcvcm_node_destroy(parser->chunk_tree);
         pc_free(parser);
     }
 }
@@ -465,6 +467,70 @@ out:
     return ret;
 }
 
+struct pcejson *pcejson_parse_chunk_begin(uint32_t depth)
+{
+    struct pcejson *parser = pcejson_create(
+            depth > 0 ? depth : EJSON_MAX_DEPTH, PCEJSON_FLAG_ALL);
+    if (parser == NULL) {
+        return NULL;
+    }
+
+    parser->chunk_reader = tkz_reader_new();
+    if (parser->chunk_reader == NULL) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        pcejson_destroy(parser);
+        return NULL;
+    }
+
+    return parser;
+}
+
+/* Runs the tokenizer until it finishes or consumes all the bytes fed.
+   The tokenizer resumes from the saved state the next time. */
+static int parse_fed_chunks(struct pcejson *parser)
+{
+    struct pcejson *p = parser;
+    int ret = pcejson_parse_full(&parser->chunk_tree, &p,
+            parser->chunk_reader, 0, is_finished_default);
+    if (ret != 0 && tkz_reader_is_starved(parser->chunk_reader)) {
+        return 0;
+    }
+
+    parser->chunk_done = true;
+    parser->chunk_ret = ret;
+    return ret;
+}
+
+int pcejson_parse_chunk(struct pcejson *parser, const char *data, size_t sz)
+{
+    if (parser->chunk_done) {
+        return parser->chunk_ret;
+    }
+
+    if (!tkz_reader_feed(parser->chunk_reader, data, sz)) {
+        parser->chunk_done = true;
+        parser->chunk_ret = -1;
+        return -1;
+    }
+
+    return parse_fed_chunks(parser);
+}
+
+int pcejson_parse_chunk_end(struct pcejson *parser,
+        struct pcvcm_node **vcm_tree)
+{
+    if (!parser->chunk_done) {
+        tkz_reader_feed_end(parser->chunk_reader);
+        parse_fed_chunks(parser);
+    }
+
+    if (parser->chunk_ret == 0) {
+        *vcm_tree = parser->chunk_tree;
+        parser->chunk_tree = NULL;
+    }
+    return parser->chunk_ret;
+}
+
 int pcejson_set_state(struct pcejson *parser, int state)
 {
     if (parser) {
@@ -60,6 +60,14 @@ struct tkz_reader {
     int line;
     int column;
     int consumed;
+
+    /* the bytes fed by tkz_reader_feed() and not decoded yet */
+    char *fed;
+    size_t sz_fed;
+    size_t nr_fed;
+    size_t pos_fed;
+    bool fed_ended;
+    bool starved;
 };
 
 
@@ -123,14 +131,8 @@ void tkz_reader_set_rwstream(struct tkz_reader *reader,
 }
 
 static struct tkz_uc*
-tkz_reader_read_from_rwstream(struct tkz_reader *reader)
+tkz_reader_set_curr_char(struct tkz_reader *reader, uint32_t uc)
 {
-    char c[8] = {0};
-    uint32_t uc = 0;
-    int nr_c = purc_rwstream_read_utf8_char(reader->rws, c, &uc);
-    if (nr_c < 0) {
-        uc = TKZ_INVALID_CHARACTER;
-    }
     reader->column++;
     reader->consumed++;
 
@@ -145,6 +147,105 @@ tkz_reader_read_from_rwstream(struct tkz_reader *reader)
     return &reader->curr_uc;
 }
 
+static struct tkz_uc*
+tkz_reader_read_from_rwstream(struct tkz_reader *reader)
+{
+    char c[8] = {0};
+    uint32_t uc = 0;
+    int nr_c = purc_rwstream_read_utf8_char(reader->rws, c, &uc);
+    if (nr_c < 0) {
+        uc = TKZ_INVALID_CHARACTER;
+    }
+    return tkz_reader_set_curr_char(reader, uc);
+}
+
+/* Returns NULL and marks the reader starved if the fed bytes do not
+   hold a whole character and more bytes are to come. */
+static struct tkz_uc*
+tkz_reader_read_from_fed(struct tkz_reader *reader)
+{
+    const unsigned char *p = (const unsigned char *)reader->fed +
+        reader->pos_fed;
+    size_t left = reader->nr_fed - reader->pos_fed;
+    uint32_t uc;
+
+    if (left == 0) {
+        if (!reader->fed_ended) {
+            reader->starved = true;
+            return NULL;
+        }
+        uc = TKZ_END_OF_FILE;
+    }
+    else if (p[0] < 0x80) {
+        uc = p[0];
+        reader->pos_fed++;
+    }
+    else if (p[0] < 0xC0 || p[0] > 0xFD) {
+        uc = TKZ_INVALID_CHARACTER;
+        reader->pos_fed++;
+    }
+    else {
+        size_t len = (size_t)(unsigned char)_pcutils_utf8_skip[p[0]];
+        if (len > left) {
+            if (!reader->fed_ended) {
+                reader->starved = true;
+                return NULL;
+            }
+            uc = TKZ_INVALID_CHARACTER;
+            reader->pos_fed = reader->nr_fed;
+        }
+        else {
+            uc = pcutils_utf8_to_unichar(p);
+            for (size_t i = 1; i < len; i++) {
+                if ((p[i] & 0xC0) != 0x80) {
+                    uc = TKZ_INVALID_CHARACTER;
+                    break;
+                }
+            }
+            reader->pos_fed += len;
+        }
+    }
+
+    return tkz_reader_set_curr_char(reader, uc);
+}
+
+bool tkz_reader_feed(struct tkz_reader *reader, const char *data, size_t sz)
+{
+    /* drop the bytes decoded already */
+    if (reader->pos_fed > 0) {
+        reader->nr_fed -= reader->pos_fed;
+        memmove(reader->fed, reader->fed + reader->pos_fed, reader->nr_fed);
+        reader->pos_fed = 0;
+    }
+
+    if (reader->nr_fed + sz > reader->sz_fed) {
+        size_t sz_fed = pcutils_get_next_fibonacci_number(reader->nr_fed + sz);
+        char *fed = realloc(reader->fed, sz_fed);
+        if (fed == NULL) {
+            pcinst_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            return false;
+        }
+        reader->fed = fed;
+        reader->sz_fed = sz_fed;
+    }
+
+    memcpy(reader->fed + reader->nr_fed, data, sz);
+    reader->nr_fed += sz;
+    reader->starved = false;
+    return true;
+}
+
+void tkz_reader_feed_end(struct tkz_reader *reader)
+{
+    reader->fed_ended = true;
+    reader->starved = false;
+}
+
+bool tkz_reader_is_starved(struct tkz_reader *reader)
+{
+    return reader->starved;
+}
+
 static struct tkz_uc*
 tkz_reader_read_from_reconsume_list(struct tkz_reader *reader)
 {
@@ -214,11 +315,17 @@ bool tkz_reader_reconsume_last_char(struct tkz_reader *reader)
 struct tkz_uc *tkz_reader_next_char(struct tkz_reader *reader)
 {
     struct tkz_uc *ret = NULL;
-    if (list_empty(&reader->reconsume_list)) {
+    if (!list_empty(&reader->reconsume_list)) {
+        ret = tkz_reader_read_from_reconsume_list(reader);
+    }
+    else if (reader->rws) {
         ret = tkz_reader_read_from_rwstream(reader);
     }
     else {
-        ret = tkz_reader_read_from_reconsume_list(reader);
+        ret = tkz_reader_read_from_fed(reader);
+        if (ret == NULL) {
+            return NULL;
+        }
     }
 
     if (tkz_reader_add_consumed(reader, ret)) {
@@ -241,6 +348,7 @@ void tkz_reader_destroy(struct tkz_reader *reader)
             list_del_init(&puc->list);
             tkz_uc_destroy(puc);
         }
+        free(reader->fed);
         PCHVML_FREE(reader);
     }
 }
@@ -283,6 +283,12 @@ struct pcejson {
     uint32_t prev_separator;
     uint32_t nr_quoted;
     bool enable_log;
+
+    /* for the incremental parsing by pcejson_parse_chunk() */
+    struct tkz_reader *chunk_reader;
+    struct pcvcm_node *chunk_tree;
+    int chunk_ret;
+    bool chunk_done;
 };
 
 PCA_EXTERN_C_BEGIN
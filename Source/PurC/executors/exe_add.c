@@ -34,7 +34,7 @@
 struct pcexec_exe_add_inst {
     struct purc_exec_inst       super;
 
-    struct exe_add_param        param;
+    struct exe_add_param       *param;
 
     double                      curr;
 };
@@ -43,8 +43,8 @@ struct pcexec_exe_add_inst {
 static inline void
 reset(struct pcexec_exe_add_inst *exe_add_inst)
 {
-    struct exe_add_param *param = &exe_add_inst->param;
-    exe_add_param_reset(param);
+    /* the parameters are owned by the parsed rule cache */
+    exe_add_inst->param = NULL;
     pcexecutor_inst_reset(&exe_add_inst->super);
 }
 
@@ -54,20 +54,11 @@ parse_rule(struct pcexec_exe_add_inst *exe_add_inst,
 {
     purc_exec_inst_t inst = &exe_add_inst->super;
 
-    struct exe_add_param param = {0};
-    int r = exe_add_parse(rule, strlen(rule), &param);
-    if (inst->err_msg) {
-        free(inst->err_msg);
-        inst->err_msg = NULL;
-    }
-
-    if (r) {
-        inst->err_msg = param.err_msg;
-        param.err_msg = NULL;
+    struct exe_add_param *param;
+    param = PCEXECUTOR_PARSE_RULE(inst, rule, exe_add);
+    if (param == NULL)
         return false;
-    }
 
-    exe_add_param_reset(&exe_add_inst->param);
     exe_add_inst->param = param;
 
     return true;
@@ -77,7 +68,7 @@ static inline bool
 check_curr(struct pcexec_exe_add_inst *exe_add_inst, const double curr)
 {
     purc_exec_inst_t inst = &exe_add_inst->super;
-    struct exe_add_param *param = &exe_add_inst->param;
+    struct exe_add_param *param = exe_add_inst->param;
     struct add_rule *rule = &param->rule;
     struct number_comparing_logical_expression *ncle = rule->ncle;
 
@@ -128,7 +119,7 @@ fetch_next(struct pcexec_exe_add_inst *exe_add_inst)
 {
     purc_exec_inst_t inst = &exe_add_inst->super;
     purc_exec_iter_t it = &inst->it;
-    struct exe_add_param *param = &exe_add_inst->param;
+    struct exe_add_param *param = exe_add_inst->param;
     struct add_rule *rule = &param->rule;
     double curr = exe_add_inst->curr;
     if (!isnan(rule->nexp)) {
@@ -37,7 +37,7 @@
 struct pcexec_exe_key_inst {
     struct purc_exec_inst       super;
 
-    struct exe_key_param        param;
+    struct exe_key_param       *param;
 
     purc_variant_t              result_set;
 };
@@ -46,8 +46,8 @@ struct pcexec_exe_key_inst {
 static inline void
 reset(struct pcexec_exe_key_inst *exe_key_inst)
 {
-    struct exe_key_param *param = &exe_key_inst->param;
-    exe_key_param_reset(param);
+    /* the parameters are owned by the parsed rule cache */
+    exe_key_inst->param = NULL;
     pcexecutor_inst_reset(&exe_key_inst->super);
     PCEXE_CLR_VAR(exe_key_inst->result_set);
 }
@@ -102,20 +102,11 @@ parse_rule(struct pcexec_exe_key_inst *exe_key_inst,
 {
     purc_exec_inst_t inst = &exe_key_inst->super;
 
-    struct exe_key_param param = {0};
-    int r = exe_key_parse(rule, strlen(rule), &param);
-    if (inst->err_msg) {
-        free(inst->err_msg);
-        inst->err_msg = NULL;
-    }
-
-    if (r) {
-        inst->err_msg = param.err_msg;
-        param.err_msg = NULL;
+    struct exe_key_param *param;
+    param = PCEXECUTOR_PARSE_RULE(inst, rule, exe_key);
+    if (param == NULL)
         return false;
-    }
 
-    exe_key_param_reset(&exe_key_inst->param);
     exe_key_inst->param = param;
 
     return prepare_result_set(exe_key_inst);
@@ -139,7 +130,7 @@ check_curr(struct pcexec_exe_key_inst *exe_key_inst)
 {
     purc_exec_inst_t inst = &exe_key_inst->super;
     purc_exec_iter_t it = &inst->it;
-    struct key_rule *rule = &exe_key_inst->param.rule;
+    struct key_rule *rule = &exe_key_inst->param->rule;
 
     int curr = (int)it->curr;
 
@@ -266,11 +257,6 @@ exe_key_create(enum purc_exec_type type,
     inst->type        = type;
     inst->asc_desc    = asc_desc;
 
-    int debug_flex, debug_bison;
-    pcexecutor_get_debug(&debug_flex, &debug_bison);
-    exe_key_inst->param.debug_flex  = debug_flex;
-    exe_key_inst->param.debug_bison = debug_bison;
-
     enum purc_variant_type vt = purc_variant_get_type(input);
     if (vt == PURC_VARIANT_TYPE_OBJECT) {
         inst->input = input;
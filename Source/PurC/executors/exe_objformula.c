@@ -35,7 +35,7 @@
 struct pcexec_exe_objformula_inst {
     struct purc_exec_inst       super;
 
-    struct exe_objformula_param        param;
+    struct exe_objformula_param       *param;
 
     purc_variant_t               curr;
 };
@@ -44,8 +44,8 @@ struct pcexec_exe_objformula_inst {
 static inline void
 reset(struct pcexec_exe_objformula_inst *exe_objformula_inst)
 {
-    struct exe_objformula_param *param = &exe_objformula_inst->param;
-    exe_objformula_param_reset(param);
+    /* the parameters are owned by the parsed rule cache */
+    exe_objformula_inst->param = NULL;
     pcexecutor_inst_reset(&exe_objformula_inst->super);
     PCEXE_CLR_VAR(exe_objformula_inst->curr);
 }
@@ -56,24 +56,14 @@ parse_rule(struct pcexec_exe_objformula_inst *exe_objformula_inst,
 {
     purc_exec_inst_t inst = &exe_objformula_inst->super;
 
-    struct exe_objformula_param param = {0};
-    int r = exe_objformula_parse(rule, strlen(rule), &param);
-    if (inst->err_msg) {
-        free(inst->err_msg);
-        inst->err_msg = NULL;
-    }
-
-    if (r) {
-        inst->err_msg = param.err_msg;
-        param.err_msg = NULL;
+    struct exe_objformula_param *param;
+    param = PCEXECUTOR_PARSE_RULE(inst, rule, exe_objformula);
+    if (param == NULL)
         return false;
-    }
 
-    exe_objformula_param_reset(&exe_objformula_inst->param);
     exe_objformula_inst->param = param;
 
-    PC_ASSERT(param.rule.vncle);
-    PC_ASSERT(exe_objformula_inst->param.rule.vncle);
+    PC_ASSERT(param->rule.vncle);
 
     return true;
 }
@@ -81,7 +71,7 @@ parse_rule(struct pcexec_exe_objformula_inst *exe_objformula_inst,
 static inline bool
 iterate(struct pcexec_exe_objformula_inst *exe_objformula_inst)
 {
-    struct exe_objformula_param *param = &exe_objformula_inst->param;
+    struct exe_objformula_param *param = exe_objformula_inst->param;
     struct objformula_rule *rule = &param->rule;
     purc_variant_t curr = exe_objformula_inst->curr;
 
@@ -122,7 +112,7 @@ static inline bool
 check_curr(struct pcexec_exe_objformula_inst *exe_objformula_inst)
 {
     purc_exec_inst_t inst = &exe_objformula_inst->super;
-    struct exe_objformula_param *param = &exe_objformula_inst->param;
+    struct exe_objformula_param *param = exe_objformula_inst->param;
     struct objformula_rule *rule = &param->rule;
     struct value_number_comparing_logical_expression *vncle = rule->vncle;
     purc_variant_t curr = exe_objformula_inst->curr;
@@ -260,11 +250,6 @@ exe_objformula_create(enum purc_exec_type type,
     inst->type        = type;
     inst->asc_desc    = asc_desc;
 
-    int debug_flex, debug_bison;
-    pcexecutor_get_debug(&debug_flex, &debug_bison);
-    exe_objformula_inst->param.debug_flex  = debug_flex;
-    exe_objformula_inst->param.debug_bison = debug_bison;
-
     enum purc_variant_type vt = purc_variant_get_type(input);
     if (vt == PURC_VARIANT_TYPE_OBJECT) {
         inst->input = input;
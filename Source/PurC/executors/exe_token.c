@@ -37,7 +37,7 @@
 struct pcexec_exe_token_inst {
     struct purc_exec_inst       super;
 
-    struct exe_token_param      param;
+    struct exe_token_param     *param;
 
     purc_variant_t              result_set;
 };
@@ -46,8 +46,8 @@ struct pcexec_exe_token_inst {
 static inline void
 reset(struct pcexec_exe_token_inst *exe_token_inst)
 {
-    struct exe_token_param *param = &exe_token_inst->param;
-    exe_token_param_reset(param);
+    /* the parameters are owned by the parsed rule cache */
+    exe_token_inst->param = NULL;
     pcexecutor_inst_reset(&exe_token_inst->super);
     PCEXE_CLR_VAR(exe_token_inst->result_set);
 }
@@ -115,7 +115,7 @@ static inline bool
 init_result_set(struct pcexec_exe_token_inst *exe_token_inst,
         purc_variant_t result_set)
 {
-    struct token_rule *rule = &exe_token_inst->param.rule;
+    struct token_rule *rule = &exe_token_inst->param->rule;
 
     const char *delimiters = " ";
     if (rule->delimiters && *rule->delimiters) {
@@ -163,20 +163,11 @@ parse_rule(struct pcexec_exe_token_inst *exe_token_inst,
 {
     purc_exec_inst_t inst = &exe_token_inst->super;
 
-    struct exe_token_param param = {0};
-    int r = exe_token_parse(rule, strlen(rule), &param);
-    if (inst->err_msg) {
-        free(inst->err_msg);
-        inst->err_msg = NULL;
-    }
-
-    if (r) {
-        inst->err_msg = param.err_msg;
-        param.err_msg = NULL;
+    struct exe_token_param *param;
+    param = PCEXECUTOR_PARSE_RULE(inst, rule, exe_token);
+    if (param == NULL)
         return false;
-    }
 
-    exe_token_param_reset(&exe_token_inst->param);
     exe_token_inst->param = param;
 
     return prepare_result_set(exe_token_inst);
@@ -199,7 +190,7 @@ check_curr(struct pcexec_exe_token_inst *exe_token_inst)
 {
     purc_exec_inst_t inst = &exe_token_inst->super;
     purc_exec_iter_t it = &inst->it;
-    struct token_rule *rule = &exe_token_inst->param.rule;
+    struct token_rule *rule = &exe_token_inst->param->rule;
 
     int curr = (int)it->curr;
 
@@ -261,7 +252,7 @@ fetch_begin(struct pcexec_exe_token_inst *exe_token_inst)
 {
     purc_exec_inst_t inst = &exe_token_inst->super;
     purc_exec_iter_t it = &inst->it;
-    struct token_rule *rule = &exe_token_inst->param.rule;
+    struct token_rule *rule = &exe_token_inst->param->rule;
     it->curr = rule->from;
     if (check_curr(exe_token_inst)) {
         return it;
@@ -274,7 +265,7 @@ fetch_next(struct pcexec_exe_token_inst *exe_token_inst)
 {
     purc_exec_inst_t inst = &exe_token_inst->super;
     purc_exec_iter_t it = &inst->it;
-    struct token_rule *rule = &exe_token_inst->param.rule;
+    struct token_rule *rule = &exe_token_inst->param->rule;
     if (isnan(rule->advance)) {
         it->curr += 1;
     } else {
@@ -324,11 +315,6 @@ exe_token_create(enum purc_exec_type type,
     inst->type        = type;
     inst->asc_desc    = asc_desc;
 
-    int debug_flex, debug_bison;
-    pcexecutor_get_debug(&debug_flex, &debug_bison);
-    exe_token_inst->param.debug_flex  = debug_flex;
-    exe_token_inst->param.debug_bison = debug_bison;
-
     enum purc_variant_type vt = purc_variant_get_type(input);
     if (vt == PURC_VARIANT_TYPE_STRING) {
         inst->input = input;
@@ -26,6 +26,7 @@
 #include "private/debug.h"
 #include "private/errors.h"
 #include "private/instance.h"
+#include "private/hashtable.h"
 #include "keywords.h"
 
 #include "purc-utils.h"
@@ -52,6 +53,19 @@
 
 #include <pthread.h>
 
+struct pcexec_parsed_rule {
+    struct list_head            ln;
+    unsigned long               hash;
+    size_t                      refc;
+    unsigned int                in_cache:1;
+
+    pcexec_parse_rule_f         parse;
+    pcexec_reset_param_f        reset;
+    char                       *rule;
+
+    void                       *param;
+};
+
 static int comp_pcexec_key(const void *key1, const void *key2)
 {
     purc_atom_t la = (purc_atom_t)(uint64_t)key1;
@@ -179,16 +193,20 @@ static int _init_instance(struct pcinst *inst,
 
     inst->executor_heap->debug_flex = 0;
     inst->executor_heap->debug_bison = 0;
+    list_head_init(&inst->executor_heap->rule_lru);
 
     PC_ASSERT(purc_get_last_error() == 0);
     return 0;
 }
 
+static void rule_cache_destroy(struct pcexecutor_heap *heap);
+
 static void _cleanup_instance(struct pcinst *inst)
 {
     if (!inst->executor_heap)
         return;
 
+    rule_cache_destroy(inst->executor_heap);
     free(inst->executor_heap);
     inst->executor_heap = NULL;
 }
@@ -365,15 +383,213 @@ int pcexecutor_get_by_rule(const char *rule, pcexec_ops_t ops)
     while (*t && !purc_isspace(*t) && *t != ':')
         ++t;
 
-    char *s = strndup(h, t-h);
-    PC_ASSERT(s);
+    char s[128];
+    if ((size_t)(t - h) >= sizeof(s)) {
+        purc_set_error_with_info(PCEXECUTOR_ERROR_BAD_ARG,
+                "unknown executor: %.*s", (int)(t - h), h);
+        return -1;
+    }
+    memcpy(s, h, t - h);
+    s[t - h] = '\0';
 
     bool ok = get_executor(s, ops);
-    free(s);
 
     return ok ? 0 : -1;
 }
 
+static unsigned long
+parsed_rule_hash(const void *k)
+{
+    const struct pcexec_parsed_rule *key = k;
+    return key->hash;
+}
+
+static int
+parsed_rule_equal(const void *k1, const void *k2)
+{
+    const struct pcexec_parsed_rule *a = k1;
+    const struct pcexec_parsed_rule *b = k2;
+
+    return a->hash == b->hash && a->parse == b->parse &&
+        strcmp(a->rule, b->rule) == 0;
+}
+
+static unsigned long
+make_rule_hash(pcexec_parse_rule_f parse, const char *rule)
+{
+    unsigned long h = pchash_perllike_str_hash(rule);
+    return h * 33 + (unsigned long)(uintptr_t)parse;
+}
+
+static void
+parsed_rule_release(struct pcexec_parsed_rule *parsed)
+{
+    if (parsed == NULL)
+        return;
+
+    PC_ASSERT(parsed->refc > 0);
+    if (--parsed->refc)
+        return;
+
+    parsed->reset(parsed->param);
+    free(parsed->param);
+    free(parsed->rule);
+    free(parsed);
+}
+
+static void
+rule_cache_evict(struct pcexecutor_heap *heap,
+        struct pcexec_parsed_rule *parsed)
+{
+    pchash_table_delete(heap->rule_table, parsed);
+    list_del(&parsed->ln);
+    parsed->in_cache = 0;
+    heap->nr_rules--;
+    parsed_rule_release(parsed);
+}
+
+static void
+rule_cache_destroy(struct pcexecutor_heap *heap)
+{
+    struct pcexec_parsed_rule *p, *n;
+
+    if (heap->rule_table == NULL)
+        return;
+
+    list_for_each_entry_safe(p, n, &heap->rule_lru, ln) {
+        rule_cache_evict(heap, p);
+    }
+
+    pchash_table_free(heap->rule_table);
+    heap->rule_table = NULL;
+}
+
+static struct pcexec_parsed_rule *
+parsed_rule_new(struct purc_exec_inst *inst, const char *rule,
+        pcexec_parse_rule_f parse, pcexec_reset_param_f reset,
+        size_t sz_param, size_t off_err_msg, unsigned long hash)
+{
+    struct pcexec_parsed_rule *parsed = calloc(1, sizeof(*parsed));
+    if (parsed == NULL)
+        goto oom;
+
+    parsed->param = calloc(1, sz_param);
+    parsed->rule = strdup(rule);
+    if (parsed->param == NULL || parsed->rule == NULL)
+        goto oom;
+
+    if (parse(rule, strlen(rule), parsed->param)) {
+        char **err_msg = (char **)((char *)parsed->param + off_err_msg);
+        inst->err_msg = *err_msg;
+        *err_msg = NULL;
+        reset(parsed->param);
+        goto failed;
+    }
+
+    parsed->hash = hash;
+    parsed->refc = 1;
+    parsed->parse = parse;
+    parsed->reset = reset;
+    list_head_init(&parsed->ln);
+    return parsed;
+
+oom:
+    pcinst_set_error(PCEXECUTOR_ERROR_OOM);
+failed:
+    if (parsed) {
+        free(parsed->param);
+        free(parsed->rule);
+        free(parsed);
+    }
+    return NULL;
+}
+
+static struct pcexec_parsed_rule *
+rule_cache_get(struct purc_exec_inst *inst, const char *rule,
+        pcexec_parse_rule_f parse, pcexec_reset_param_f reset,
+        size_t sz_param, size_t off_err_msg)
+{
+    struct pcinst *curr = pcinst_current();
+    struct pcexecutor_heap *heap = curr ? curr->executor_heap : NULL;
+    unsigned long hash = make_rule_hash(parse, rule);
+
+    if (heap && heap->rule_table == NULL) {
+        heap->rule_table = pchash_table_new(HASHTABLE_DEFAULT_SIZE, NULL,
+                parsed_rule_hash, parsed_rule_equal);
+    }
+
+    if (heap == NULL || heap->rule_table == NULL) {
+        /* no cache: hand out a private one which is freed on release */
+        return parsed_rule_new(inst, rule, parse, reset,
+                sz_param, off_err_msg, hash);
+    }
+
+    struct pcexec_parsed_rule key;
+    key.parse = parse;
+    key.rule = (char *)rule;
+    key.hash = hash;
+
+    struct pchash_entry *e;
+    e = pchash_table_lookup_entry_w_hash(heap->rule_table, &key, hash);
+    if (e) {
+        struct pcexec_parsed_rule *parsed = (struct pcexec_parsed_rule *)e->v;
+        list_move(&parsed->ln, &heap->rule_lru);
+        heap->nr_rule_hits++;
+        parsed->refc++;
+        return parsed;
+    }
+
+    heap->nr_rule_misses++;
+    struct pcexec_parsed_rule *parsed;
+    parsed = parsed_rule_new(inst, rule, parse, reset,
+            sz_param, off_err_msg, hash);
+    if (parsed == NULL)
+        return NULL;
+
+    if (pchash_table_insert_w_hash(heap->rule_table, parsed, parsed, hash,
+                PCHASH_OBJECT_KEY_IS_CONSTANT)) {
+        /* still usable, only not cached */
+        return parsed;
+    }
+
+    list_add(&parsed->ln, &heap->rule_lru);
+    parsed->in_cache = 1;
+    parsed->refc++;
+    heap->nr_rules++;
+
+    while (heap->nr_rules > PCEXECUTOR_RULE_CACHE_CAPACITY) {
+        struct pcexec_parsed_rule *last;
+        last = list_last_entry(&heap->rule_lru, struct pcexec_parsed_rule, ln);
+        rule_cache_evict(heap, last);
+        heap->nr_rule_evictions++;
+    }
+
+    return parsed;
+}
+
+void *
+pcexecutor_parse_rule(struct purc_exec_inst *inst, const char *rule,
+        pcexec_parse_rule_f parse, pcexec_reset_param_f reset,
+        size_t sz_param, size_t off_err_msg)
+{
+    if (inst->err_msg) {
+        free(inst->err_msg);
+        inst->err_msg = NULL;
+    }
+
+    struct pcexec_parsed_rule *parsed = inst->parsed_rule;
+    if (parsed && parsed->parse == parse && strcmp(parsed->rule, rule) == 0)
+        return parsed->param;
+
+    parsed = rule_cache_get(inst, rule, parse, reset, sz_param, off_err_msg);
+    if (parsed == NULL)
+        return NULL;
+
+    parsed_rule_release(inst->parsed_rule);
+    inst->parsed_rule = parsed;
+    return parsed->param;
+}
+
 void
 pcexecutor_inst_reset(struct purc_exec_inst *inst)
 {
@@ -385,6 +601,10 @@ pcexecutor_inst_reset(struct purc_exec_inst *inst)
         free(inst->err_msg);
         inst->err_msg = NULL;
     }
+    if (inst->parsed_rule) {
+        parsed_rule_release(inst->parsed_rule);
+        inst->parsed_rule = NULL;
+    }
 }
 
 purc_atom_t
@@ -862,9 +862,9 @@ string_pattern_expression_reset(struct string_pattern_expression *spexp)
             break;
         case STRING_PATTERN_REGEXP:
             free(spexp->regexp.regexp);
-            if (spexp->regexp.reg_valid) {
-                regfree(&spexp->regexp.reg);
-                spexp->regexp.reg_valid = 0;
+            if (spexp->regexp.cached) {
+                pcregex_cached_release(spexp->regexp.cached);
+                spexp->regexp.cached = NULL;
             }
             break;
     }
@@ -1198,12 +1198,11 @@ regular_expression_init_reg(struct regular_expression *rexp)
 
     // TODO: other flags
 
-    int r = regcomp(&rexp->reg, rexp->regexp, cflags);
-    if (r)
+    rexp->cached = pcregex_cache_get_posix(rexp->regexp, cflags);
+    if (rexp->cached == NULL)
         return -1;
 
     rexp->eflags = eflags;
-    rexp->reg_valid = 1;
 
     return 0;
 }
@@ -1222,13 +1221,13 @@ regular_expression_eval(struct regular_expression *rexp,
     const char *s = buf;
     r = -1;
 
-    if (!rexp->reg_valid) {
+    if (!rexp->cached) {
         if (regular_expression_init_reg(rexp))
             goto end;
     }
 
     r = 0;
-    v = regexec(&rexp->reg, s, 0, NULL, rexp->eflags);
+    v = regexec(pcregex_cached_posix(rexp->cached), s, 0, NULL, rexp->eflags);
 
     if (result)
         *result = (v == 0) ? true : false;
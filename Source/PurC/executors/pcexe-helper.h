@@ -32,6 +32,7 @@
 #include "purc-variant.h"
 #include "private/list.h"
 #include "private/tree.h"
+#include "private/regex.h"
 
 #include <regex.h>
 #include <stddef.h>
@@ -211,8 +212,8 @@ struct regular_expression
     unsigned char           flags;
 
     int                     eflags;
-    regex_t                 reg;
-    unsigned int            reg_valid:1;
+    /* shared with other users through the regex cache of the instance */
+    struct pcregex_cached  *cached;
 };
 
 enum STRING_PATTERN_TYPE {
@@ -61,6 +61,7 @@ typedef purc_variant_t (*pcfetcher_request_async_fn)(
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt);
@@ -103,6 +104,7 @@ struct pcfetcher_callback_info {
     volatile bool cancelled;
 
     pcfetcher_response_handler handler;
+    pcfetcher_chunk_handler chunk_handler;
     void *ctxt;
 
     pcfetcher_progress_tracker tracker;
@@ -134,6 +136,7 @@ purc_variant_t pcfetcher_local_request_async(
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt);
@@ -180,6 +183,7 @@ purc_variant_t pcfetcher_remote_request_async(
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt);
@@ -203,6 +207,43 @@ int pcfetcher_remote_check_response(struct pcfetcher* fetcher,
 struct pcfetcher_callback_info *pcfetcher_create_callback_info();
 void pcfetcher_destroy_callback_info(struct pcfetcher_callback_info *info);
 
+/* The body of a response which the remote fetcher writes into a shared
+   memory region as the data arrive. The region is sized from the
+   Content-Length, and a null byte follows the content. */
+struct pcfetcher_shared_body {
+    int fd;                 /* -1 if no region is attached */
+    const char *base;       /* the region mapped read-only */
+    size_t capacity;        /* the size of the content the region holds */
+    size_t size;            /* the bytes written so far */
+};
+
+void pcfetcher_shared_body_init(struct pcfetcher_shared_body *body);
+
+/* Maps the region of @fd which holds @capacity bytes of content; the body
+   takes the ownership of @fd. Returns 0 on success. */
+int pcfetcher_shared_body_attach(struct pcfetcher_shared_body *body,
+        int fd, size_t capacity);
+
+/* Accounts for @size more bytes written to the region. Returns the pointer
+   to them, or NULL if they overrun the region. */
+const char *pcfetcher_shared_body_advance(struct pcfetcher_shared_body *body,
+        size_t size);
+
+/* Returns a read-only stream mapping the bytes written, and detaches. */
+purc_rwstream_t pcfetcher_shared_body_take(struct pcfetcher_shared_body *body);
+
+/* Returns a memory stream holding a copy of the bytes written, which can
+   grow further, and detaches. */
+purc_rwstream_t pcfetcher_shared_body_copy(struct pcfetcher_shared_body *body);
+
+void pcfetcher_shared_body_detach(struct pcfetcher_shared_body *body);
+
+static inline bool
+pcfetcher_shared_body_attached(const struct pcfetcher_shared_body *body)
+{
+    return body->fd >= 0;
+}
+
 #ifdef __cplusplus
 }
 #endif  /* __cplusplus */
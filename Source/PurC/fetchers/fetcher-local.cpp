@@ -169,6 +169,7 @@ purc_variant_t pcfetcher_local_request_async(
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt)
@@ -179,6 +180,8 @@ purc_variant_t pcfetcher_local_request_async(
     UNUSED_PARAM(params);
     UNUSED_PARAM(timeout);
     UNUSED_PARAM(handler);
+    /* the body is read from the file by the handler; no need to chunk */
+    UNUSED_PARAM(chunk_handler);
     UNUSED_PARAM(ctxt);
 
     if (!fetcher || !url || !handler) {
@@ -300,6 +300,7 @@ purc_variant_t PcFetcherProcess::requestAsync(
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt)
@@ -311,7 +312,7 @@ purc_variant_t PcFetcherProcess::requestAsync(
     }
 
     return session->requestAsync(base_uri, url, method,
-            params, timeout, handler, ctxt, tracker, tracker_ctxt);
+            params, timeout, handler, chunk_handler, ctxt, tracker, tracker_ctxt);
 }
 
 purc_rwstream_t PcFetcherProcess::requestSync(
@@ -111,6 +111,7 @@ public:
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt);
@@ -145,6 +145,7 @@ purc_variant_t pcfetcher_remote_request_async(
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt)
@@ -152,7 +153,8 @@ purc_variant_t pcfetcher_remote_request_async(
     struct pcfetcher_remote* remote = (struct pcfetcher_remote*)fetcher;
     return remote->process->requestAsync(
             remote->base_uri,
-            url, method, params, timeout, handler, ctxt, tracker, tracker_ctxt);
+            url, method, params, timeout, handler, chunk_handler, ctxt,
+            tracker, tracker_ctxt);
 }
 
 
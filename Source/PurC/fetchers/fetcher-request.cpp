@@ -35,6 +35,7 @@
 #include "ResourceResponse.h"
 
 #include "private/url.h"
+#include "private/debug.h"
 
 #include <wtf/RunLoop.h>
 
@@ -65,6 +66,7 @@ PcFetcherRequest::PcFetcherRequest(uint64_t sessionId,
     , m_fetcherProcess(process)
 {
     auto locker = holdLock(m_callbackLock);
+    pcfetcher_shared_body_init(&m_sharedBody);
     m_callback = pcfetcher_create_callback_info();
     if (m_callback == NULL) {
         return;
@@ -78,6 +80,7 @@ PcFetcherRequest::~PcFetcherRequest()
 {
     close();
     auto locker = holdLock(m_callbackLock);
+    pcfetcher_shared_body_detach(&m_sharedBody);
     if (m_callback) {
         pcfetcher_destroy_callback_info(m_callback);
     }
@@ -116,6 +119,7 @@ purc_variant_t PcFetcherRequest::requestAsync(
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt)
@@ -125,6 +129,7 @@ purc_variant_t PcFetcherRequest::requestAsync(
 
     auto locker = holdLock(m_callbackLock);
     m_callback->handler = handler;
+    m_callback->chunk_handler = chunk_handler;
     m_callback->ctxt = ctxt;
     m_callback->tracker = tracker;
     m_callback->tracker_ctxt = tracker_ctxt;
@@ -365,6 +370,16 @@ void PcFetcherRequest::didReceiveMessage(IPC::Connection&,
                 decoder, this, &PcFetcherRequest::didReceiveSharedBuffer);
         return;
     }
+    if (decoder.messageName() == Messages::WebResourceLoader::DidReceiveSharedMemory::name()) {
+        IPC::handleMessage<Messages::WebResourceLoader::DidReceiveSharedMemory>(
+                decoder, this, &PcFetcherRequest::didReceiveSharedMemory);
+        return;
+    }
+    if (decoder.messageName() == Messages::WebResourceLoader::DidWriteSharedMemory::name()) {
+        IPC::handleMessage<Messages::WebResourceLoader::DidWriteSharedMemory>(
+                decoder, this, &PcFetcherRequest::didWriteSharedMemory);
+        return;
+    }
     if (decoder.messageName() == Messages::WebResourceLoader::DidFinishResourceLoad::name()) {
         IPC::handleMessage<Messages::WebResourceLoader::DidFinishResourceLoad>(
                 decoder, this, &PcFetcherRequest::didFinishResourceLoad);
@@ -434,25 +449,46 @@ void PcFetcherRequest::didReceiveResponse(
             }
         );
     }
-    m_callback->rws = purc_rwstream_new_buffer(init, INT_MAX);
+
+    /* feed the handler as the body arrives instead of buffering it */
+    m_chunked = m_is_async && m_callback->chunk_handler &&
+        m_callback->header.ret_code == 200;
+    m_callback->rws = m_chunked ? NULL :
+        purc_rwstream_new_buffer(init, INT_MAX);
 }
 
-void PcFetcherRequest::didReceiveSharedBuffer(
-        IPC::SharedBufferDataReference&& data, int64_t encodedDataLength)
+/* called with m_callbackLock held */
+void PcFetcherRequest::dispatchChunk(const char* data, size_t size)
 {
-    UNUSED_PARAM(encodedDataLength);
-    auto locker = holdLock(m_callbackLock);
-    if (m_callback == NULL) {
+    char *chunk = (char *)malloc(size);
+    if (chunk == NULL) {
+        PC_ERROR("Failed to allocate a chunk of the response body "
+                "(%lu bytes)\n", (unsigned long)size);
         return;
     }
-    m_bytesReceived += data.size();
+    memcpy(chunk, data, size);
+
+    struct pcfetcher_callback_info *info = m_callback;
+    m_runloop->dispatch([info, chunk, size] {
+            if (!info->cancelled) {
+                info->chunk_handler(info->req_id, info->ctxt, chunk, size);
+            }
+            free(chunk);
+        }
+    );
+}
+
+/* called with m_callbackLock held */
+void PcFetcherRequest::updateProgress(size_t size)
+{
+    m_bytesReceived += size;
     if (m_bytesReceived > m_estimatedLength) {
         m_estimatedLength = m_bytesReceived * 2;
     }
     double increment, percentOfRemainingBytes;
     long long remainingBytes = m_estimatedLength - m_bytesReceived;
     if (remainingBytes > 0)  // Prevent divide by 0.
-         percentOfRemainingBytes = (double)data.size() / (double)remainingBytes;
+         percentOfRemainingBytes = (double)size / (double)remainingBytes;
     else
         percentOfRemainingBytes = 1.0;
 
@@ -467,8 +503,82 @@ void PcFetcherRequest::didReceiveSharedBuffer(
             }
         );
     }
+}
+
+void PcFetcherRequest::didReceiveSharedBuffer(
+        IPC::SharedBufferDataReference&& data, int64_t encodedDataLength)
+{
+    UNUSED_PARAM(encodedDataLength);
+    auto locker = holdLock(m_callbackLock);
+    if (m_callback == NULL) {
+        return;
+    }
+
+    if (pcfetcher_shared_body_attached(&m_sharedBody)) {
+        /* the body overran its Content-Length; go on in chunks */
+        if (m_chunked) {
+            pcfetcher_shared_body_detach(&m_sharedBody);
+        }
+        else {
+            m_callback->rws = pcfetcher_shared_body_copy(&m_sharedBody);
+        }
+    }
+
+    updateProgress(data.size());
+    if (m_chunked) {
+        dispatchChunk((const char *)data.data(), data.size());
+    }
+    else if (m_callback->rws) {
+        purc_rwstream_write(m_callback->rws, data.data(), data.size());
+    }
+}
+
+void PcFetcherRequest::didReceiveSharedMemory(
+        PurCFetcher::SharedMemory::Handle&& handle, uint64_t size,
+        int64_t encodedDataLength)
+{
+    UNUSED_PARAM(encodedDataLength);
+    auto locker = holdLock(m_callbackLock);
+    if (m_callback == NULL) {
+        return;
+    }
+
+    /* the fetcher writes the body into the region as it arrives and tells
+       the size by DidWriteSharedMemory; map it instead of copying it */
+    IPC::Attachment attachment = handle.releaseAttachment();
+    if (pcfetcher_shared_body_attach(&m_sharedBody,
+                attachment.releaseFileDescriptor(), size)) {
+        PC_ERROR("Failed to map the shared memory of the response body "
+                "(%llu bytes)\n", (unsigned long long)size);
+        return;
+    }
+
+    if (m_callback->rws) {
+        purc_rwstream_destroy(m_callback->rws);
+        m_callback->rws = NULL;
+    }
+}
 
-    purc_rwstream_write(m_callback->rws, data.data(), data.size());
+void PcFetcherRequest::didWriteSharedMemory(uint64_t size,
+        int64_t encodedDataLength)
+{
+    UNUSED_PARAM(encodedDataLength);
+    auto locker = holdLock(m_callbackLock);
+    if (m_callback == NULL) {
+        return;
+    }
+
+    const char *data = pcfetcher_shared_body_advance(&m_sharedBody, size);
+    if (data == NULL) {
+        PC_ERROR("Bad size of the data written to the shared memory "
+                "(%llu bytes)\n", (unsigned long long)size);
+        return;
+    }
+
+    updateProgress(size);
+    if (m_chunked) {
+        dispatchChunk(data, size);
+    }
 }
 
 void PcFetcherRequest::didFinishResourceLoad(
@@ -481,6 +591,17 @@ void PcFetcherRequest::didFinishResourceLoad(
         return;
     }
 
+    if (pcfetcher_shared_body_attached(&m_sharedBody)) {
+        if (m_chunked) {
+            pcfetcher_shared_body_detach(&m_sharedBody);
+        }
+        else {
+            size_t size = m_sharedBody.size;
+            m_callback->rws = pcfetcher_shared_body_take(&m_sharedBody);
+            m_callback->header.sz_resp = m_callback->rws ? size : 0;
+        }
+    }
+
     if (!m_is_async) {
         wakeUp();
         return;
@@ -526,6 +647,7 @@ void PcFetcherRequest::didFailResourceLoad(const ResourceError& error)
     if (m_callback == NULL) {
         return;
     }
+    pcfetcher_shared_body_detach(&m_sharedBody);
     // TODO : trans error code
     m_callback->header.ret_code = 408;
 
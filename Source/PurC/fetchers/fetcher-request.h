@@ -32,6 +32,7 @@
 
 #include "WebCoreArgumentCoders.h"
 #include "SharedBufferDataReference.h"
+#include "SharedMemory.h"
 #include "Connection.h"
 #include "MessageReceiverMap.h"
 #include "ProcessLauncher.h"
@@ -70,6 +71,7 @@ public:
         purc_variant_t params,
         uint32_t timeout,
         pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt);
@@ -110,8 +112,13 @@ protected:
     void didReceiveResponse(const PurCFetcher::ResourceResponse&, bool);
     void didReceiveSharedBuffer(IPC::SharedBufferDataReference&&,
             int64_t encodedDataLength);
+    void didReceiveSharedMemory(PurCFetcher::SharedMemory::Handle&&,
+            uint64_t size, int64_t encodedDataLength);
+    void didWriteSharedMemory(uint64_t size, int64_t encodedDataLength);
     void didFinishResourceLoad(const PurCFetcher::NetworkLoadMetrics&);
     void didFailResourceLoad(const ResourceError& error);
+    void dispatchChunk(const char* data, size_t size);
+    void updateProgress(size_t size);
     void willSendRequest(ResourceRequest&&,
             IPC::FormDataReference&& requestBody, ResourceResponse&&);
 
@@ -119,6 +126,8 @@ private:
     uint64_t m_sessionId;
     uint64_t m_req_id;
     bool m_is_async;
+    /* the body goes to the chunk handler instead of m_callback->rws */
+    bool m_chunked {false};
 
     RefPtr<IPC::Connection> m_connection;
     BinarySemaphore m_waitForSyncReplySemaphore;
@@ -128,6 +137,8 @@ private:
 
     Lock m_callbackLock;
     struct pcfetcher_callback_info *m_callback;
+    /* the region the fetcher writes a large body into */
+    struct pcfetcher_shared_body m_sharedBody;
 
     PcFetcherProcess *m_fetcherProcess;
 
@@ -31,18 +31,77 @@
 
 #include <wtf/Lock.h>
 
+#include <atomic>
+
+#include <limits.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* The fetchers are shared by the instances in the process, and created
+   on the first request, so that the instances which never fetch anything
+   do not pay for them; the remote one launches a fetcher process. */
 static Lock s_fetcher_lock;
-static struct pcfetcher* s_remote_fetcher = NULL;
-static struct pcfetcher* s_local_fetcher = NULL;
+static std::atomic<struct pcfetcher*> s_remote_fetcher { nullptr };
+static std::atomic<struct pcfetcher*> s_local_fetcher { nullptr };
+
+static bool remote_fetcher_enabled(struct pcinst* inst)
+{
+#if ENABLE(REMOTE_FETCHER)
+    return inst->enable_remote_fetcher &&
+        (inst->modules_inited & PURC_HAVE_FETCHER_R);
+#else
+    UNUSED_PARAM(inst);
+    return false;
+#endif
+}
+
+static struct pcfetcher* create_fetcher(void)
+{
+    struct pcinst* inst = pcinst_current();
+    if (!inst)
+        return NULL;
+
+    auto locker = holdLock(s_fetcher_lock);
+    struct pcfetcher* fetcher = s_remote_fetcher.load();
+    if (!fetcher)
+        fetcher = s_local_fetcher.load();
+    if (fetcher)
+        return fetcher;
+
+#if ENABLE(REMOTE_FETCHER)
+    if (remote_fetcher_enabled(inst)) {
+        fetcher = pcfetcher_remote_init(inst->max_conns, inst->cache_quota);
+        s_remote_fetcher.store(fetcher);
+        return fetcher;
+    }
+#endif
+
+    if (inst->modules_inited & PURC_HAVE_FETCHER) {
+        fetcher = pcfetcher_local_init(inst->max_conns, inst->cache_quota);
+        s_local_fetcher.store(fetcher);
+    }
+
+    return fetcher;
+}
 
 static struct pcfetcher* get_fetcher(void)
 {
-    return s_remote_fetcher ? s_remote_fetcher : s_local_fetcher;
+    struct pcfetcher* fetcher = s_remote_fetcher.load();
+    if (!fetcher)
+        fetcher = s_local_fetcher.load();
+
+    return fetcher ? fetcher : create_fetcher();
 }
 
 bool pcfetcher_is_init(void)
 {
-    return s_remote_fetcher || s_local_fetcher;
+    if (s_remote_fetcher.load() || s_local_fetcher.load())
+        return true;
+
+    /* it will be created on the first request */
+    struct pcinst* inst = pcinst_current();
+    return inst && ((inst->modules_inited & PURC_HAVE_FETCHER) ||
+            remote_fetcher_enabled(inst));
 }
 
 const char* pcfetcher_set_base_url(const char* base_url)
@@ -89,10 +148,26 @@ purc_variant_t pcfetcher_request_async(
         void* ctxt,
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt)
+{
+    return pcfetcher_request_async_ex(url, method, params, timeout,
+            handler, NULL, ctxt, tracker, tracker_ctxt);
+}
+
+purc_variant_t pcfetcher_request_async_ex(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
+        void* ctxt,
+        pcfetcher_progress_tracker tracker,
+        void* tracker_ctxt)
 {
     struct pcfetcher* fetcher = get_fetcher();
     return fetcher ? fetcher->request_async(fetcher, url, method,
-            params, timeout, handler, ctxt, tracker, tracker_ctxt) : PURC_VARIANT_INVALID;
+            params, timeout, handler, chunk_handler, ctxt,
+            tracker, tracker_ctxt) : PURC_VARIANT_INVALID;
 }
 
 purc_rwstream_t pcfetcher_request_sync(
@@ -143,6 +218,79 @@ void pcfetcher_destroy_callback_info(struct pcfetcher_callback_info *info)
     free(info);
 }
 
+void pcfetcher_shared_body_init(struct pcfetcher_shared_body *body)
+{
+    body->fd = -1;
+    body->base = NULL;
+    body->capacity = 0;
+    body->size = 0;
+}
+
+int pcfetcher_shared_body_attach(struct pcfetcher_shared_body *body,
+        int fd, size_t capacity)
+{
+    pcfetcher_shared_body_detach(body);
+
+    void *base = mmap(NULL, capacity + 1, PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+
+    body->fd = fd;
+    body->base = (const char *)base;
+    body->capacity = capacity;
+    body->size = 0;
+    return 0;
+}
+
+const char *pcfetcher_shared_body_advance(struct pcfetcher_shared_body *body,
+        size_t size)
+{
+    if (body->fd < 0 || size > body->capacity - body->size) {
+        return NULL;
+    }
+
+    const char *data = body->base + body->size;
+    body->size += size;
+    return data;
+}
+
+purc_rwstream_t pcfetcher_shared_body_take(struct pcfetcher_shared_body *body)
+{
+    purc_rwstream_t rws = NULL;
+    if (body->fd >= 0) {
+        rws = purc_rwstream_new_from_mmap(body->fd, body->size);
+    }
+
+    pcfetcher_shared_body_detach(body);
+    return rws;
+}
+
+purc_rwstream_t pcfetcher_shared_body_copy(struct pcfetcher_shared_body *body)
+{
+    purc_rwstream_t rws = NULL;
+    if (body->fd >= 0) {
+        rws = purc_rwstream_new_buffer(body->size + 1, INT_MAX);
+        if (rws && body->size) {
+            purc_rwstream_write(rws, body->base, body->size);
+        }
+    }
+
+    pcfetcher_shared_body_detach(body);
+    return rws;
+}
+
+void pcfetcher_shared_body_detach(struct pcfetcher_shared_body *body)
+{
+    if (body->fd >= 0) {
+        munmap((void *)body->base, body->capacity + 1);
+        close(body->fd);
+    }
+
+    pcfetcher_shared_body_init(body);
+}
+
 static int _local_init_once(void)
 {
     return 0;
@@ -151,13 +299,10 @@ static int _local_init_once(void)
 static int _local_init_instance(struct pcinst* curr_inst,
         const purc_instance_extra_info* extra_info)
 {
+    UNUSED_PARAM(curr_inst);
     UNUSED_PARAM(extra_info);
-    auto locker = holdLock(s_fetcher_lock);
-    if (!s_local_fetcher) {
-        s_local_fetcher = pcfetcher_local_init(curr_inst->max_conns,
-                curr_inst->cache_quota);
-    }
 
+    /* the local fetcher is created on demand; see create_fetcher() */
     return 0;
 }
 
@@ -165,9 +310,9 @@ static void _local_cleanup_instance(struct pcinst* curr_inst)
 {
     UNUSED_PARAM(curr_inst);
 
-    if (s_local_fetcher) {
-        s_local_fetcher->term(s_local_fetcher);
-        s_local_fetcher = NULL;
+    struct pcfetcher* fetcher = s_local_fetcher.exchange(nullptr);
+    if (fetcher) {
+        fetcher->term(fetcher);
     }
 }
 
@@ -188,18 +333,10 @@ static int _remote_init_once(void)
 static int _remote_init_instance(struct pcinst* curr_inst,
         const purc_instance_extra_info* extra_info)
 {
+    UNUSED_PARAM(curr_inst);
     UNUSED_PARAM(extra_info);
 
-#if ENABLE(REMOTE_FETCHER)                /* { */
-    auto locker = holdLock(s_fetcher_lock);
-    if (curr_inst->enable_remote_fetcher && !s_remote_fetcher) {
-        s_remote_fetcher = pcfetcher_remote_init(curr_inst->max_conns,
-                curr_inst->cache_quota);
-        if (!s_remote_fetcher)
-            return PURC_ERROR_OUT_OF_MEMORY;
-    }
-#endif                                    /* } */
-
+    /* the remote fetcher is created on demand; see create_fetcher() */
     return 0;
 }
 
@@ -207,9 +344,9 @@ static void _remote_cleanup_instance(struct pcinst* curr_inst)
 {
     UNUSED_PARAM(curr_inst);
 
-    if (s_remote_fetcher) {
-        s_remote_fetcher->term(s_remote_fetcher);
-        s_remote_fetcher = NULL;
+    struct pcfetcher* fetcher = s_remote_fetcher.exchange(nullptr);
+    if (fetcher) {
+        fetcher->term(fetcher);
     }
 }
 
@@ -221,4 +358,3 @@ struct pcmodule _module_fetcher_remote = {
     .init_instance          = _remote_init_instance,
     .cleanup_instance       = _remote_cleanup_instance,
 };
-
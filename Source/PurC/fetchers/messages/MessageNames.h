@@ -2361,951 +2361,953 @@ enum class MessageName : uint16_t {
     , WebResourceLoader_DidReceiveResponse = 1469
     , WebResourceLoader_DidReceiveData = 1470
     , WebResourceLoader_DidReceiveSharedBuffer = 1471
-    , WebResourceLoader_DidFinishResourceLoad = 1472
-    , WebResourceLoader_DidFailResourceLoad = 1473
-    , WebResourceLoader_DidFailServiceWorkerLoad = 1474
-    , WebResourceLoader_ServiceWorkerDidNotHandle = 1475
-    , WebResourceLoader_DidBlockAuthenticationChallenge = 1476
-    , WebResourceLoader_StopLoadingAfterXFrameOptionsOrContentSecurityPolicyDenied = 1477
+    , WebResourceLoader_DidReceiveSharedMemory = 1472
+    , WebResourceLoader_DidWriteSharedMemory = 1473
+    , WebResourceLoader_DidFinishResourceLoad = 1474
+    , WebResourceLoader_DidFailResourceLoad = 1475
+    , WebResourceLoader_DidFailServiceWorkerLoad = 1476
+    , WebResourceLoader_ServiceWorkerDidNotHandle = 1477
+    , WebResourceLoader_DidBlockAuthenticationChallenge = 1478
+    , WebResourceLoader_StopLoadingAfterXFrameOptionsOrContentSecurityPolicyDenied = 1479
 #if ENABLE(SHAREABLE_RESOURCE)
-    , WebResourceLoader_DidReceiveResource = 1478
-#endif
-    , WebSocketChannel_DidConnect = 1479
-    , WebSocketChannel_DidClose = 1480
-    , WebSocketChannel_DidReceiveText = 1481
-    , WebSocketChannel_DidReceiveBinaryData = 1482
-    , WebSocketChannel_DidReceiveMessageError = 1483
-    , WebSocketChannel_DidSendHandshakeRequest = 1484
-    , WebSocketChannel_DidReceiveHandshakeResponse = 1485
-    , WebSocketStream_DidOpenSocketStream = 1486
-    , WebSocketStream_DidCloseSocketStream = 1487
-    , WebSocketStream_DidReceiveSocketStreamData = 1488
-    , WebSocketStream_DidFailToReceiveSocketStreamData = 1489
-    , WebSocketStream_DidUpdateBufferedAmount = 1490
-    , WebSocketStream_DidFailSocketStream = 1491
-    , WebSocketStream_DidSendData = 1492
-    , WebSocketStream_DidSendHandshake = 1493
-    , WebNotificationManager_DidShowNotification = 1494
-    , WebNotificationManager_DidClickNotification = 1495
-    , WebNotificationManager_DidCloseNotifications = 1496
-    , WebNotificationManager_DidUpdateNotificationDecision = 1497
-    , WebNotificationManager_DidRemoveNotificationDecisions = 1498
-    , PluginProcessConnection_SetException = 1499
-    , PluginProcessConnectionManager_PluginProcessCrashed = 1500
-    , PluginProxy_LoadURL = 1501
-    , PluginProxy_Update = 1502
-    , PluginProxy_ProxiesForURL = 1503
-    , PluginProxy_CookiesForURL = 1504
-    , PluginProxy_SetCookiesForURL = 1505
-    , PluginProxy_GetAuthenticationInfo = 1506
-    , PluginProxy_GetPluginElementNPObject = 1507
-    , PluginProxy_Evaluate = 1508
-    , PluginProxy_CancelStreamLoad = 1509
-    , PluginProxy_ContinueStreamLoad = 1510
-    , PluginProxy_CancelManualStreamLoad = 1511
-    , PluginProxy_SetStatusbarText = 1512
-#if PLATFORM(COCOA)
-    , PluginProxy_PluginFocusOrWindowFocusChanged = 1513
-#endif
-#if PLATFORM(COCOA)
-    , PluginProxy_SetComplexTextInputState = 1514
-#endif
-#if PLATFORM(COCOA)
-    , PluginProxy_SetLayerHostingContextID = 1515
+    , WebResourceLoader_DidReceiveResource = 1480
+#endif
+    , WebSocketChannel_DidConnect = 1481
+    , WebSocketChannel_DidClose = 1482
+    , WebSocketChannel_DidReceiveText = 1483
+    , WebSocketChannel_DidReceiveBinaryData = 1484
+    , WebSocketChannel_DidReceiveMessageError = 1485
+    , WebSocketChannel_DidSendHandshakeRequest = 1486
+    , WebSocketChannel_DidReceiveHandshakeResponse = 1487
+    , WebSocketStream_DidOpenSocketStream = 1488
+    , WebSocketStream_DidCloseSocketStream = 1489
+    , WebSocketStream_DidReceiveSocketStreamData = 1490
+    , WebSocketStream_DidFailToReceiveSocketStreamData = 1491
+    , WebSocketStream_DidUpdateBufferedAmount = 1492
+    , WebSocketStream_DidFailSocketStream = 1493
+    , WebSocketStream_DidSendData = 1494
+    , WebSocketStream_DidSendHandshake = 1495
+    , WebNotificationManager_DidShowNotification = 1496
+    , WebNotificationManager_DidClickNotification = 1497
+    , WebNotificationManager_DidCloseNotifications = 1498
+    , WebNotificationManager_DidUpdateNotificationDecision = 1499
+    , WebNotificationManager_DidRemoveNotificationDecisions = 1500
+    , PluginProcessConnection_SetException = 1501
+    , PluginProcessConnectionManager_PluginProcessCrashed = 1502
+    , PluginProxy_LoadURL = 1503
+    , PluginProxy_Update = 1504
+    , PluginProxy_ProxiesForURL = 1505
+    , PluginProxy_CookiesForURL = 1506
+    , PluginProxy_SetCookiesForURL = 1507
+    , PluginProxy_GetAuthenticationInfo = 1508
+    , PluginProxy_GetPluginElementNPObject = 1509
+    , PluginProxy_Evaluate = 1510
+    , PluginProxy_CancelStreamLoad = 1511
+    , PluginProxy_ContinueStreamLoad = 1512
+    , PluginProxy_CancelManualStreamLoad = 1513
+    , PluginProxy_SetStatusbarText = 1514
+#if PLATFORM(COCOA)
+    , PluginProxy_PluginFocusOrWindowFocusChanged = 1515
+#endif
+#if PLATFORM(COCOA)
+    , PluginProxy_SetComplexTextInputState = 1516
+#endif
+#if PLATFORM(COCOA)
+    , PluginProxy_SetLayerHostingContextID = 1517
 #endif
 #if PLATFORM(X11)
-    , PluginProxy_CreatePluginContainer = 1516
+    , PluginProxy_CreatePluginContainer = 1518
 #endif
 #if PLATFORM(X11)
-    , PluginProxy_WindowedPluginGeometryDidChange = 1517
+    , PluginProxy_WindowedPluginGeometryDidChange = 1519
 #endif
 #if PLATFORM(X11)
-    , PluginProxy_WindowedPluginVisibilityDidChange = 1518
-#endif
-    , PluginProxy_DidCreatePlugin = 1519
-    , PluginProxy_DidFailToCreatePlugin = 1520
-    , PluginProxy_SetPluginIsPlayingAudio = 1521
-    , WebSWClientConnection_JobRejectedInServer = 1522
-    , WebSWClientConnection_RegistrationJobResolvedInServer = 1523
-    , WebSWClientConnection_StartScriptFetchForServer = 1524
-    , WebSWClientConnection_UpdateRegistrationState = 1525
-    , WebSWClientConnection_UpdateWorkerState = 1526
-    , WebSWClientConnection_FireUpdateFoundEvent = 1527
-    , WebSWClientConnection_SetRegistrationLastUpdateTime = 1528
-    , WebSWClientConnection_SetRegistrationUpdateViaCache = 1529
-    , WebSWClientConnection_NotifyClientsOfControllerChange = 1530
-    , WebSWClientConnection_SetSWOriginTableIsImported = 1531
-    , WebSWClientConnection_SetSWOriginTableSharedMemory = 1532
-    , WebSWClientConnection_PostMessageToServiceWorkerClient = 1533
-    , WebSWClientConnection_DidMatchRegistration = 1534
-    , WebSWClientConnection_DidGetRegistrations = 1535
-    , WebSWClientConnection_RegistrationReady = 1536
-    , WebSWClientConnection_SetDocumentIsControlled = 1537
-    , WebSWClientConnection_SetDocumentIsControlledReply = 1538
-    , WebSWContextManagerConnection_InstallServiceWorker = 1539
-    , WebSWContextManagerConnection_StartFetch = 1540
-    , WebSWContextManagerConnection_CancelFetch = 1541
-    , WebSWContextManagerConnection_ContinueDidReceiveFetchResponse = 1542
-    , WebSWContextManagerConnection_PostMessageToServiceWorker = 1543
-    , WebSWContextManagerConnection_FireInstallEvent = 1544
-    , WebSWContextManagerConnection_FireActivateEvent = 1545
-    , WebSWContextManagerConnection_TerminateWorker = 1546
-    , WebSWContextManagerConnection_FindClientByIdentifierCompleted = 1547
-    , WebSWContextManagerConnection_MatchAllCompleted = 1548
-    , WebSWContextManagerConnection_SetUserAgent = 1549
-    , WebSWContextManagerConnection_UpdatePreferencesStore = 1550
-    , WebSWContextManagerConnection_Close = 1551
-    , WebSWContextManagerConnection_SetThrottleState = 1552
-    , WebUserContentController_AddContentWorlds = 1553
-    , WebUserContentController_RemoveContentWorlds = 1554
-    , WebUserContentController_AddUserScripts = 1555
-    , WebUserContentController_RemoveUserScript = 1556
-    , WebUserContentController_RemoveAllUserScripts = 1557
-    , WebUserContentController_AddUserStyleSheets = 1558
-    , WebUserContentController_RemoveUserStyleSheet = 1559
-    , WebUserContentController_RemoveAllUserStyleSheets = 1560
-    , WebUserContentController_AddUserScriptMessageHandlers = 1561
-    , WebUserContentController_RemoveUserScriptMessageHandler = 1562
-    , WebUserContentController_RemoveAllUserScriptMessageHandlersForWorlds = 1563
-    , WebUserContentController_RemoveAllUserScriptMessageHandlers = 1564
+    , PluginProxy_WindowedPluginVisibilityDidChange = 1520
+#endif
+    , PluginProxy_DidCreatePlugin = 1521
+    , PluginProxy_DidFailToCreatePlugin = 1522
+    , PluginProxy_SetPluginIsPlayingAudio = 1523
+    , WebSWClientConnection_JobRejectedInServer = 1524
+    , WebSWClientConnection_RegistrationJobResolvedInServer = 1525
+    , WebSWClientConnection_StartScriptFetchForServer = 1526
+    , WebSWClientConnection_UpdateRegistrationState = 1527
+    , WebSWClientConnection_UpdateWorkerState = 1528
+    , WebSWClientConnection_FireUpdateFoundEvent = 1529
+    , WebSWClientConnection_SetRegistrationLastUpdateTime = 1530
+    , WebSWClientConnection_SetRegistrationUpdateViaCache = 1531
+    , WebSWClientConnection_NotifyClientsOfControllerChange = 1532
+    , WebSWClientConnection_SetSWOriginTableIsImported = 1533
+    , WebSWClientConnection_SetSWOriginTableSharedMemory = 1534
+    , WebSWClientConnection_PostMessageToServiceWorkerClient = 1535
+    , WebSWClientConnection_DidMatchRegistration = 1536
+    , WebSWClientConnection_DidGetRegistrations = 1537
+    , WebSWClientConnection_RegistrationReady = 1538
+    , WebSWClientConnection_SetDocumentIsControlled = 1539
+    , WebSWClientConnection_SetDocumentIsControlledReply = 1540
+    , WebSWContextManagerConnection_InstallServiceWorker = 1541
+    , WebSWContextManagerConnection_StartFetch = 1542
+    , WebSWContextManagerConnection_CancelFetch = 1543
+    , WebSWContextManagerConnection_ContinueDidReceiveFetchResponse = 1544
+    , WebSWContextManagerConnection_PostMessageToServiceWorker = 1545
+    , WebSWContextManagerConnection_FireInstallEvent = 1546
+    , WebSWContextManagerConnection_FireActivateEvent = 1547
+    , WebSWContextManagerConnection_TerminateWorker = 1548
+    , WebSWContextManagerConnection_FindClientByIdentifierCompleted = 1549
+    , WebSWContextManagerConnection_MatchAllCompleted = 1550
+    , WebSWContextManagerConnection_SetUserAgent = 1551
+    , WebSWContextManagerConnection_UpdatePreferencesStore = 1552
+    , WebSWContextManagerConnection_Close = 1553
+    , WebSWContextManagerConnection_SetThrottleState = 1554
+    , WebUserContentController_AddContentWorlds = 1555
+    , WebUserContentController_RemoveContentWorlds = 1556
+    , WebUserContentController_AddUserScripts = 1557
+    , WebUserContentController_RemoveUserScript = 1558
+    , WebUserContentController_RemoveAllUserScripts = 1559
+    , WebUserContentController_AddUserStyleSheets = 1560
+    , WebUserContentController_RemoveUserStyleSheet = 1561
+    , WebUserContentController_RemoveAllUserStyleSheets = 1562
+    , WebUserContentController_AddUserScriptMessageHandlers = 1563
+    , WebUserContentController_RemoveUserScriptMessageHandler = 1564
+    , WebUserContentController_RemoveAllUserScriptMessageHandlersForWorlds = 1565
+    , WebUserContentController_RemoveAllUserScriptMessageHandlers = 1566
 #if ENABLE(CONTENT_EXTENSIONS)
-    , WebUserContentController_AddContentRuleLists = 1565
+    , WebUserContentController_AddContentRuleLists = 1567
 #endif
 #if ENABLE(CONTENT_EXTENSIONS)
-    , WebUserContentController_RemoveContentRuleList = 1566
+    , WebUserContentController_RemoveContentRuleList = 1568
 #endif
 #if ENABLE(CONTENT_EXTENSIONS)
-    , WebUserContentController_RemoveAllContentRuleLists = 1567
+    , WebUserContentController_RemoveAllContentRuleLists = 1569
 #endif
 #if USE(COORDINATED_GRAPHICS) || USE(TEXTURE_MAPPER)
-    , DrawingArea_UpdateBackingStoreState = 1568
+    , DrawingArea_UpdateBackingStoreState = 1570
 #endif
-    , DrawingArea_DidUpdate = 1569
+    , DrawingArea_DidUpdate = 1571
 #if PLATFORM(COCOA)
-    , DrawingArea_UpdateGeometry = 1570
+    , DrawingArea_UpdateGeometry = 1572
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_SetDeviceScaleFactor = 1571
+    , DrawingArea_SetDeviceScaleFactor = 1573
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_SetColorSpace = 1572
+    , DrawingArea_SetColorSpace = 1574
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_SetViewExposedRect = 1573
+    , DrawingArea_SetViewExposedRect = 1575
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AdjustTransientZoom = 1574
+    , DrawingArea_AdjustTransientZoom = 1576
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_CommitTransientZoom = 1575
+    , DrawingArea_CommitTransientZoom = 1577
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AcceleratedAnimationDidStart = 1576
+    , DrawingArea_AcceleratedAnimationDidStart = 1578
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AcceleratedAnimationDidEnd = 1577
+    , DrawingArea_AcceleratedAnimationDidEnd = 1579
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AddTransactionCallbackID = 1578
+    , DrawingArea_AddTransactionCallbackID = 1580
 #endif
-    , EventDispatcher_WheelEvent = 1579
+    , EventDispatcher_WheelEvent = 1581
 #if ENABLE(IOS_TOUCH_EVENTS)
-    , EventDispatcher_TouchEvent = 1580
+    , EventDispatcher_TouchEvent = 1582
 #endif
 #if ENABLE(MAC_GESTURE_EVENTS)
-    , EventDispatcher_GestureEvent = 1581
+    , EventDispatcher_GestureEvent = 1583
 #endif
 #if ENABLE(WEBPROCESS_WINDOWSERVER_BLOCKING)
-    , EventDispatcher_DisplayWasRefreshed = 1582
+    , EventDispatcher_DisplayWasRefreshed = 1584
 #endif
-    , VisitedLinkTableController_SetVisitedLinkTable = 1583
-    , VisitedLinkTableController_VisitedLinkStateChanged = 1584
-    , VisitedLinkTableController_AllVisitedLinkStateChanged = 1585
-    , VisitedLinkTableController_RemoveAllVisitedLinks = 1586
-    , WebPage_SetInitialFocus = 1587
-    , WebPage_SetInitialFocusReply = 1588
-    , WebPage_SetActivityState = 1589
-    , WebPage_SetLayerHostingMode = 1590
-    , WebPage_SetBackgroundColor = 1591
-    , WebPage_AddConsoleMessage = 1592
-    , WebPage_SendCSPViolationReport = 1593
-    , WebPage_EnqueueSecurityPolicyViolationEvent = 1594
-    , WebPage_TestProcessIncomingSyncMessagesWhenWaitingForSyncReply = 1595
+    , VisitedLinkTableController_SetVisitedLinkTable = 1585
+    , VisitedLinkTableController_VisitedLinkStateChanged = 1586
+    , VisitedLinkTableController_AllVisitedLinkStateChanged = 1587
+    , VisitedLinkTableController_RemoveAllVisitedLinks = 1588
+    , WebPage_SetInitialFocus = 1589
+    , WebPage_SetInitialFocusReply = 1590
+    , WebPage_SetActivityState = 1591
+    , WebPage_SetLayerHostingMode = 1592
+    , WebPage_SetBackgroundColor = 1593
+    , WebPage_AddConsoleMessage = 1594
+    , WebPage_SendCSPViolationReport = 1595
+    , WebPage_EnqueueSecurityPolicyViolationEvent = 1596
+    , WebPage_TestProcessIncomingSyncMessagesWhenWaitingForSyncReply = 1597
 #if PLATFORM(COCOA)
-    , WebPage_SetTopContentInsetFenced = 1596
+    , WebPage_SetTopContentInsetFenced = 1598
 #endif
-    , WebPage_SetTopContentInset = 1597
-    , WebPage_SetUnderlayColor = 1598
-    , WebPage_ViewWillStartLiveResize = 1599
-    , WebPage_ViewWillEndLiveResize = 1600
-    , WebPage_ExecuteEditCommandWithCallback = 1601
-    , WebPage_ExecuteEditCommandWithCallbackReply = 1602
-    , WebPage_KeyEvent = 1603
-    , WebPage_MouseEvent = 1604
+    , WebPage_SetTopContentInset = 1599
+    , WebPage_SetUnderlayColor = 1600
+    , WebPage_ViewWillStartLiveResize = 1601
+    , WebPage_ViewWillEndLiveResize = 1602
+    , WebPage_ExecuteEditCommandWithCallback = 1603
+    , WebPage_ExecuteEditCommandWithCallbackReply = 1604
+    , WebPage_KeyEvent = 1605
+    , WebPage_MouseEvent = 1606
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetViewportConfigurationViewLayoutSize = 1605
+    , WebPage_SetViewportConfigurationViewLayoutSize = 1607
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetMaximumUnobscuredSize = 1606
+    , WebPage_SetMaximumUnobscuredSize = 1608
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetDeviceOrientation = 1607
+    , WebPage_SetDeviceOrientation = 1609
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetOverrideViewportArguments = 1608
+    , WebPage_SetOverrideViewportArguments = 1610
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_DynamicViewportSizeUpdate = 1609
+    , WebPage_DynamicViewportSizeUpdate = 1611
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetScreenIsBeingCaptured = 1610
+    , WebPage_SetScreenIsBeingCaptured = 1612
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleTap = 1611
+    , WebPage_HandleTap = 1613
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_PotentialTapAtPosition = 1612
+    , WebPage_PotentialTapAtPosition = 1614
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_CommitPotentialTap = 1613
+    , WebPage_CommitPotentialTap = 1615
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_CancelPotentialTap = 1614
+    , WebPage_CancelPotentialTap = 1616
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_TapHighlightAtPosition = 1615
+    , WebPage_TapHighlightAtPosition = 1617
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_DidRecognizeLongPress = 1616
+    , WebPage_DidRecognizeLongPress = 1618
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleDoubleTapForDoubleClickAtPoint = 1617
+    , WebPage_HandleDoubleTapForDoubleClickAtPoint = 1619
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_InspectorNodeSearchMovedToPosition = 1618
+    , WebPage_InspectorNodeSearchMovedToPosition = 1620
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_InspectorNodeSearchEndedAtPosition = 1619
+    , WebPage_InspectorNodeSearchEndedAtPosition = 1621
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_BlurFocusedElement = 1620
+    , WebPage_BlurFocusedElement = 1622
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectWithGesture = 1621
+    , WebPage_SelectWithGesture = 1623
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithTouches = 1622
+    , WebPage_UpdateSelectionWithTouches = 1624
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectWithTwoTouches = 1623
+    , WebPage_SelectWithTwoTouches = 1625
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ExtendSelection = 1624
+    , WebPage_ExtendSelection = 1626
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectWordBackward = 1625
+    , WebPage_SelectWordBackward = 1627
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_MoveSelectionByOffset = 1626
-    , WebPage_MoveSelectionByOffsetReply = 1627
+    , WebPage_MoveSelectionByOffset = 1628
+    , WebPage_MoveSelectionByOffsetReply = 1629
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectTextWithGranularityAtPoint = 1628
-    , WebPage_SelectTextWithGranularityAtPointReply = 1629
+    , WebPage_SelectTextWithGranularityAtPoint = 1630
+    , WebPage_SelectTextWithGranularityAtPointReply = 1631
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectPositionAtBoundaryWithDirection = 1630
-    , WebPage_SelectPositionAtBoundaryWithDirectionReply = 1631
+    , WebPage_SelectPositionAtBoundaryWithDirection = 1632
+    , WebPage_SelectPositionAtBoundaryWithDirectionReply = 1633
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_MoveSelectionAtBoundaryWithDirection = 1632
-    , WebPage_MoveSelectionAtBoundaryWithDirectionReply = 1633
+    , WebPage_MoveSelectionAtBoundaryWithDirection = 1634
+    , WebPage_MoveSelectionAtBoundaryWithDirectionReply = 1635
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectPositionAtPoint = 1634
-    , WebPage_SelectPositionAtPointReply = 1635
+    , WebPage_SelectPositionAtPoint = 1636
+    , WebPage_SelectPositionAtPointReply = 1637
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_BeginSelectionInDirection = 1636
+    , WebPage_BeginSelectionInDirection = 1638
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithExtentPoint = 1637
+    , WebPage_UpdateSelectionWithExtentPoint = 1639
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithExtentPointAndBoundary = 1638
+    , WebPage_UpdateSelectionWithExtentPointAndBoundary = 1640
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestDictationContext = 1639
+    , WebPage_RequestDictationContext = 1641
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ReplaceDictatedText = 1640
+    , WebPage_ReplaceDictatedText = 1642
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ReplaceSelectedText = 1641
+    , WebPage_ReplaceSelectedText = 1643
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestAutocorrectionData = 1642
-    , WebPage_RequestAutocorrectionDataReply = 1643
+    , WebPage_RequestAutocorrectionData = 1644
+    , WebPage_RequestAutocorrectionDataReply = 1645
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplyAutocorrection = 1644
+    , WebPage_ApplyAutocorrection = 1646
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SyncApplyAutocorrection = 1645
+    , WebPage_SyncApplyAutocorrection = 1647
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestAutocorrectionContext = 1646
+    , WebPage_RequestAutocorrectionContext = 1648
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestEvasionRectsAboveSelection = 1647
-    , WebPage_RequestEvasionRectsAboveSelectionReply = 1648
+    , WebPage_RequestEvasionRectsAboveSelection = 1649
+    , WebPage_RequestEvasionRectsAboveSelectionReply = 1650
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetPositionInformation = 1649
+    , WebPage_GetPositionInformation = 1651
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestPositionInformation = 1650
+    , WebPage_RequestPositionInformation = 1652
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StartInteractionWithElementContextOrPosition = 1651
+    , WebPage_StartInteractionWithElementContextOrPosition = 1653
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StopInteraction = 1652
+    , WebPage_StopInteraction = 1654
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_PerformActionOnElement = 1653
+    , WebPage_PerformActionOnElement = 1655
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_FocusNextFocusedElement = 1654
-    , WebPage_FocusNextFocusedElementReply = 1655
+    , WebPage_FocusNextFocusedElement = 1656
+    , WebPage_FocusNextFocusedElementReply = 1657
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetFocusedElementValue = 1656
+    , WebPage_SetFocusedElementValue = 1658
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_AutofillLoginCredentials = 1657
+    , WebPage_AutofillLoginCredentials = 1659
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetFocusedElementValueAsNumber = 1658
+    , WebPage_SetFocusedElementValueAsNumber = 1660
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetFocusedElementSelectedIndex = 1659
+    , WebPage_SetFocusedElementSelectedIndex = 1661
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationWillResignActive = 1660
+    , WebPage_ApplicationWillResignActive = 1662
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidEnterBackground = 1661
+    , WebPage_ApplicationDidEnterBackground = 1663
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidFinishSnapshottingAfterEnteringBackground = 1662
+    , WebPage_ApplicationDidFinishSnapshottingAfterEnteringBackground = 1664
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationWillEnterForeground = 1663
+    , WebPage_ApplicationWillEnterForeground = 1665
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidBecomeActive = 1664
+    , WebPage_ApplicationDidBecomeActive = 1666
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidEnterBackgroundForMedia = 1665
+    , WebPage_ApplicationDidEnterBackgroundForMedia = 1667
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationWillEnterForegroundForMedia = 1666
+    , WebPage_ApplicationWillEnterForegroundForMedia = 1668
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ContentSizeCategoryDidChange = 1667
+    , WebPage_ContentSizeCategoryDidChange = 1669
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetSelectionContext = 1668
+    , WebPage_GetSelectionContext = 1670
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetAllowsMediaDocumentInlinePlayback = 1669
+    , WebPage_SetAllowsMediaDocumentInlinePlayback = 1671
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleTwoFingerTapAtPoint = 1670
+    , WebPage_HandleTwoFingerTapAtPoint = 1672
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleStylusSingleTapAtPoint = 1671
+    , WebPage_HandleStylusSingleTapAtPoint = 1673
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetForceAlwaysUserScalable = 1672
+    , WebPage_SetForceAlwaysUserScalable = 1674
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetRectsForGranularityWithSelectionOffset = 1673
+    , WebPage_GetRectsForGranularityWithSelectionOffset = 1675
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetRectsAtSelectionOffsetWithText = 1674
+    , WebPage_GetRectsAtSelectionOffsetWithText = 1676
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StoreSelectionForAccessibility = 1675
+    , WebPage_StoreSelectionForAccessibility = 1677
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StartAutoscrollAtPosition = 1676
+    , WebPage_StartAutoscrollAtPosition = 1678
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_CancelAutoscroll = 1677
+    , WebPage_CancelAutoscroll = 1679
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestFocusedElementInformation = 1678
+    , WebPage_RequestFocusedElementInformation = 1680
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HardwareKeyboardAvailabilityChanged = 1679
+    , WebPage_HardwareKeyboardAvailabilityChanged = 1681
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetIsShowingInputViewForFocusedElement = 1680
+    , WebPage_SetIsShowingInputViewForFocusedElement = 1682
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithDelta = 1681
-    , WebPage_UpdateSelectionWithDeltaReply = 1682
+    , WebPage_UpdateSelectionWithDelta = 1683
+    , WebPage_UpdateSelectionWithDeltaReply = 1684
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestDocumentEditingContext = 1683
-    , WebPage_RequestDocumentEditingContextReply = 1684
+    , WebPage_RequestDocumentEditingContext = 1685
+    , WebPage_RequestDocumentEditingContextReply = 1686
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GenerateSyntheticEditingCommand = 1685
+    , WebPage_GenerateSyntheticEditingCommand = 1687
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetShouldRevealCurrentSelectionAfterInsertion = 1686
+    , WebPage_SetShouldRevealCurrentSelectionAfterInsertion = 1688
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_InsertTextPlaceholder = 1687
-    , WebPage_InsertTextPlaceholderReply = 1688
+    , WebPage_InsertTextPlaceholder = 1689
+    , WebPage_InsertTextPlaceholderReply = 1690
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RemoveTextPlaceholder = 1689
-    , WebPage_RemoveTextPlaceholderReply = 1690
+    , WebPage_RemoveTextPlaceholder = 1691
+    , WebPage_RemoveTextPlaceholderReply = 1692
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_TextInputContextsInRect = 1691
-    , WebPage_TextInputContextsInRectReply = 1692
+    , WebPage_TextInputContextsInRect = 1693
+    , WebPage_TextInputContextsInRectReply = 1694
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_FocusTextInputContextAndPlaceCaret = 1693
-    , WebPage_FocusTextInputContextAndPlaceCaretReply = 1694
+    , WebPage_FocusTextInputContextAndPlaceCaret = 1695
+    , WebPage_FocusTextInputContextAndPlaceCaretReply = 1696
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ClearServiceWorkerEntitlementOverride = 1695
-    , WebPage_ClearServiceWorkerEntitlementOverrideReply = 1696
+    , WebPage_ClearServiceWorkerEntitlementOverride = 1697
+    , WebPage_ClearServiceWorkerEntitlementOverrideReply = 1698
 #endif
-    , WebPage_SetControlledByAutomation = 1697
-    , WebPage_ConnectInspector = 1698
-    , WebPage_DisconnectInspector = 1699
-    , WebPage_SendMessageToTargetBackend = 1700
+    , WebPage_SetControlledByAutomation = 1699
+    , WebPage_ConnectInspector = 1700
+    , WebPage_DisconnectInspector = 1701
+    , WebPage_SendMessageToTargetBackend = 1702
 #if ENABLE(REMOTE_INSPECTOR)
-    , WebPage_SetIndicating = 1701
+    , WebPage_SetIndicating = 1703
 #endif
 #if ENABLE(IOS_TOUCH_EVENTS)
-    , WebPage_ResetPotentialTapSecurityOrigin = 1702
+    , WebPage_ResetPotentialTapSecurityOrigin = 1704
 #endif
 #if ENABLE(IOS_TOUCH_EVENTS)
-    , WebPage_TouchEventSync = 1703
+    , WebPage_TouchEventSync = 1705
 #endif
 #if !ENABLE(IOS_TOUCH_EVENTS) && ENABLE(TOUCH_EVENTS)
-    , WebPage_TouchEvent = 1704
+    , WebPage_TouchEvent = 1706
 #endif
-    , WebPage_CancelPointer = 1705
-    , WebPage_TouchWithIdentifierWasRemoved = 1706
+    , WebPage_CancelPointer = 1707
+    , WebPage_TouchWithIdentifierWasRemoved = 1708
 #if ENABLE(INPUT_TYPE_COLOR)
-    , WebPage_DidEndColorPicker = 1707
+    , WebPage_DidEndColorPicker = 1709
 #endif
 #if ENABLE(INPUT_TYPE_COLOR)
-    , WebPage_DidChooseColor = 1708
+    , WebPage_DidChooseColor = 1710
 #endif
 #if ENABLE(DATALIST_ELEMENT)
-    , WebPage_DidSelectDataListOption = 1709
+    , WebPage_DidSelectDataListOption = 1711
 #endif
 #if ENABLE(DATALIST_ELEMENT)
-    , WebPage_DidCloseSuggestions = 1710
+    , WebPage_DidCloseSuggestions = 1712
 #endif
 #if ENABLE(CONTEXT_MENUS)
-    , WebPage_ContextMenuHidden = 1711
+    , WebPage_ContextMenuHidden = 1713
 #endif
 #if ENABLE(CONTEXT_MENUS)
-    , WebPage_ContextMenuForKeyEvent = 1712
-#endif
-    , WebPage_ScrollBy = 1713
-    , WebPage_CenterSelectionInVisibleArea = 1714
-    , WebPage_GoToBackForwardItem = 1715
-    , WebPage_TryRestoreScrollPosition = 1716
-    , WebPage_LoadURLInFrame = 1717
-    , WebPage_LoadDataInFrame = 1718
-    , WebPage_LoadRequest = 1719
-    , WebPage_LoadRequestWaitingForProcessLaunch = 1720
-    , WebPage_LoadData = 1721
-    , WebPage_LoadAlternateHTML = 1722
-    , WebPage_NavigateToPDFLinkWithSimulatedClick = 1723
-    , WebPage_Reload = 1724
-    , WebPage_StopLoading = 1725
-    , WebPage_StopLoadingFrame = 1726
-    , WebPage_RestoreSession = 1727
-    , WebPage_UpdateBackForwardListForReattach = 1728
-    , WebPage_SetCurrentHistoryItemForReattach = 1729
-    , WebPage_DidRemoveBackForwardItem = 1730
-    , WebPage_UpdateWebsitePolicies = 1731
-    , WebPage_NotifyUserScripts = 1732
-    , WebPage_DidReceivePolicyDecision = 1733
-    , WebPage_ContinueWillSubmitForm = 1734
-    , WebPage_ClearSelection = 1735
-    , WebPage_RestoreSelectionInFocusedEditableElement = 1736
-    , WebPage_GetContentsAsString = 1737
-    , WebPage_GetAllFrames = 1738
-    , WebPage_GetAllFramesReply = 1739
-#if PLATFORM(COCOA)
-    , WebPage_GetContentsAsAttributedString = 1740
-    , WebPage_GetContentsAsAttributedStringReply = 1741
+    , WebPage_ContextMenuForKeyEvent = 1714
+#endif
+    , WebPage_ScrollBy = 1715
+    , WebPage_CenterSelectionInVisibleArea = 1716
+    , WebPage_GoToBackForwardItem = 1717
+    , WebPage_TryRestoreScrollPosition = 1718
+    , WebPage_LoadURLInFrame = 1719
+    , WebPage_LoadDataInFrame = 1720
+    , WebPage_LoadRequest = 1721
+    , WebPage_LoadRequestWaitingForProcessLaunch = 1722
+    , WebPage_LoadData = 1723
+    , WebPage_LoadAlternateHTML = 1724
+    , WebPage_NavigateToPDFLinkWithSimulatedClick = 1725
+    , WebPage_Reload = 1726
+    , WebPage_StopLoading = 1727
+    , WebPage_StopLoadingFrame = 1728
+    , WebPage_RestoreSession = 1729
+    , WebPage_UpdateBackForwardListForReattach = 1730
+    , WebPage_SetCurrentHistoryItemForReattach = 1731
+    , WebPage_DidRemoveBackForwardItem = 1732
+    , WebPage_UpdateWebsitePolicies = 1733
+    , WebPage_NotifyUserScripts = 1734
+    , WebPage_DidReceivePolicyDecision = 1735
+    , WebPage_ContinueWillSubmitForm = 1736
+    , WebPage_ClearSelection = 1737
+    , WebPage_RestoreSelectionInFocusedEditableElement = 1738
+    , WebPage_GetContentsAsString = 1739
+    , WebPage_GetAllFrames = 1740
+    , WebPage_GetAllFramesReply = 1741
+#if PLATFORM(COCOA)
+    , WebPage_GetContentsAsAttributedString = 1742
+    , WebPage_GetContentsAsAttributedStringReply = 1743
 #endif
 #if ENABLE(MHTML)
-    , WebPage_GetContentsAsMHTMLData = 1742
+    , WebPage_GetContentsAsMHTMLData = 1744
 #endif
-    , WebPage_GetMainResourceDataOfFrame = 1743
-    , WebPage_GetResourceDataFromFrame = 1744
-    , WebPage_GetRenderTreeExternalRepresentation = 1745
-    , WebPage_GetSelectionOrContentsAsString = 1746
-    , WebPage_GetSelectionAsWebArchiveData = 1747
-    , WebPage_GetSourceForFrame = 1748
-    , WebPage_GetWebArchiveOfFrame = 1749
-    , WebPage_RunJavaScriptInFrameInScriptWorld = 1750
-    , WebPage_ForceRepaint = 1751
-    , WebPage_SelectAll = 1752
-    , WebPage_ScheduleFullEditorStateUpdate = 1753
+    , WebPage_GetMainResourceDataOfFrame = 1745
+    , WebPage_GetResourceDataFromFrame = 1746
+    , WebPage_GetRenderTreeExternalRepresentation = 1747
+    , WebPage_GetSelectionOrContentsAsString = 1748
+    , WebPage_GetSelectionAsWebArchiveData = 1749
+    , WebPage_GetSourceForFrame = 1750
+    , WebPage_GetWebArchiveOfFrame = 1751
+    , WebPage_RunJavaScriptInFrameInScriptWorld = 1752
+    , WebPage_ForceRepaint = 1753
+    , WebPage_SelectAll = 1754
+    , WebPage_ScheduleFullEditorStateUpdate = 1755
 #if PLATFORM(COCOA)
-    , WebPage_PerformDictionaryLookupOfCurrentSelection = 1754
+    , WebPage_PerformDictionaryLookupOfCurrentSelection = 1756
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_PerformDictionaryLookupAtLocation = 1755
+    , WebPage_PerformDictionaryLookupAtLocation = 1757
 #endif
 #if ENABLE(DATA_DETECTION)
-    , WebPage_DetectDataInAllFrames = 1756
-    , WebPage_DetectDataInAllFramesReply = 1757
+    , WebPage_DetectDataInAllFrames = 1758
+    , WebPage_DetectDataInAllFramesReply = 1759
 #endif
 #if ENABLE(DATA_DETECTION)
-    , WebPage_RemoveDataDetectedLinks = 1758
-    , WebPage_RemoveDataDetectedLinksReply = 1759
-#endif
-    , WebPage_ChangeFont = 1760
-    , WebPage_ChangeFontAttributes = 1761
-    , WebPage_PreferencesDidChange = 1762
-    , WebPage_SetUserAgent = 1763
-    , WebPage_SetCustomTextEncodingName = 1764
-    , WebPage_SuspendActiveDOMObjectsAndAnimations = 1765
-    , WebPage_ResumeActiveDOMObjectsAndAnimations = 1766
-    , WebPage_Close = 1767
-    , WebPage_TryClose = 1768
-    , WebPage_TryCloseReply = 1769
-    , WebPage_SetEditable = 1770
-    , WebPage_ValidateCommand = 1771
-    , WebPage_ExecuteEditCommand = 1772
-    , WebPage_IncreaseListLevel = 1773
-    , WebPage_DecreaseListLevel = 1774
-    , WebPage_ChangeListType = 1775
-    , WebPage_SetBaseWritingDirection = 1776
-    , WebPage_SetNeedsFontAttributes = 1777
-    , WebPage_RequestFontAttributesAtSelectionStart = 1778
-    , WebPage_DidRemoveEditCommand = 1779
-    , WebPage_ReapplyEditCommand = 1780
-    , WebPage_UnapplyEditCommand = 1781
-    , WebPage_SetPageAndTextZoomFactors = 1782
-    , WebPage_SetPageZoomFactor = 1783
-    , WebPage_SetTextZoomFactor = 1784
-    , WebPage_WindowScreenDidChange = 1785
-    , WebPage_AccessibilitySettingsDidChange = 1786
-    , WebPage_ScalePage = 1787
-    , WebPage_ScalePageInViewCoordinates = 1788
-    , WebPage_ScaleView = 1789
-    , WebPage_SetUseFixedLayout = 1790
-    , WebPage_SetFixedLayoutSize = 1791
-    , WebPage_ListenForLayoutMilestones = 1792
-    , WebPage_SetSuppressScrollbarAnimations = 1793
-    , WebPage_SetEnableVerticalRubberBanding = 1794
-    , WebPage_SetEnableHorizontalRubberBanding = 1795
-    , WebPage_SetBackgroundExtendsBeyondPage = 1796
-    , WebPage_SetPaginationMode = 1797
-    , WebPage_SetPaginationBehavesLikeColumns = 1798
-    , WebPage_SetPageLength = 1799
-    , WebPage_SetGapBetweenPages = 1800
-    , WebPage_SetPaginationLineGridEnabled = 1801
-    , WebPage_PostInjectedBundleMessage = 1802
-    , WebPage_FindString = 1803
-    , WebPage_FindStringMatches = 1804
-    , WebPage_GetImageForFindMatch = 1805
-    , WebPage_SelectFindMatch = 1806
-    , WebPage_IndicateFindMatch = 1807
-    , WebPage_HideFindUI = 1808
-    , WebPage_CountStringMatches = 1809
-    , WebPage_ReplaceMatches = 1810
-    , WebPage_AddMIMETypeWithCustomContentProvider = 1811
+    , WebPage_RemoveDataDetectedLinks = 1760
+    , WebPage_RemoveDataDetectedLinksReply = 1761
+#endif
+    , WebPage_ChangeFont = 1762
+    , WebPage_ChangeFontAttributes = 1763
+    , WebPage_PreferencesDidChange = 1764
+    , WebPage_SetUserAgent = 1765
+    , WebPage_SetCustomTextEncodingName = 1766
+    , WebPage_SuspendActiveDOMObjectsAndAnimations = 1767
+    , WebPage_ResumeActiveDOMObjectsAndAnimations = 1768
+    , WebPage_Close = 1769
+    , WebPage_TryClose = 1770
+    , WebPage_TryCloseReply = 1771
+    , WebPage_SetEditable = 1772
+    , WebPage_ValidateCommand = 1773
+    , WebPage_ExecuteEditCommand = 1774
+    , WebPage_IncreaseListLevel = 1775
+    , WebPage_DecreaseListLevel = 1776
+    , WebPage_ChangeListType = 1777
+    , WebPage_SetBaseWritingDirection = 1778
+    , WebPage_SetNeedsFontAttributes = 1779
+    , WebPage_RequestFontAttributesAtSelectionStart = 1780
+    , WebPage_DidRemoveEditCommand = 1781
+    , WebPage_ReapplyEditCommand = 1782
+    , WebPage_UnapplyEditCommand = 1783
+    , WebPage_SetPageAndTextZoomFactors = 1784
+    , WebPage_SetPageZoomFactor = 1785
+    , WebPage_SetTextZoomFactor = 1786
+    , WebPage_WindowScreenDidChange = 1787
+    , WebPage_AccessibilitySettingsDidChange = 1788
+    , WebPage_ScalePage = 1789
+    , WebPage_ScalePageInViewCoordinates = 1790
+    , WebPage_ScaleView = 1791
+    , WebPage_SetUseFixedLayout = 1792
+    , WebPage_SetFixedLayoutSize = 1793
+    , WebPage_ListenForLayoutMilestones = 1794
+    , WebPage_SetSuppressScrollbarAnimations = 1795
+    , WebPage_SetEnableVerticalRubberBanding = 1796
+    , WebPage_SetEnableHorizontalRubberBanding = 1797
+    , WebPage_SetBackgroundExtendsBeyondPage = 1798
+    , WebPage_SetPaginationMode = 1799
+    , WebPage_SetPaginationBehavesLikeColumns = 1800
+    , WebPage_SetPageLength = 1801
+    , WebPage_SetGapBetweenPages = 1802
+    , WebPage_SetPaginationLineGridEnabled = 1803
+    , WebPage_PostInjectedBundleMessage = 1804
+    , WebPage_FindString = 1805
+    , WebPage_FindStringMatches = 1806
+    , WebPage_GetImageForFindMatch = 1807
+    , WebPage_SelectFindMatch = 1808
+    , WebPage_IndicateFindMatch = 1809
+    , WebPage_HideFindUI = 1810
+    , WebPage_CountStringMatches = 1811
+    , WebPage_ReplaceMatches = 1812
+    , WebPage_AddMIMETypeWithCustomContentProvider = 1813
 #if (PLATFORM(GTK) || PLATFORM(HBD)) && ENABLE(DRAG_SUPPORT)
-    , WebPage_PerformDragControllerAction = 1812
+    , WebPage_PerformDragControllerAction = 1814
 #endif
 #if !PLATFORM(GTK) && !PLATFORM(HBD) && ENABLE(DRAG_SUPPORT)
-    , WebPage_PerformDragControllerAction = 1813
+    , WebPage_PerformDragControllerAction = 1815
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPage_DidStartDrag = 1814
+    , WebPage_DidStartDrag = 1816
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPage_DragEnded = 1815
+    , WebPage_DragEnded = 1817
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPage_DragCancelled = 1816
+    , WebPage_DragCancelled = 1818
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_RequestDragStart = 1817
+    , WebPage_RequestDragStart = 1819
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_RequestAdditionalItemsForDragSession = 1818
+    , WebPage_RequestAdditionalItemsForDragSession = 1820
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_InsertDroppedImagePlaceholders = 1819
-    , WebPage_InsertDroppedImagePlaceholdersReply = 1820
+    , WebPage_InsertDroppedImagePlaceholders = 1821
+    , WebPage_InsertDroppedImagePlaceholdersReply = 1822
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_DidConcludeDrop = 1821
+    , WebPage_DidConcludeDrop = 1823
 #endif
-    , WebPage_DidChangeSelectedIndexForActivePopupMenu = 1822
-    , WebPage_SetTextForActivePopupMenu = 1823
+    , WebPage_DidChangeSelectedIndexForActivePopupMenu = 1824
+    , WebPage_SetTextForActivePopupMenu = 1825
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPage_FailedToShowPopupMenu = 1824
+    , WebPage_FailedToShowPopupMenu = 1826
 #endif
 #if ENABLE(CONTEXT_MENUS)
-    , WebPage_DidSelectItemFromActiveContextMenu = 1825
+    , WebPage_DidSelectItemFromActiveContextMenu = 1827
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_DidChooseFilesForOpenPanelWithDisplayStringAndIcon = 1826
+    , WebPage_DidChooseFilesForOpenPanelWithDisplayStringAndIcon = 1828
 #endif
-    , WebPage_DidChooseFilesForOpenPanel = 1827
-    , WebPage_DidCancelForOpenPanel = 1828
+    , WebPage_DidChooseFilesForOpenPanel = 1829
+    , WebPage_DidCancelForOpenPanel = 1830
 #if ENABLE(SANDBOX_EXTENSIONS)
-    , WebPage_ExtendSandboxForFilesFromOpenPanel = 1829
+    , WebPage_ExtendSandboxForFilesFromOpenPanel = 1831
 #endif
-    , WebPage_AdvanceToNextMisspelling = 1830
-    , WebPage_ChangeSpellingToWord = 1831
-    , WebPage_DidFinishCheckingText = 1832
-    , WebPage_DidCancelCheckingText = 1833
+    , WebPage_AdvanceToNextMisspelling = 1832
+    , WebPage_ChangeSpellingToWord = 1833
+    , WebPage_DidFinishCheckingText = 1834
+    , WebPage_DidCancelCheckingText = 1835
 #if USE(APPKIT)
-    , WebPage_UppercaseWord = 1834
+    , WebPage_UppercaseWord = 1836
 #endif
 #if USE(APPKIT)
-    , WebPage_LowercaseWord = 1835
+    , WebPage_LowercaseWord = 1837
 #endif
 #if USE(APPKIT)
-    , WebPage_CapitalizeWord = 1836
+    , WebPage_CapitalizeWord = 1838
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetSmartInsertDeleteEnabled = 1837
+    , WebPage_SetSmartInsertDeleteEnabled = 1839
 #endif
 #if ENABLE(GEOLOCATION)
-    , WebPage_DidReceiveGeolocationPermissionDecision = 1838
+    , WebPage_DidReceiveGeolocationPermissionDecision = 1840
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPage_UserMediaAccessWasGranted = 1839
-    , WebPage_UserMediaAccessWasGrantedReply = 1840
+    , WebPage_UserMediaAccessWasGranted = 1841
+    , WebPage_UserMediaAccessWasGrantedReply = 1842
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPage_UserMediaAccessWasDenied = 1841
+    , WebPage_UserMediaAccessWasDenied = 1843
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPage_CaptureDevicesChanged = 1842
+    , WebPage_CaptureDevicesChanged = 1844
 #endif
-    , WebPage_StopAllMediaPlayback = 1843
-    , WebPage_SuspendAllMediaPlayback = 1844
-    , WebPage_ResumeAllMediaPlayback = 1845
-    , WebPage_DidReceiveNotificationPermissionDecision = 1846
-    , WebPage_FreezeLayerTreeDueToSwipeAnimation = 1847
-    , WebPage_UnfreezeLayerTreeDueToSwipeAnimation = 1848
-    , WebPage_BeginPrinting = 1849
-    , WebPage_EndPrinting = 1850
-    , WebPage_ComputePagesForPrinting = 1851
+    , WebPage_StopAllMediaPlayback = 1845
+    , WebPage_SuspendAllMediaPlayback = 1846
+    , WebPage_ResumeAllMediaPlayback = 1847
+    , WebPage_DidReceiveNotificationPermissionDecision = 1848
+    , WebPage_FreezeLayerTreeDueToSwipeAnimation = 1849
+    , WebPage_UnfreezeLayerTreeDueToSwipeAnimation = 1850
+    , WebPage_BeginPrinting = 1851
+    , WebPage_EndPrinting = 1852
+    , WebPage_ComputePagesForPrinting = 1853
 #if PLATFORM(COCOA)
-    , WebPage_DrawRectToImage = 1852
+    , WebPage_DrawRectToImage = 1854
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_DrawPagesToPDF = 1853
+    , WebPage_DrawPagesToPDF = 1855
 #endif
 #if (PLATFORM(COCOA) && PLATFORM(IOS_FAMILY))
-    , WebPage_ComputePagesForPrintingAndDrawToPDF = 1854
+    , WebPage_ComputePagesForPrintingAndDrawToPDF = 1856
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_DrawToPDF = 1855
+    , WebPage_DrawToPDF = 1857
 #endif
 #if PLATFORM(GTK)
-    , WebPage_DrawPagesForPrinting = 1856
+    , WebPage_DrawPagesForPrinting = 1858
 #endif
-    , WebPage_SetMediaVolume = 1857
-    , WebPage_SetMuted = 1858
-    , WebPage_SetMayStartMediaWhenInWindow = 1859
-    , WebPage_StopMediaCapture = 1860
+    , WebPage_SetMediaVolume = 1859
+    , WebPage_SetMuted = 1860
+    , WebPage_SetMayStartMediaWhenInWindow = 1861
+    , WebPage_StopMediaCapture = 1862
 #if ENABLE(MEDIA_SESSION)
-    , WebPage_HandleMediaEvent = 1861
+    , WebPage_HandleMediaEvent = 1863
 #endif
 #if ENABLE(MEDIA_SESSION)
-    , WebPage_SetVolumeOfMediaElement = 1862
+    , WebPage_SetVolumeOfMediaElement = 1864
 #endif
-    , WebPage_SetCanRunBeforeUnloadConfirmPanel = 1863
-    , WebPage_SetCanRunModal = 1864
+    , WebPage_SetCanRunBeforeUnloadConfirmPanel = 1865
+    , WebPage_SetCanRunModal = 1866
 #if PLATFORM(GTK) || PLATFORM(WPE) || PLATFORM(HBD)
-    , WebPage_CancelComposition = 1865
+    , WebPage_CancelComposition = 1867
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE) || PLATFORM(HBD)
-    , WebPage_DeleteSurrounding = 1866
+    , WebPage_DeleteSurrounding = 1868
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPage_CollapseSelectionInFrame = 1867
+    , WebPage_CollapseSelectionInFrame = 1869
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPage_GetCenterForZoomGesture = 1868
+    , WebPage_GetCenterForZoomGesture = 1870
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SendComplexTextInputToPlugin = 1869
+    , WebPage_SendComplexTextInputToPlugin = 1871
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_WindowAndViewFramesChanged = 1870
+    , WebPage_WindowAndViewFramesChanged = 1872
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetMainFrameIsScrollable = 1871
+    , WebPage_SetMainFrameIsScrollable = 1873
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_RegisterUIProcessAccessibilityTokens = 1872
+    , WebPage_RegisterUIProcessAccessibilityTokens = 1874
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetStringSelectionForPasteboard = 1873
+    , WebPage_GetStringSelectionForPasteboard = 1875
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetDataSelectionForPasteboard = 1874
+    , WebPage_GetDataSelectionForPasteboard = 1876
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_ReadSelectionFromPasteboard = 1875
+    , WebPage_ReadSelectionFromPasteboard = 1877
 #endif
 #if (PLATFORM(COCOA) && ENABLE(SERVICE_CONTROLS))
-    , WebPage_ReplaceSelectionWithPasteboardData = 1876
+    , WebPage_ReplaceSelectionWithPasteboardData = 1878
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_ShouldDelayWindowOrderingEvent = 1877
+    , WebPage_ShouldDelayWindowOrderingEvent = 1879
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_AcceptsFirstMouse = 1878
+    , WebPage_AcceptsFirstMouse = 1880
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetTextAsync = 1879
+    , WebPage_SetTextAsync = 1881
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_InsertTextAsync = 1880
+    , WebPage_InsertTextAsync = 1882
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_InsertDictatedTextAsync = 1881
+    , WebPage_InsertDictatedTextAsync = 1883
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_HasMarkedText = 1882
-    , WebPage_HasMarkedTextReply = 1883
+    , WebPage_HasMarkedText = 1884
+    , WebPage_HasMarkedTextReply = 1885
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetMarkedRangeAsync = 1884
+    , WebPage_GetMarkedRangeAsync = 1886
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetSelectedRangeAsync = 1885
+    , WebPage_GetSelectedRangeAsync = 1887
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_CharacterIndexForPointAsync = 1886
+    , WebPage_CharacterIndexForPointAsync = 1888
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_FirstRectForCharacterRangeAsync = 1887
+    , WebPage_FirstRectForCharacterRangeAsync = 1889
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetCompositionAsync = 1888
+    , WebPage_SetCompositionAsync = 1890
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_ConfirmCompositionAsync = 1889
+    , WebPage_ConfirmCompositionAsync = 1891
 #endif
 #if PLATFORM(MAC)
-    , WebPage_AttributedSubstringForCharacterRangeAsync = 1890
+    , WebPage_AttributedSubstringForCharacterRangeAsync = 1892
 #endif
 #if PLATFORM(MAC)
-    , WebPage_FontAtSelection = 1891
+    , WebPage_FontAtSelection = 1893
 #endif
-    , WebPage_SetAlwaysShowsHorizontalScroller = 1892
-    , WebPage_SetAlwaysShowsVerticalScroller = 1893
-    , WebPage_SetMinimumSizeForAutoLayout = 1894
-    , WebPage_SetSizeToContentAutoSizeMaximumSize = 1895
-    , WebPage_SetAutoSizingShouldExpandToViewHeight = 1896
-    , WebPage_SetViewportSizeForCSSViewportUnits = 1897
+    , WebPage_SetAlwaysShowsHorizontalScroller = 1894
+    , WebPage_SetAlwaysShowsVerticalScroller = 1895
+    , WebPage_SetMinimumSizeForAutoLayout = 1896
+    , WebPage_SetSizeToContentAutoSizeMaximumSize = 1897
+    , WebPage_SetAutoSizingShouldExpandToViewHeight = 1898
+    , WebPage_SetViewportSizeForCSSViewportUnits = 1899
 #if PLATFORM(COCOA)
-    , WebPage_HandleAlternativeTextUIResult = 1898
+    , WebPage_HandleAlternativeTextUIResult = 1900
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_WillStartUserTriggeredZooming = 1899
+    , WebPage_WillStartUserTriggeredZooming = 1901
 #endif
-    , WebPage_SetScrollPinningBehavior = 1900
-    , WebPage_SetScrollbarOverlayStyle = 1901
-    , WebPage_GetBytecodeProfile = 1902
-    , WebPage_GetSamplingProfilerOutput = 1903
-    , WebPage_TakeSnapshot = 1904
+    , WebPage_SetScrollPinningBehavior = 1902
+    , WebPage_SetScrollbarOverlayStyle = 1903
+    , WebPage_GetBytecodeProfile = 1904
+    , WebPage_GetSamplingProfilerOutput = 1905
+    , WebPage_TakeSnapshot = 1906
 #if PLATFORM(MAC)
-    , WebPage_PerformImmediateActionHitTestAtLocation = 1905
+    , WebPage_PerformImmediateActionHitTestAtLocation = 1907
 #endif
 #if PLATFORM(MAC)
-    , WebPage_ImmediateActionDidUpdate = 1906
+    , WebPage_ImmediateActionDidUpdate = 1908
 #endif
 #if PLATFORM(MAC)
-    , WebPage_ImmediateActionDidCancel = 1907
+    , WebPage_ImmediateActionDidCancel = 1909
 #endif
 #if PLATFORM(MAC)
-    , WebPage_ImmediateActionDidComplete = 1908
+    , WebPage_ImmediateActionDidComplete = 1910
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DataDetectorsDidPresentUI = 1909
+    , WebPage_DataDetectorsDidPresentUI = 1911
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DataDetectorsDidChangeUI = 1910
+    , WebPage_DataDetectorsDidChangeUI = 1912
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DataDetectorsDidHideUI = 1911
+    , WebPage_DataDetectorsDidHideUI = 1913
 #endif
 #if PLATFORM(MAC)
-    , WebPage_HandleAcceptedCandidate = 1912
+    , WebPage_HandleAcceptedCandidate = 1914
 #endif
 #if PLATFORM(MAC)
-    , WebPage_SetUseSystemAppearance = 1913
+    , WebPage_SetUseSystemAppearance = 1915
 #endif
 #if PLATFORM(MAC)
-    , WebPage_SetHeaderBannerHeightForTesting = 1914
+    , WebPage_SetHeaderBannerHeightForTesting = 1916
 #endif
 #if PLATFORM(MAC)
-    , WebPage_SetFooterBannerHeightForTesting = 1915
+    , WebPage_SetFooterBannerHeightForTesting = 1917
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DidEndMagnificationGesture = 1916
+    , WebPage_DidEndMagnificationGesture = 1918
 #endif
-    , WebPage_EffectiveAppearanceDidChange = 1917
+    , WebPage_EffectiveAppearanceDidChange = 1919
 #if PLATFORM(GTK)
-    , WebPage_ThemeDidChange = 1918
+    , WebPage_ThemeDidChange = 1920
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_RequestActiveNowPlayingSessionInfo = 1919
+    , WebPage_RequestActiveNowPlayingSessionInfo = 1921
 #endif
-    , WebPage_SetShouldDispatchFakeMouseMoveEvents = 1920
+    , WebPage_SetShouldDispatchFakeMouseMoveEvents = 1922
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_PlaybackTargetSelected = 1921
+    , WebPage_PlaybackTargetSelected = 1923
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_PlaybackTargetAvailabilityDidChange = 1922
+    , WebPage_PlaybackTargetAvailabilityDidChange = 1924
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_SetShouldPlayToPlaybackTarget = 1923
+    , WebPage_SetShouldPlayToPlaybackTarget = 1925
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_PlaybackTargetPickerWasDismissed = 1924
+    , WebPage_PlaybackTargetPickerWasDismissed = 1926
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPage_DidAcquirePointerLock = 1925
+    , WebPage_DidAcquirePointerLock = 1927
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPage_DidNotAcquirePointerLock = 1926
+    , WebPage_DidNotAcquirePointerLock = 1928
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPage_DidLosePointerLock = 1927
+    , WebPage_DidLosePointerLock = 1929
 #endif
-    , WebPage_clearWheelEventTestMonitor = 1928
-    , WebPage_SetShouldScaleViewToFitDocument = 1929
+    , WebPage_clearWheelEventTestMonitor = 1930
+    , WebPage_SetShouldScaleViewToFitDocument = 1931
 #if ENABLE(VIDEO) && USE(GSTREAMER)
-    , WebPage_DidEndRequestInstallMissingMediaPlugins = 1930
+    , WebPage_DidEndRequestInstallMissingMediaPlugins = 1932
 #endif
-    , WebPage_SetUserInterfaceLayoutDirection = 1931
-    , WebPage_DidGetLoadDecisionForIcon = 1932
-    , WebPage_SetUseIconLoadingClient = 1933
+    , WebPage_SetUserInterfaceLayoutDirection = 1933
+    , WebPage_DidGetLoadDecisionForIcon = 1934
+    , WebPage_SetUseIconLoadingClient = 1935
 #if ENABLE(GAMEPAD)
-    , WebPage_GamepadActivity = 1934
-#endif
-    , WebPage_FrameBecameRemote = 1935
-    , WebPage_RegisterURLSchemeHandler = 1936
-    , WebPage_URLSchemeTaskDidPerformRedirection = 1937
-    , WebPage_URLSchemeTaskDidReceiveResponse = 1938
-    , WebPage_URLSchemeTaskDidReceiveData = 1939
-    , WebPage_URLSchemeTaskDidComplete = 1940
-    , WebPage_SetIsSuspended = 1941
+    , WebPage_GamepadActivity = 1936
+#endif
+    , WebPage_FrameBecameRemote = 1937
+    , WebPage_RegisterURLSchemeHandler = 1938
+    , WebPage_URLSchemeTaskDidPerformRedirection = 1939
+    , WebPage_URLSchemeTaskDidReceiveResponse = 1940
+    , WebPage_URLSchemeTaskDidReceiveData = 1941
+    , WebPage_URLSchemeTaskDidComplete = 1942
+    , WebPage_SetIsSuspended = 1943
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPage_InsertAttachment = 1942
+    , WebPage_InsertAttachment = 1944
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPage_UpdateAttachmentAttributes = 1943
+    , WebPage_UpdateAttachmentAttributes = 1945
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPage_UpdateAttachmentIcon = 1944
+    , WebPage_UpdateAttachmentIcon = 1946
 #endif
 #if ENABLE(APPLICATION_MANIFEST)
-    , WebPage_GetApplicationManifest = 1945
+    , WebPage_GetApplicationManifest = 1947
 #endif
-    , WebPage_SetDefersLoading = 1946
-    , WebPage_UpdateCurrentModifierState = 1947
-    , WebPage_SimulateDeviceOrientationChange = 1948
+    , WebPage_SetDefersLoading = 1948
+    , WebPage_UpdateCurrentModifierState = 1949
+    , WebPage_SimulateDeviceOrientationChange = 1950
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPage_SpeakingErrorOccurred = 1949
+    , WebPage_SpeakingErrorOccurred = 1951
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPage_BoundaryEventOccurred = 1950
+    , WebPage_BoundaryEventOccurred = 1952
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPage_VoicesDidChange = 1951
+    , WebPage_VoicesDidChange = 1953
 #endif
-    , WebPage_SetCanShowPlaceholder = 1952
+    , WebPage_SetCanShowPlaceholder = 1954
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebPage_WasLoadedWithDataTransferFromPrevalentResource = 1953
+    , WebPage_WasLoadedWithDataTransferFromPrevalentResource = 1955
 #endif
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebPage_ClearLoadedThirdPartyDomains = 1954
+    , WebPage_ClearLoadedThirdPartyDomains = 1956
 #endif
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebPage_LoadedThirdPartyDomains = 1955
-    , WebPage_LoadedThirdPartyDomainsReply = 1956
+    , WebPage_LoadedThirdPartyDomains = 1957
+    , WebPage_LoadedThirdPartyDomainsReply = 1958
 #endif
 #if USE(SYSTEM_PREVIEW)
-    , WebPage_SystemPreviewActionTriggered = 1957
+    , WebPage_SystemPreviewActionTriggered = 1959
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE)
-    , WebPage_SendMessageToWebExtension = 1958
+    , WebPage_SendMessageToWebExtension = 1960
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE)
-    , WebPage_SendMessageToWebExtensionWithReply = 1959
-    , WebPage_SendMessageToWebExtensionWithReplyReply = 1960
-#endif
-    , WebPage_StartTextManipulations = 1961
-    , WebPage_StartTextManipulationsReply = 1962
-    , WebPage_CompleteTextManipulation = 1963
-    , WebPage_CompleteTextManipulationReply = 1964
-    , WebPage_SetOverriddenMediaType = 1965
-    , WebPage_GetProcessDisplayName = 1966
-    , WebPage_GetProcessDisplayNameReply = 1967
-    , WebPage_UpdateCORSDisablingPatterns = 1968
-    , WebPage_SetShouldFireEvents = 1969
-    , WebPage_SetNeedsDOMWindowResizeEvent = 1970
-    , WebPage_SetHasResourceLoadClient = 1971
-    , StorageAreaMap_DidSetItem = 1972
-    , StorageAreaMap_DidRemoveItem = 1973
-    , StorageAreaMap_DidClear = 1974
-    , StorageAreaMap_DispatchStorageEvent = 1975
-    , StorageAreaMap_ClearCache = 1976
+    , WebPage_SendMessageToWebExtensionWithReply = 1961
+    , WebPage_SendMessageToWebExtensionWithReplyReply = 1962
+#endif
+    , WebPage_StartTextManipulations = 1963
+    , WebPage_StartTextManipulationsReply = 1964
+    , WebPage_CompleteTextManipulation = 1965
+    , WebPage_CompleteTextManipulationReply = 1966
+    , WebPage_SetOverriddenMediaType = 1967
+    , WebPage_GetProcessDisplayName = 1968
+    , WebPage_GetProcessDisplayNameReply = 1969
+    , WebPage_UpdateCORSDisablingPatterns = 1970
+    , WebPage_SetShouldFireEvents = 1971
+    , WebPage_SetNeedsDOMWindowResizeEvent = 1972
+    , WebPage_SetHasResourceLoadClient = 1973
+    , StorageAreaMap_DidSetItem = 1974
+    , StorageAreaMap_DidRemoveItem = 1975
+    , StorageAreaMap_DidClear = 1976
+    , StorageAreaMap_DispatchStorageEvent = 1977
+    , StorageAreaMap_ClearCache = 1978
 #if PLATFORM(MAC)
-    , ViewGestureController_DidCollectGeometryForMagnificationGesture = 1977
+    , ViewGestureController_DidCollectGeometryForMagnificationGesture = 1979
 #endif
 #if PLATFORM(MAC)
-    , ViewGestureController_DidCollectGeometryForSmartMagnificationGesture = 1978
+    , ViewGestureController_DidCollectGeometryForSmartMagnificationGesture = 1980
 #endif
 #if !PLATFORM(IOS_FAMILY)
-    , ViewGestureController_DidHitRenderTreeSizeThreshold = 1979
+    , ViewGestureController_DidHitRenderTreeSizeThreshold = 1981
 #endif
 #if PLATFORM(COCOA)
-    , ViewGestureGeometryCollector_CollectGeometryForSmartMagnificationGesture = 1980
+    , ViewGestureGeometryCollector_CollectGeometryForSmartMagnificationGesture = 1982
 #endif
 #if PLATFORM(MAC)
-    , ViewGestureGeometryCollector_CollectGeometryForMagnificationGesture = 1981
+    , ViewGestureGeometryCollector_CollectGeometryForMagnificationGesture = 1983
 #endif
 #if !PLATFORM(IOS_FAMILY)
-    , ViewGestureGeometryCollector_SetRenderTreeSizeNotificationThreshold = 1982
+    , ViewGestureGeometryCollector_SetRenderTreeSizeNotificationThreshold = 1984
 #endif
-    , WrappedAsyncMessageForTesting = 1983
-    , SyncMessageReply = 1984
-    , InitializeConnection = 1985
-    , LegacySessionState = 1986
+    , WrappedAsyncMessageForTesting = 1985
+    , SyncMessageReply = 1986
+    , InitializeConnection = 1987
+    , LegacySessionState = 1988
 };
 
 ReceiverName receiverName(MessageName);
@@ -513,12 +513,19 @@ pchtml_html_parse_chunk_end(pchtml_html_parser_t *parser)
     return parser->status;
 }
 
+/* The serializer emits many tiny pieces (tag names, quotes, escaped runs);
+   they are staged in this buffer and handed to the writer in large blocks. */
+#define SERIALIZER_BUF_SIZE     4096
+
 struct serializer_data {
     size_t       nr;
     void        *ctxt;
     int (*writer)(const char *buf, size_t nr, int oom, void *ctxt);
 
     int oom; // -1: out of memory
+
+    size_t       pos;
+    char         buf[SERIALIZER_BUF_SIZE];
 };
 
 static inline int
@@ -537,31 +544,33 @@ rwstream_writer(const char *data, size_t nr, int oom, void *ctxt)
     return 0;
 }
 
-static inline unsigned int
+static inline void
+serializer_flush(struct serializer_data *ud)
+{
+    if (ud->pos > 0) {
+        ud->oom = ud->writer(ud->buf, ud->pos, ud->oom, ud->ctxt);
+        ud->pos = 0;
+    }
+}
+
+static unsigned int
 serializer_callback(const unsigned char  *data, size_t len, void *ctxt)
 {
     struct serializer_data *ud = (struct serializer_data*)ctxt;
 
-    char buf[1024];
-    size_t nr = sizeof(buf);
-    buf[0] = '\0';
-    char *p = pcutils_snprintf(buf, &nr, "%.*s", (int)len, (const char *)data);
-    PC_ASSERT((int64_t)nr>=0);
-    ud->nr += nr;
-
-    if (p == NULL) {
-        if (ud->oom == 0) {
-            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    ud->nr += len;
+    if (ud->pos + len > sizeof(ud->buf)) {
+        serializer_flush(ud);
+
+        /* too large to stage */
+        if (len >= sizeof(ud->buf)) {
+            ud->oom = ud->writer((const char *)data, len, ud->oom, ud->ctxt);
+            return PCHTML_STATUS_OK;
         }
-        ud->oom = -1;
-        return PCHTML_STATUS_OK;
     }
 
-    ud->oom = ud->writer(p, nr, ud->oom, ud->ctxt);
-
-    if (p != buf)
-        free(p);
-
+    memcpy(ud->buf + ud->pos, data, len);
+    ud->pos += len;
     return PCHTML_STATUS_OK;
 }
 
@@ -574,11 +583,13 @@ pchtml_doc_write_to_stream_ex(pchtml_html_document_t *doc,
         .ctxt           = out,
         .writer         = rwstream_writer,
         .oom            = 0,
+        .pos            = 0,
     };
     unsigned int status;
     status = pchtml_html_serialize_pretty_tree_cb((pcdom_node_t *)doc,
             opt, 0, serializer_callback, &ud);
     PC_ASSERT(status==PCHTML_STATUS_OK);
+    serializer_flush(&ud);
 
     return ud.oom ? -1 : 0;
 }
@@ -605,14 +616,17 @@ buffer_writer(const char *data, size_t nr, int oom, void *ctxt)
         return oom;
 
     if (bd->pos + nr + 1 >= bd->sz) {
+        /* grow geometrically to keep the number of reallocations small */
         size_t align_sz = bd->pos + nr + 1;
+        if (align_sz < bd->sz * 2)
+            align_sz = bd->sz * 2;
         align_sz = (align_sz + 63) / 64 * 64; // bit operation?
         char *buf;
         if (bd->buf == bd->orig_buf) {
             buf = (char*)malloc(align_sz);
             if (!buf)
                 return oom;
-            strncpy(buf, bd->buf, bd->pos);
+            memcpy(buf, bd->buf, bd->pos);
             bd->buf = buf;
             bd->sz  = align_sz;
         }
@@ -652,6 +666,7 @@ pchtml_doc_snprintf_ex(pchtml_html_document_t *doc,
         .ctxt           = &bd,
         .writer         = buffer_writer,
         .oom            = 0,
+        .pos            = 0,
     };
     ud.oom = buffer_writer(prefix, strlen(prefix), ud.oom, &bd);
 
@@ -659,6 +674,7 @@ pchtml_doc_snprintf_ex(pchtml_html_document_t *doc,
     status = pchtml_html_serialize_pretty_tree_cb((pcdom_node_t *)doc,
             opt, 0, serializer_callback, &ud);
     PC_ASSERT(status==PCHTML_STATUS_OK);
+    serializer_flush(&ud);
     PC_ASSERT(bd.pos < bd.sz);
     PC_ASSERT(bd.buf);
     bd.buf[bd.pos] = '\0';
@@ -677,10 +693,12 @@ pcdom_node_write_to_stream_ex(pcdom_node_t *node,
         .ctxt           = out,
         .writer         = rwstream_writer,
         .oom            = 0,
+        .pos            = 0,
     };
     unsigned int status;
     status = pchtml_html_serialize_pretty_tree_cb(node,
             opt, 0, serializer_callback, &ud);
+    serializer_flush(&ud);
     if (status!=PCHTML_STATUS_OK) {
         return -1;
     }
@@ -704,6 +722,7 @@ pcdom_node_snprintf_ex(pcdom_node_t *node,
         .ctxt           = &bd,
         .writer         = buffer_writer,
         .oom            = 0,
+        .pos            = 0,
     };
     ud.oom = buffer_writer(prefix, strlen(prefix), ud.oom, &bd);
 
@@ -711,6 +730,7 @@ pcdom_node_snprintf_ex(pcdom_node_t *node,
     status = pchtml_html_serialize_pretty_tree_cb(node,
             opt, 0, serializer_callback, &ud);
     PC_ASSERT(status==PCHTML_STATUS_OK);
+    serializer_flush(&ud);
     PC_ASSERT(bd.pos < bd.sz);
     PC_ASSERT(bd.buf);
     bd.buf[bd.pos] = '\0';
@@ -720,7 +740,6 @@ pcdom_node_snprintf_ex(pcdom_node_t *node,
     return ud.oom ? NULL : bd.buf;
 }
 
-
 struct pcdom_document*
 pchtml_doc_get_document(pchtml_html_document_t *doc)
 {
@@ -252,43 +252,140 @@ const char *pchtml_get_character_entity(uint32_t uc)
     return NULL;
 }
 
-static int
-html_escape_unichar(uint32_t uc, pchtml_html_serialize_cb_f cb, void *ctx)
-{
-    unsigned int status = PCHTML_STATUS_OK;
-    const char *entity = pchtml_get_character_entity(uc);
+/* The classes of bytes for escaping; the bytes of class ESC_PASS are copied
+   in runs without decoding. */
+enum {
+    ESC_PASS = 0,
+    ESC_END,        /* NUL */
+    ESC_C0,         /* other C0 control characters */
+    ESC_QUOTE,      /* " and ' */
+    ESC_SPECIAL,    /* & < > */
+    ESC_LEAD,       /* lead bytes of U+00A0 and U+200B-U+2063 */
+};
+
+static const unsigned char html_escape_class[256] = {
+    /* 0x00 */
+    ESC_END, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0,
+    ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0,
+    /* 0x10 */
+    ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0,
+    ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0, ESC_C0,
+    /* 0x20 */
+    0, 0, ESC_QUOTE, 0, 0, 0, ESC_SPECIAL, ESC_QUOTE,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x30 */
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, ESC_SPECIAL, 0, ESC_SPECIAL, 0,
+    /* 0xC2 and 0xE2 */
+    [0xC2] = ESC_LEAD,
+    [0xE2] = ESC_LEAD,
+};
 
-    if (entity) {
-        html_serialize_send(entity, strlen(entity), ctx);
+/* Decodes the character at @p which has a lead byte of class ESC_LEAD;
+   returns 0 for a character which has no entity. */
+static inline uint32_t
+html_escape_lead_char(const unsigned char *p, const unsigned char *end,
+        size_t *len)
+{
+    if (p[0] == 0xC2) {
+        if (end - p >= 2 && p[1] == 0xA0) {
+            *len = 2;
+            return 0xA0;
+        }
     }
-    else {
-        status = PCHTML_STATUS_CONTINUE;
+    else if (end - p >= 3 && (p[1] == 0x80 || p[1] == 0x81) &&
+            (p[2] & 0xC0) == 0x80) {
+        uint32_t uc = 0x2000 | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+        if ((uc >= 0x200B && uc <= 0x200D) || (uc >= 0x2060 && uc <= 0x2063)) {
+            *len = 3;
+            return uc;
+        }
     }
 
-    return status;
+    return 0;
 }
 
+/*
+ * Sends the string escaped. The bytes which need no escaping are sent in
+ * runs instead of one character per callback.
+ *
+ * @quotes: whether to escape the quotation marks.
+ * @c0ctrls: how to handle C0 control characters
+ *      (PCHTML_HTML_SERIALIZE_OPT_MASK_C0CTRLS).
+ * @indent: the indent after a line break; (size_t)-1 for no indent.
+ */
 static unsigned int
-html_escape_unichar_no_quotes(uint32_t uc,
+html_serialize_send_escaped(const unsigned char *data, size_t len,
+        bool quotes, int c0ctrls, size_t indent,
         pchtml_html_serialize_cb_f cb, void *ctx)
 {
-    unsigned int status = PCHTML_STATUS_OK;
-    const char *entity;
+    unsigned int status;
+    const unsigned char *end = data + len;
+    const unsigned char *run = data;
+
+    while (data != end) {
+        unsigned char cls = html_escape_class[*data];
+        if (cls == ESC_PASS || (cls == ESC_QUOTE && !quotes)) {
+            data++;
+            continue;
+        }
 
-    if (uc != 0x22 && uc != 0x27)
-        entity = pchtml_get_character_entity(uc);
-    else
-        entity = NULL;
+        const char *entity = NULL;
+        size_t len_char = 1;
+        char buff[16];
 
-    if (entity) {
-        assert(strcmp("&quot;", entity));
-        html_serialize_send(entity, strlen(entity), ctx);
+        if (cls == ESC_END) {
+            break;
+        }
+        else if (cls == ESC_C0) {
+            if (c0ctrls == PCHTML_HTML_SERIALIZE_OPT_READABLE_C0CTRLS) {
+                sprintf(buff, "&#%d;", *data);
+                entity = buff;
+            }
+            else if (c0ctrls == PCHTML_HTML_SERIALIZE_OPT_IGNORE_C0CTRLS) {
+                entity = "";
+            }
+            else if (indent != (size_t)-1 &&
+                    (*data == 0x0A || *data == 0x0D)) {
+                if (run != data) {
+                    html_serialize_send(run, (data - run), ctx);
+                }
+                html_serialize_send("\n", 1, ctx);
+                html_serialize_send_indent(indent, ctx);
+                data++;
+                run = data;
+                continue;
+            }
+        }
+        else if (cls == ESC_LEAD) {
+            uint32_t uc = html_escape_lead_char(data, end, &len_char);
+            if (uc)
+                entity = pchtml_get_character_entity(uc);
+        }
+        else {
+            entity = pchtml_get_character_entity(*data);
+        }
+
+        if (entity == NULL) {
+            data++;
+            continue;
+        }
+
+        if (run != data) {
+            html_serialize_send(run, (data - run), ctx);
+        }
+        if (entity[0]) {
+            html_serialize_send(entity, strlen(entity), ctx);
+        }
+        data += len_char;
+        run = data;
     }
-    else {
-        status = PCHTML_STATUS_CONTINUE;
+
+    if (run != data) {
+        html_serialize_send(run, (data - run), ctx);
     }
 
-    return status;
+    return PCHTML_STATUS_OK;
 }
 
 unsigned int
@@ -722,50 +819,16 @@ html_serialize_send_escaping_attribute_string(
         const unsigned char *data, size_t len,
         pchtml_html_serialize_cb_f cb, void *ctx)
 {
-    unsigned int status;
-
-    const unsigned char *end = data + len;
-    while (data != end) {
-        const unsigned char *next =
-            (const unsigned char *)pcutils_utf8_next_char(data);
-        uint32_t uc = pcutils_utf8_to_unichar(data);
-        if (uc == 0)
-            break;
-
-        if (html_escape_unichar(uc, cb, ctx) == PCHTML_STATUS_CONTINUE) {
-            html_serialize_send(data, (next - data), ctx);
-        }
-
-        data = next;
-    }
-
-    return PCHTML_STATUS_OK;
+    return html_serialize_send_escaped(data, len, true,
+            PCHTML_HTML_SERIALIZE_OPT_KEEP_C0CTRLS, (size_t)-1, cb, ctx);
 }
 
 static unsigned int
 html_serialize_send_escaping_string(const unsigned char *data,
         size_t len, pchtml_html_serialize_cb_f cb, void *ctx)
 {
-    unsigned int status;
-
-    const unsigned char *end = data + len;
-
-    while (data != end) {
-        const unsigned char *next =
-            (const unsigned char *)pcutils_utf8_next_char(data);
-        uint32_t uc = pcutils_utf8_to_unichar(data);
-        if (uc == 0)
-            break;
-
-        if (html_escape_unichar_no_quotes(uc, cb, ctx) ==
-                PCHTML_STATUS_CONTINUE) {
-            html_serialize_send(data, (next - data), ctx);
-        }
-
-        data = next;
-    }
-
-    return PCHTML_STATUS_OK;
+    return html_serialize_send_escaped(data, len, false,
+            PCHTML_HTML_SERIALIZE_OPT_KEEP_C0CTRLS, (size_t)-1, cb, ctx);
 }
 
 static unsigned int
@@ -1524,51 +1587,15 @@ html_serialize_pretty_send_escaping_string(
         pchtml_html_serialize_cb_f cb, void *ctx)
 {
     unsigned int status;
-    const unsigned char *end = data + len;
     bool with_indent = (opt & PCHTML_HTML_SERIALIZE_OPT_WITHOUT_TEXT_INDENT) == 0;
 
     if (with_indent) {
         html_serialize_send_indent(indent, ctx);
     }
 
-    while (data != end) {
-        const unsigned char *next =
-            (const unsigned char *)pcutils_utf8_next_char(data);
-        uint32_t uc = pcutils_utf8_to_unichar(data);
-        if (uc == 0)
-            break;
-
-        bool sent = false;
-        if (uc < 0x20) {
-            int c0ctrls = opt & PCHTML_HTML_SERIALIZE_OPT_MASK_C0CTRLS;
-            if (c0ctrls == PCHTML_HTML_SERIALIZE_OPT_READABLE_C0CTRLS) {
-                char buff[16];
-                sprintf(buff, "&#%d;", uc);
-                html_serialize_send(buff, strlen(buff), ctx);
-                sent = true;
-            }
-            else if (c0ctrls == PCHTML_HTML_SERIALIZE_OPT_IGNORE_C0CTRLS) {
-                sent = true;
-            }
-            else if (with_indent && (uc == 0x0A || uc == 0x0D)) {
-                html_serialize_send("\n", 1, ctx);
-                html_serialize_send_indent(indent, ctx);
-                sent = true;
-            }
-        }
-        else {
-            sent = html_escape_unichar_no_quotes(uc, cb, ctx) !=
-                PCHTML_STATUS_CONTINUE;
-        }
-
-        if (!sent) {
-            html_serialize_send(data, (next - data), ctx);
-        }
-
-        data = next;
-    }
-
-    return PCHTML_STATUS_OK;
+    return html_serialize_send_escaped(data, len, false,
+            opt & PCHTML_HTML_SERIALIZE_OPT_MASK_C0CTRLS,
+            with_indent ? indent : (size_t)-1, cb, ctx);
 }
 
 static unsigned int
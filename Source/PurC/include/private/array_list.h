@@ -199,6 +199,11 @@ pcutils_array_list_sort(struct pcutils_array_list *al,
         void *ud, int (*cmp)(struct pcutils_array_list_node *l,
                 struct pcutils_array_list_node *r, void *ud));
 
+/* Reorder the nodes in one pass: the new i-th node is the old order[i]-th. */
+int
+pcutils_array_list_permute(struct pcutils_array_list *al,
+        const size_t *order);
+
 PCA_EXTERN_C_END
 
 #endif // PURC_PRIVATE_ARRAY_LIST_H
@@ -60,6 +60,21 @@ struct pcchan {
 
 typedef struct pcchan *pcchan_t;
 
+/*
+ * The global channel, which is shared by all instances in the process.
+ *
+ * The data are kept in a bounded lock-free ring (multiple producers and
+ * multiple consumers) and the variants sent are moved to the move heap.
+ * A coroutine blocked on a global channel is recorded as a waiter; the peer
+ * signals the waiter and the scheduler of the instance owning the coroutine
+ * resumes it.
+ */
+struct pcchan_global;
+typedef struct pcchan_global *pcchan_global_t;
+
+struct pcintr_heap;
+struct pcintr_coroutine;
+
 PCA_EXTERN_C_BEGIN
 
 pcchan_t
@@ -77,6 +92,28 @@ pcchan_destroy(pcchan_t chan) WTF_INTERNAL;
 purc_variant_t
 pcchan_make_entity(pcchan_t chan) WTF_INTERNAL;
 
+int
+pcchan_global_init_once(void) WTF_INTERNAL;
+
+/* Opens a new global channel or changes the capability of the existed one;
+   a zero capability closes the channel. */
+bool
+pcchan_global_ctrl(const char *chan_name, unsigned int cap) WTF_INTERNAL;
+
+/* Makes a native entity for the global channel; returns PURC_VARIANT_INVALID
+   and sets PURC_ERROR_NOT_EXISTS if there is no such channel. */
+purc_variant_t
+pcchan_global_make_entity(const char *chan_name) WTF_INTERNAL;
+
+/* Resumes the coroutines of the heap whose waits have been signaled;
+   returns the number of coroutines resumed. */
+size_t
+pcchan_global_dispatch_waiters(struct pcintr_heap *heap) WTF_INTERNAL;
+
+/* Cancels the wait of the coroutine which is going to be destroyed. */
+void
+pcchan_global_cancel_wait(struct pcintr_coroutine *crtn) WTF_INTERNAL;
+
 static inline unsigned int
 pcchan_capability(pcchan_t chan) {
     return chan->qsize;
@@ -210,6 +210,20 @@ int pcdvobjs_global_keyword_id(const char *keyword, size_t length);
 bool pcdvobjs_is_valid_timezone(const char *timezone) WTF_INTERNAL;
 bool pcdvobjs_get_current_timezone(char *buff, size_t sz_buff) WTF_INTERNAL;
 
+/* The compiled zoneinfo rules, cached process-wide and immutable. */
+struct pcdvobjs_tzinfo;
+
+int pcdvobjs_tzinfo_init_once(void) WTF_INTERNAL;
+
+/* return NULL if the timezone cannot be loaded */
+const struct pcdvobjs_tzinfo *
+pcdvobjs_get_tzinfo(const char *timezone) WTF_INTERNAL;
+
+void pcdvobjs_tzinfo_localtime(const struct pcdvobjs_tzinfo *tzi,
+        time_t t, struct tm *tm) WTF_INTERNAL;
+time_t pcdvobjs_tzinfo_mktime(const struct pcdvobjs_tzinfo *tzi,
+        struct tm *tm) WTF_INTERNAL;
+
 struct pcinst;
 
 struct wildcard_list {
@@ -74,6 +74,22 @@ int pcejson_parse_full (struct pcvcm_node** vcm_tree, struct pcejson** parser,
                    struct tkz_reader *reader, uint32_t depth,
                    pcejson_parse_is_finished_fn is_finished);
 
+/*
+ * Parse ejson incrementally: create a parser by pcejson_parse_chunk_begin(),
+ * feed the text chunk by chunk as it arrives, and get the VCM tree by
+ * pcejson_parse_chunk_end(). The parser should be destroyed by
+ * pcejson_destroy() then.
+ *
+ * pcejson_parse_chunk() returns -1 once the text is known to be bad;
+ * the later chunks are ignored.
+ */
+struct pcejson* pcejson_parse_chunk_begin (uint32_t depth);
+
+int pcejson_parse_chunk (struct pcejson* parser, const char* data, size_t sz);
+
+int pcejson_parse_chunk_end (struct pcejson* parser,
+                   struct pcvcm_node** vcm_tree);
+
 int pcejson_set_state(struct pcejson *parser, int state);
 
 int pcejson_set_state_param_string(struct pcejson *parser);
@@ -32,6 +32,9 @@
 #include "purc-executor.h"
 
 #include "private/map.h"
+#include "private/list.h"
+
+#include <stddef.h>
 
 PCA_EXTERN_C_BEGIN
 
@@ -98,9 +101,23 @@ int pcexec_register_ops(pcexec_ops_t ops);
 int pcexec_get_by_rule(const char *rule, pcexec_ops_t ops);
 
 
+/* The default capacity of the parsed rule cache of an instance */
+#define PCEXECUTOR_RULE_CACHE_CAPACITY      64
+
+struct pcexec_parsed_rule;
+struct pchash_table;
+
 struct pcexecutor_heap {
     unsigned int       debug_flex:1;
     unsigned int       debug_bison:1;
+
+    /* the LRU cache of the parameters parsed from the rules */
+    struct pchash_table        *rule_table;
+    struct list_head            rule_lru;
+    size_t                      nr_rules;
+    size_t                      nr_rule_hits;
+    size_t                      nr_rule_misses;
+    size_t                      nr_rule_evictions;
 };
 
 // 用于迭代的迭代器
@@ -123,6 +140,9 @@ struct purc_exec_inst {
     char                       *err_msg;
 
     purc_variant_t              value;
+
+    // the cached entry of the rule parsed last; see pcexecutor_parse_rule()
+    struct pcexec_parsed_rule  *parsed_rule;
 };
 
 struct pcinst;
@@ -137,6 +157,35 @@ int pcexecutor_register(pcexec_ops_t ops);
 
 int pcexecutor_get_by_rule(const char *rule, pcexec_ops_t ops);
 
+typedef int  (*pcexec_parse_rule_f)(const char *input, size_t len,
+        void *param);
+typedef void (*pcexec_reset_param_f)(void *param);
+
+/*
+ * Gets the parameters parsed from the rule by the parser of an executor.
+ * The parameters are shared through a LRU cache of the current instance
+ * by all executor instances running the same rule, thus one rule is parsed
+ * only once, no matter how many times it runs; treat them as read-only.
+ *
+ * `sz_param` is the size of the parameter structure of the executor, and
+ * `off_err_msg` is the offset of the field `err_msg` in it. The parameters
+ * are reset by `reset` when the cached entry is freed.
+ *
+ * The entry is held by the executor instance until the next call or
+ * pcexecutor_inst_reset(). Returns NULL on failure, and the error
+ * message of the parser is moved to `inst->err_msg`.
+ */
+void *pcexecutor_parse_rule(struct purc_exec_inst *inst, const char *rule,
+        pcexec_parse_rule_f parse, pcexec_reset_param_f reset,
+        size_t sz_param, size_t off_err_msg);
+
+#define PCEXECUTOR_PARSE_RULE(inst, rule, prefix)                       \
+    ((struct prefix##_param *)pcexecutor_parse_rule(inst, rule,         \
+        (pcexec_parse_rule_f)prefix##_parse,                            \
+        (pcexec_reset_param_f)prefix##_param_reset,                     \
+        sizeof(struct prefix##_param),                                  \
+        offsetof(struct prefix##_param, err_msg)))
+
 purc_atom_t
 pcexecutor_get_rule_name(const char *rule);
 
@@ -56,6 +56,12 @@ typedef void (*pcfetcher_response_handler)(
 typedef void (*pcfetcher_progress_tracker)(purc_variant_t request_id,
         void* ctxt, double progress);
 
+/* Called on the requesting thread with the chunks of a successful response
+   body in order, before the response handler; the chunks given are not
+   passed again to the response handler. */
+typedef void (*pcfetcher_chunk_handler)(purc_variant_t request_id,
+        void* ctxt, const char *data, size_t sz);
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -86,6 +92,19 @@ purc_variant_t pcfetcher_request_async(
         pcfetcher_progress_tracker tracker,
         void* tracker_ctxt);
 
+/* The fetcher may or may not deliver the body in chunks; if it does not,
+   the whole body is passed to the response handler as usual. */
+purc_variant_t pcfetcher_request_async_ex(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler,
+        void* ctxt,
+        pcfetcher_progress_tracker tracker,
+        void* tracker_ctxt);
+
 purc_rwstream_t pcfetcher_request_sync(
         const char* url,
         enum pcfetcher_request_method method,
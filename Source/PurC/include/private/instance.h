@@ -45,6 +45,7 @@ typedef struct pcmodule pcmodule;
 typedef struct pcmodule *pcmodule_t;
 
 struct pcinst_msg_queue;
+struct pcinst_log_ring;
 
 typedef int (*module_init_once_f)(void);
 typedef int (*module_init_instance_f)(struct pcinst *curr_inst,
@@ -86,11 +87,16 @@ struct pcinst {
 #define LOG_FILE_SYSLOG     ((FILE *)-1)
     /* the FILE object for logging (-1: use syslog; NULL: disabled) */
     FILE                   *fp_log;
+    /* the ring of records drained by the writer thread (NULL: unused) */
+    struct pcinst_log_ring *log_ring;
 
     /* data bounden to the current session, e.g, the statbuf of the random
        number generator */
     pcutils_map            *local_data_map;
 
+    /* the LRU cache of compiled regular expressions (created on demand) */
+    struct pcregex_cache   *regex_cache;
+
     struct pcvariant_heap  *variant_heap;
     struct pcvariant_heap  *org_vrt_heap;
 
@@ -123,6 +129,10 @@ pcinst_get_session_variables(const char* name)
 struct pcrdr_msg *pcinst_get_message(void) WTF_INTERNAL;
 void pcinst_put_message(struct pcrdr_msg *msg) WTF_INTERNAL;
 
+/* makes the notification descriptor of the move buffer of the instance
+   readable, if there is one, without moving a message */
+void pcinst_move_buffer_wake_up(purc_atom_t inst_to) WTF_INTERNAL;
+
 int
 pcinst_broadcast_event(pcrdr_msg_event_reduce_opt reduce_op,
         purc_variant_t source_uri, purc_variant_t observed,
@@ -131,6 +141,9 @@ pcinst_broadcast_event(pcrdr_msg_event_reduce_opt reduce_op,
 
 void pcinst_clear_error(struct pcinst *inst) WTF_INTERNAL;
 
+/* stops the log writer if any and closes the log file */
+void pcinst_disable_log(struct pcinst *inst) WTF_INTERNAL;
+
 purc_atom_t
 pcinst_endpoint_get(char *endpoint_name, size_t sz,
         const char *app_name, const char *runner_name) WTF_INTERNAL;
@@ -40,6 +40,7 @@
 #include "private/vdom.h"
 #include "private/timer.h"
 #include "private/sorted-array.h"
+#include "private/timer-wheel.h"
 
 #define PCINTR_MOVE_BUFFER_SIZE 64
 
@@ -118,9 +119,15 @@ struct pcintr_heap {
 
     struct list_head    crtns;
     struct list_head    stopped_crtns;
-    struct sorted_array *wait_timeout_crtns;
+
+    // the timeouts of the stopped coroutines and the timers of the instance
+    struct pcutils_timer_wheel *timer_wheel;
+    // the earliest deadline (ns) of the stopped coroutines whose timeouts
+    // fired before the deadlines; 0 for none
+    uint64_t            fine_deadline;
 
     pcutils_map        *name_chan_map;  // name to channel map.
+    struct list_head    chan_waiters;   // waits on the global channels.
 
     purc_atom_t         move_buff;
     pcintr_timer_t     *event_timer;    // 10ms
@@ -128,6 +135,22 @@ struct pcintr_heap {
     purc_cond_handler   cond_handler;
     unsigned int        keep_alive:1;
     double              timestamp;
+
+    // the built-in runner variables created; see variables.c
+    unsigned int        builtin_vars;
+
+    // the number of the messages handled; see $RUNNER.stats
+    uint64_t            nr_msgs_handled;
+    // the rate over the last window, maintained by the scheduler
+    uint64_t            stats_msgs_mark;
+    uint64_t            stats_time_mark;
+    double              msgs_per_second;
+
+    // the released stack frames and coroutines kept for reuse
+    struct list_head    free_frames;
+    size_t              nr_free_frames;
+    struct list_head    free_crtns;
+    size_t              nr_free_crtns;
 };
 
 struct pcintr_stack_frame;
@@ -179,6 +202,8 @@ struct pcintr_exception {
     struct pcdebug_backtrace  *bt;
 };
 
+struct pcintr_rdr_dom_batch;
+
 struct pcintr_stack {
     struct list_head              frames;
     // the number of stack frames.
@@ -245,6 +270,9 @@ struct pcintr_stack {
     pcdoc_element_t               curr_edom_elem;
     pcutils_mraw_t               *mraw;
     pcutils_str_t                *curr_edom_elem_text_content;
+
+    // pending DOM request to send to renderer for several elements
+    struct pcintr_rdr_dom_batch  *rdr_batch;
 };
 
 enum pcintr_coroutine_stage {
@@ -341,7 +369,13 @@ struct pcintr_coroutine {
 
     void                       *user_data;
     unsigned long               run_idx;
-    time_t                      stopped_timeout;
+
+    // armed when the coroutine is stopped with a timeout
+    struct pcutils_timer        stopped_timer;
+    // the monotonic deadline (ns) of the last stop; 0 if without timeout
+    uint64_t                    stopped_deadline;
+    // whether an observed event resumes the coroutine before the deadline
+    bool                        stopped_interruptible;
 };
 
 enum purc_symbol_var {
@@ -513,7 +547,10 @@ struct pcintr_timers;
 
 PCA_EXTERN_C_BEGIN
 
-bool pcintr_bind_builtin_runner_variables(void);
+/* Creates and binds the built-in runner variable on the first reference,
+   e.g. $SYS; returns PURC_VARIANT_INVALID if the name is not one of them,
+   or it had been created already. */
+purc_variant_t pcintr_make_builtin_runner_variable(const char *name);
 
 struct pcintr_heap* pcintr_get_heap(void);
 
@@ -525,8 +562,14 @@ purc_runloop_t pcintr_get_runloop(void);
 /* stop the specific coroutine; stop forever if timeout is NULL. */
 void pcintr_stop_coroutine(pcintr_coroutine_t crtn,
         const struct timespec *timeout) WTF_INTERNAL;
+/* stop the specific coroutine till the timeout or an event it observes */
+void pcintr_sleep_coroutine(pcintr_coroutine_t crtn,
+        const struct timespec *timeout) WTF_INTERNAL;
 /* resume the specific coroutine */
 void pcintr_resume_coroutine(pcintr_coroutine_t crtn) WTF_INTERNAL;
+/* get the time (ns) remaining to the deadline of the last stop;
+   0 if the deadline passed or the stop had no timeout. */
+uint64_t pcintr_coroutine_remaining_time(pcintr_coroutine_t crtn) WTF_INTERNAL;
 
 void pcintr_check_after_execution(void);
 void pcintr_set_current_co_with_location(pcintr_coroutine_t co,
@@ -27,6 +27,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <regex.h>
 
 enum pcregex_compile_flags {
     PCREGEX_CASELESS          = 1 << 0,
@@ -71,6 +72,18 @@ enum pcregex_match_flags {
 struct pcregex;
 struct pcregex_match_info;
 
+/* The default capacity of the compiled pattern cache of an instance */
+#define PCREGEX_CACHE_CAPACITY      64
+
+/* The kinds of compiled patterns managed by the cache */
+enum pcregex_cache_kind {
+    PCREGEX_CACHE_POSIX = 0,    /* POSIX extended regex (regcomp/regexec) */
+    PCREGEX_CACHE_PCRE,         /* PCRE-compatible pcregex (JIT if possible) */
+};
+
+struct pcregex_cache;
+struct pcregex_cached;
+
 #ifdef __cplusplus
 extern "C" {
 #endif  /* __cplusplus */
@@ -130,6 +143,41 @@ char *pcregex_match_info_fetch(const struct pcregex_match_info *match_info,
 
 void pcregex_match_info_destroy(struct pcregex_match_info *match_info);
 
+/*
+ * Creates/destroys a LRU cache of compiled patterns keyed by
+ * (kind, pattern, flags). Every instance owns one cache, which is created
+ * on demand and destroyed when the instance is cleaned up.
+ */
+struct pcregex_cache *pcregex_cache_new(size_t capacity);
+
+void pcregex_cache_destroy(struct pcregex_cache *cache);
+
+/*
+ * Gets a compiled POSIX regex for the pattern and the flags of regcomp()
+ * from the cache of the current instance; compiles and caches it on miss.
+ *
+ * The returned object holds a reference and must be released by calling
+ * pcregex_cached_release(). It remains valid even if it is evicted
+ * from the cache in the meantime. Returns NULL if failed to compile.
+ */
+struct pcregex_cached *pcregex_cache_get_posix(const char *pattern,
+        int cflags);
+
+/*
+ * Gets a compiled pcregex from the cache of the current instance.
+ * PCREGEX_OPTIMIZE is always added to the compile options so that
+ * the pattern is JIT compiled when the backend supports it.
+ */
+struct pcregex_cached *pcregex_cache_get(const char *pattern,
+        enum pcregex_compile_flags compile_options,
+        enum pcregex_match_flags match_options);
+
+const regex_t *pcregex_cached_posix(const struct pcregex_cached *cached);
+
+struct pcregex *pcregex_cached_regex(const struct pcregex_cached *cached);
+
+void pcregex_cached_release(struct pcregex_cached *cached);
+
 #ifdef __cplusplus
 }
 #endif  /* __cplusplus */
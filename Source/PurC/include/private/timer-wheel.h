@@ -0,0 +1,125 @@
+/**
+ * @file timer-wheel.h
+ * @brief The header file for the hierarchical timer wheel.
+ *
+ * Copyright (C) 2026 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PURC_PRIVATE_TIMER_WHEEL_H
+#define PURC_PRIVATE_TIMER_WHEEL_H
+
+#include "config.h"
+
+#include "purc-macros.h"
+#include "private/list.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+/*
+ * A hierarchical timer wheel with a tick of one millisecond: four levels
+ * of 64 slots cover about 4.6 hours; a timer beyond that range is parked
+ * in the last slot of the top level and re-hashed when it is cascaded.
+ *
+ * Arming and canceling a timer are O(1). The owner advances the wheel to
+ * the current time, and all timers expired till then fire in one pass.
+ */
+#define PCUTILS_TIMER_WHEEL_BITS        6
+#define PCUTILS_TIMER_WHEEL_SLOTS       (1 << PCUTILS_TIMER_WHEEL_BITS)
+#define PCUTILS_TIMER_WHEEL_LEVELS      4
+
+#define PCUTILS_TIMER_NEVER             UINT64_MAX
+
+struct pcutils_timer;
+typedef void (*pcutils_timer_fire_fn)(struct pcutils_timer *timer);
+
+/* The timer entry; embed it in the structure of the user. */
+struct pcutils_timer {
+    struct list_head            ln;
+    uint64_t                    expires;    /* in milliseconds */
+    pcutils_timer_fire_fn       fire;
+};
+
+struct pcutils_timer_wheel;
+
+PCA_EXTERN_C_BEGIN
+
+static inline void
+pcutils_timer_init(struct pcutils_timer *timer, pcutils_timer_fire_fn fire)
+{
+    list_head_init(&timer->ln);
+    timer->expires = 0;
+    timer->fire = fire;
+}
+
+static inline bool
+pcutils_timer_is_armed(const struct pcutils_timer *timer)
+{
+    return !list_empty(&timer->ln);
+}
+
+/* Returns the current monotonic time in milliseconds. */
+static inline uint64_t
+pcutils_timer_wheel_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* Creates a new empty timer wheel which starts at the time of now. */
+struct pcutils_timer_wheel *
+pcutils_timer_wheel_new(uint64_t now);
+
+/* Destroys the wheel; the timers still armed are disarmed, not fired. */
+void
+pcutils_timer_wheel_destroy(struct pcutils_timer_wheel *wheel);
+
+/* Arms (or re-arms) the timer to fire at the time of expires. A timer
+   expired already fires on the next advance. */
+void
+pcutils_timer_wheel_arm(struct pcutils_timer_wheel *wheel,
+        struct pcutils_timer *timer, uint64_t expires);
+
+/* Disarms the timer; it is fine to cancel a timer which is not armed. */
+void
+pcutils_timer_wheel_cancel(struct pcutils_timer_wheel *wheel,
+        struct pcutils_timer *timer);
+
+/* Advances the wheel to the time of now and fires all expired timers.
+   A fire callback may arm or cancel any timer, including itself.
+   Returns the number of timers fired. */
+size_t
+pcutils_timer_wheel_advance(struct pcutils_timer_wheel *wheel, uint64_t now);
+
+/* Returns a lower bound of the time when the next timer expires; it is
+   exact if the timer is in the lowest level. Returns PCUTILS_TIMER_NEVER
+   if there is no timer armed. */
+uint64_t
+pcutils_timer_wheel_next_expiry(struct pcutils_timer_wheel *wheel);
+
+/* Returns the number of timers armed. */
+size_t
+pcutils_timer_wheel_count(struct pcutils_timer_wheel *wheel);
+
+PCA_EXTERN_C_END
+
+#endif /* not defined PURC_PRIVATE_TIMER_WHEEL_H */
+
@@ -39,6 +39,8 @@ typedef void (*pcintr_timer_fire_func)(pcintr_timer_t timer, const char* id,
 
 PCA_EXTERN_C_BEGIN
 
+/* The timer is armed in the timer wheel of the current instance and fired
+   by the scheduler; the runloop argument is kept for compatibility only. */
 pcintr_timer_t
 pcintr_timer_create(purc_runloop_t runloop, const char* id,
         pcintr_timer_fire_func func, void *data);
@@ -259,6 +259,15 @@ struct tkz_reader *tkz_reader_new(void);
 
 void tkz_reader_set_rwstream(struct tkz_reader *reader, purc_rwstream_t rws);
 
+/* feed the bytes to a reader without rwstream; the tokenizer gets NULL
+   from tkz_reader_next_char() and the reader is starved when all
+   the bytes fed are consumed but tkz_reader_feed_end() is not called. */
+bool tkz_reader_feed(struct tkz_reader *reader, const char *data, size_t sz);
+
+void tkz_reader_feed_end(struct tkz_reader *reader);
+
+bool tkz_reader_is_starved(struct tkz_reader *reader);
+
 struct tkz_uc *tkz_reader_next_char(struct tkz_reader *reader);
 
 bool tkz_reader_reconsume_last_char(struct tkz_reader *reader);
@@ -36,10 +36,18 @@
 struct pcvarmgr;
 typedef struct pcvarmgr*  pcvarmgr_t;
 
+struct pcvarmgr_slot;
+
 struct pcvarmgr {
+    /* the variables; kept for the observers of `change:` events */
     purc_variant_t object;
     struct pcvar_listener *listener;
 
+    /* the open-addressing hash table indexing the variables by name */
+    struct pcvarmgr_slot     *slots;
+    size_t                    nr_slots;     /* 0 or a power of 2 */
+    size_t                    nr_vars;
+
     struct rb_node            node;
     struct pcvdom_node       *vdom_node;
 };
@@ -56,6 +64,10 @@ int pcvarmgr_destroy(pcvarmgr_t mgr);
 bool pcvarmgr_add(pcvarmgr_t mgr, const char* name,
         purc_variant_t variant);
 
+/* Adds the variable without posting the change:attached event. */
+bool pcvarmgr_add_silently(pcvarmgr_t mgr, const char* name,
+        purc_variant_t variant);
+
 purc_variant_t pcvarmgr_get(pcvarmgr_t mgr, const char* name);
 
 bool pcvarmgr_remove_ex(pcvarmgr_t mgr, const char* name, bool silently);
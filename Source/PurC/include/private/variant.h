@@ -40,6 +40,7 @@ PCA_EXTERN_C_BEGIN
 #define PCVARIANT_FLAG_NOFREE          PCVARIANT_FLAG_CONSTANT
 #define PCVARIANT_FLAG_EXTRA_SIZE      (0x01 << 1)  // when use extra space
 #define PCVARIANT_FLAG_STRING_STATIC   (0x01 << 2)  // make_string_static
+#define PCVARIANT_FLAG_LISTENERS       (0x01 << 3)  // has listeners
 
 #define PVT(t)          (PURC_VARIANT_TYPE##t)
 #define IS_CONTAINER(t) (t == PURC_VARIANT_TYPE_OBJECT || \
@@ -102,30 +103,14 @@ struct pcvar_listener {
 };
 
 // structure for variant
+/*
+ * The variant cell. The value union comes first, so that the alignment of
+ * `long double` introduces no padding, and the listeners of a container
+ * are kept out of line (see observer.c); thus a cell takes 32 bytes on
+ * 64-bit platforms, and two cells share a cache line.
+ */
 struct purc_variant {
 
-    /* variant type */
-    unsigned int type:8;
-
-    /* The length for short string and byte sequence (both in bytes).
-       When the extra space (long string and long byte sequence) is used,
-       the value of this field is 0. */
-    unsigned int size:8;
-
-    /* flags */
-    unsigned int flags:16;
-
-    /* reference count */
-    unsigned int refc;
-
-    union {
-        /* the list head for listeners. */
-        struct list_head    listeners;
-
-        /* the list node for reserved variants. */
-        struct list_head    reserved;
-    };
-
     /* value */
     union {
         /* for boolean */
@@ -169,10 +154,25 @@ struct purc_variant {
         /* for short string and byte sequence; the real space size of `bytes`
            is `max(sizeof(long double), sizeof(void*) * 2)` */
         uint8_t     bytes[0];
+
+        /* the list node for reserved variants. */
+        struct list_head    reserved;
     };
 
-    /* XXX: Keep the order, so that we can use the variant structure
-       to store a tuple with 3 or less elements without any extra space.  */
+    /* variant type */
+    unsigned int type:8;
+
+    /* The length for short string and byte sequence (both in bytes).
+       When the extra space (long string and long byte sequence) is used,
+       the value of this field is 0. */
+    unsigned int size:8;
+
+    /* flags */
+    unsigned int flags:16;
+
+    /* reference count */
+    unsigned int refc;
+
     union {
         /* union fields for extra information of the variant. */
         uintptr_t           extra_uintptr;
@@ -211,6 +211,9 @@ struct pcvariant_heap {
 #else
     struct list_head    v_reserved;
 #endif
+
+    // the map from the containers to their listeners (created on demand).
+    struct pchash_table *listeners_map;
 };
 
 // internal interfaces for moving variant.
@@ -277,6 +280,9 @@ struct variant_obj {
     // key: arr_node/obj_node/set_node
     // val: parent
     pcutils_map                     *rev_update_chain;
+
+    // the number of the other objects sharing this data copy-on-write
+    size_t                          nr_sharing;
 };
 
 // internal struct used by variant-arr
@@ -293,6 +299,9 @@ struct variant_arr {
     // key: arr_node/obj_node/set_node
     // val: parent
     pcutils_map                     *rev_update_chain;
+
+    // the number of the other arrays sharing this data copy-on-write
+    size_t                          nr_sharing;
 };
 
 
@@ -312,11 +321,54 @@ struct variant_tuple {
 #define PCVARIANT_SORT_ASC             0x00000000
 #define PCVARIANT_CMPOPT_MASK          0x0000FFFF
 
+/*
+ * A clone of an array or an object shares the data of the source until
+ * either of them is changed. Call this function to make the data private
+ * to the container before changing the nodes not through the setters.
+ */
+int pcvariant_container_unshare(purc_variant_t ctnr);
+
 int pcvariant_array_sort(purc_variant_t value, void *ud,
         int (*cmp)(purc_variant_t l, purc_variant_t r, void *ud));
 int pcvariant_set_sort(purc_variant_t value, void *ud,
         int (*cmp)(purc_variant_t l, purc_variant_t r, void *ud));
 
+/* The way to compare the keys extracted by pcvariant_sort_by_keys() */
+enum pcvariant_sort_key_type {
+    /* numerify the key and compare the numbers */
+    PCVARIANT_SORT_KEY_NUMBER = 0,
+    /* stringify the key and compare the strings by strcmp() */
+    PCVARIANT_SORT_KEY_CASE,
+    /* stringify the key and compare the strings ignoring the case of the
+       ASCII letters, as pcutils_strcasecmp() does */
+    PCVARIANT_SORT_KEY_CASELESS,
+};
+
+struct pcvariant_sort_key {
+    /* The property name to get the key from an object member;
+       NULL to use the member itself as the key. */
+    const char                     *name;
+    enum pcvariant_sort_key_type    type;
+};
+
+/* Do not split the sorting to threads below this number of members. */
+#define PCVARIANT_SORT_PARALLEL_MIN     (1024 * 32)
+
+/*
+ * Sort the members of an array or a set by the given keys. Every key is
+ * extracted only once for each member before sorting, a single numeric key
+ * is sorted by radix, and the others by a stable merge sort which is split
+ * to worker threads for large containers.
+ *
+ * If a member is not an object or has not the property for a key, the key
+ * takes 0 as a number, or goes before all other keys as a string. A key of
+ * NaN goes after all other numbers. Both hold in either order.
+ *
+ * Returns 0 on success, -1 on failure with the error set.
+ */
+int pcvariant_sort_by_keys(purc_variant_t container,
+        const struct pcvariant_sort_key *keys, size_t nr_keys, bool desc);
+
 int pcvariant_diff(purc_variant_t l, purc_variant_t r);
 int pcvariant_diff_ex(purc_variant_t l, purc_variant_t r,
         enum purc_variant_compare_opt opt);
@@ -367,6 +419,14 @@ int pcvariant_set_get_uniqkeys(purc_variant_t set, size_t *nr_keynames,
 ssize_t pcvariant_serialize(char *buf, size_t sz, purc_variant_t val);
 char* pcvariant_serialize_alloc(char *buf, size_t sz, purc_variant_t val);
 
+/* Returns the length of the stringified value, without the null byte. */
+size_t pcvariant_stringify_length(purc_variant_t value);
+
+/* Stringifies the value to the buffer without the terminating null byte;
+   returns the number of bytes written, which never exceeds @sz_buf. */
+size_t pcvariant_stringify_to_mem(char *buf, size_t sz_buf,
+        purc_variant_t value);
+
 char* pcvariant_to_string(purc_variant_t v);
 
 purc_variant_t pcvariant_make_object(size_t nr_kvs, ...);
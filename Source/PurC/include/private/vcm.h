@@ -109,6 +109,9 @@ struct pcvcm_node {
     uint32_t extra;
     uintptr_t attach;
     bool is_closed;
+    /* whether the constant subtrees have been folded into literal nodes
+       (for the root) */
+    bool is_folded;
     union {
         bool        b;
         double      d;
@@ -260,6 +263,9 @@ char *pcvcm_node_serialize(struct pcvcm_node *node, size_t *nr_bytes);
 void pcvcm_node_destroy(struct pcvcm_node *root);
 
 
+/* Initializes the lock to fold the constant subtrees of the shared trees. */
+int pcvcm_eval_init_once(void);
+
 typedef purc_variant_t(*find_var_fn) (void *ctxt, const char *name);
 
 struct pcvcm_eval_ctxt;
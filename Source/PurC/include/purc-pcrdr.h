@@ -471,6 +471,35 @@ pcrdr_conn_set_poll_timeout(pcrdr_conn* conn, int timeout_ms);
 PCA_EXPORT size_t
 pcrdr_conn_pending_requests_count(pcrdr_conn* conn);
 
+struct pcrdr_conn_stats {
+    /* the number of current pending requests */
+    size_t      nr_pending;
+    /* the number of requests sent, responses matched, and requests timed out */
+    uint64_t    nr_requests;
+    uint64_t    nr_responses;
+    uint64_t    nr_timeouts;
+    /* the percentiles and the maximum of the round trip time in microseconds;
+       the percentiles are the upper bounds of power-of-two buckets. */
+    uint64_t    rtt_p50;
+    uint64_t    rtt_p90;
+    uint64_t    rtt_p99;
+    uint64_t    rtt_max;
+};
+
+/**
+ * Get the traffic statistics of a connection.
+ *
+ * @param conn: the pointer to the renderer connection.
+ * @param stats: the pointer to a struct pcrdr_conn_stats buffer to
+ *  return the statistics.
+ *
+ * Returns 0 on success, -1 on failure.
+ *
+ * Since: 0.9.2
+ */
+PCA_EXPORT int
+pcrdr_conn_get_stats(pcrdr_conn* conn, struct pcrdr_conn_stats *stats);
+
 /**
  * Get the server host name of a connection.
  *
@@ -1314,6 +1343,22 @@ purc_inst_move_message(purc_atom_t inst_to, pcrdr_msg *msg);
 PCA_EXPORT int
 purc_inst_holding_messages_count(size_t *count);
 
+/**
+ * Get the file descriptor which becomes readable when a message is moved
+ * into the empty move buffer of the current instance.
+ *
+ * Returns: the file descriptor on success, -1 on error.
+ *
+ * The descriptor is created on the first call and closed when the move
+ * buffer is destroyed. Before blocking on it, the caller should read and
+ * discard all data available in it, then take away all messages holding
+ * in the move buffer, in this order; otherwise a wakeup may be lost.
+ *
+ * Since: 0.9.2
+ */
+PCA_EXPORT int
+purc_inst_move_buffer_fd(void);
+
 /**
  * Retrieve a message in the move buffer of the current instance.
  *
@@ -70,6 +70,32 @@ purc_rwstream_t purc_rwstream_new_buffer (size_t sz_init, size_t sz_max);
  */
 PCA_EXPORT purc_rwstream_t purc_rwstream_new_from_mem (void* mem, size_t sz);
 
+/**
+ * Creates a new read-only purc_rwstream_t over the content of the given
+ * file descriptor mapped in memory, for example, a shared memory object
+ * filled by another process.
+ *
+ * The first @sz bytes of the file are mapped read-only; if the file is
+ * longer than @sz, the byte following the content is mapped as well, so
+ * that a content terminated by a null byte can be used as a C string.
+ * The mapping is released when the stream is destroyed. The stream does
+ * not own @fd; the caller can close it once this function returns.
+ *
+ * @param fd: the file descriptor to map.
+ * @param sz: the size of the content.
+ *
+ * @return A purc_rwstream_t on success, @NULL on failure and the error code
+ *         is set to indicate the error. The error code:
+ *  - @PURC_ERROR_INVALID_VALUE: Invalid value
+ *  - @PURC_ERROR_OUT_OF_MEMORY: Out of memory
+ *  - @PURC_ERROR_NOT_IMPLEMENTED: Not implemented
+ *  - other errors mapped from errno of fstat() or mmap().
+ *
+ * Since: 0.9.2
+ */
+PCA_EXPORT purc_rwstream_t
+purc_rwstream_new_from_mmap (int fd, size_t sz);
+
 /**
  * Creates a new purc_rwstream_t for the given file and mode.
  *
@@ -349,7 +375,8 @@ PCA_EXPORT ssize_t purc_rwstream_dump_to_another (purc_rwstream_t in,
 
 /**
  * Get the pointer and size of the rwstream whose type is memory (Created by
- * purc_rwstream_new_buffer or purc_rwstream_new_from_mem).
+ * purc_rwstream_new_buffer, purc_rwstream_new_from_mem, or
+ * purc_rwstream_new_from_mmap).
  * This is the extended version of @purc_rwstream_get_mem_buffer.
  *
  * @param rw_mem: the purc_rwstream_t object.
@@ -370,7 +397,8 @@ PCA_EXPORT void* purc_rwstream_get_mem_buffer_ex (purc_rwstream_t rw_mem,
 
 /**
  * Get the pointer and size of the rwstream whose type is memory (Created by
- * purc_rwstream_new_buffer or purc_rwstream_new_from_mem).
+ * purc_rwstream_new_buffer, purc_rwstream_new_from_mem, or
+ * purc_rwstream_new_from_mmap).
  *
  * @param rw_mem: the purc_rwstream_t object.
  * @param sz_content: (nullable): pointer to receive the size of content.
@@ -629,6 +629,18 @@ PCA_EXPORT const char *
 pcutils_get_next_token_len(const char *str, size_t str_len,
         const char *delims, size_t *length);
 
+/** Length-aware version of `strstr`: find the first occurrence of
+  * the needle in the haystack; both may contain null bytes. Returns NULL
+  * if not found or the needle is empty. */
+PCA_EXPORT const char *
+pcutils_memmem(const char *haystack, size_t len_haystack,
+        const char *needle, size_t len_needle);
+
+/** Count the non-overlapping occurrences of the needle in the haystack. */
+PCA_EXPORT size_t
+pcutils_memmem_count(const char *haystack, size_t len_haystack,
+        const char *needle, size_t len_needle);
+
 /** Escape a string for JSON */
 PCA_EXPORT char*
 pcutils_escape_string_for_json(const char* str);
@@ -1075,6 +1087,25 @@ pcutils_url_get_query_value_alloc(
         const struct purc_broken_down_url *broken_down,
         const char *key, char **value_buff);
 
+struct purc_regex_cache_stat {
+    size_t nr_entries;
+    size_t nr_hits;
+    size_t nr_misses;
+    size_t nr_evictions;
+};
+
+/**
+ * Statistic of the compiled regular expression cache of the current
+ * instance, which is shared by `$L`, the executors and pcregex.
+ *
+ * Returns: The pointer to struct purc_regex_cache_stat on success,
+ *  otherwise NULL (no instance).
+ *
+ * Since: 0.9.2
+ */
+PCA_EXPORT const struct purc_regex_cache_stat *
+purc_regex_cache_stat(void);
+
 PCA_EXTERN_C_END
 
 PCA_EXTERN_C_BEGIN
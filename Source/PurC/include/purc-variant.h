@@ -1152,6 +1152,9 @@ static inline ssize_t purc_variant_object_get_size(purc_variant_t obj)
  * }
  * if (it)
  *     pcvrnt_object_iterator_release(it);
+ *
+ * An iterator walks the properties the object had when the iterator was
+ * created; the changes made to the object meanwhile do not affect it.
  */
 struct pcvrnt_object_iterator;
 
@@ -2938,6 +2941,9 @@ purc_variant_set_overwrite(purc_variant_t set,
  * contained in this container; the cloned container will only hold a new
  * reference of the members.
  *
+ * A cloned array or object shares the storage with the source until
+ * either of them is changed, so cloning is cheap if the clone is only read.
+ *
  * Returns: The cloned container variant on success,
  *      or %PURC_VARIANT_INVALID on failure.
  *
@@ -43,6 +43,7 @@
 #include "private/pcrdr.h"
 #include "private/msg-queue.h"
 #include "private/runners.h"
+#include "private/regex.h"
 #include "purc-runloop.h"
 
 #include "../interpreter/internal.h"
@@ -51,7 +52,6 @@
 #if USE(PTHREADS)          /* { */
 #include <pthread.h>
 #endif                     /* } */
-#include <stdio.h>  // fclose on inst->fp_log
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -409,11 +409,13 @@ static void cleanup_instance(struct pcinst *curr_inst)
         curr_inst->local_data_map = NULL;
     }
 
-    if (curr_inst->fp_log && curr_inst->fp_log != LOG_FILE_SYSLOG) {
-        fclose(curr_inst->fp_log);
-        curr_inst->fp_log = NULL;
+    if (curr_inst->regex_cache) {
+        pcregex_cache_destroy(curr_inst->regex_cache);
+        curr_inst->regex_cache = NULL;
     }
 
+    pcinst_disable_log(curr_inst);
+
     if (curr_inst->bt) {
         pcdebug_backtrace_unref(curr_inst->bt);
         curr_inst->bt = NULL;
@@ -687,10 +689,8 @@ pcvarmgr_t pcinst_get_variables(void)
 
 purc_variant_t pcinst_get_variable(const char* name)
 {
-    pcvarmgr_t varmgr = pcinst_get_variables();
-    PC_ASSERT(varmgr);
-
-    return pcvarmgr_get(varmgr, name);
+    /* the built-in runner variables are created on the first reference */
+    return purc_get_runner_variable(name);
 }
 
 struct pcrdr_conn *
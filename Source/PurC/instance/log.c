@@ -34,8 +34,367 @@
 
 #include "private/instance.h"
 #include "private/ports.h"
+#include "private/list.h"
 
 #include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* this feature needs C11 (stdatomic.h) and POSIX threads */
+#if HAVE(STDATOMIC_H) && USE(PTHREADS)
+
+#include <stdatomic.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#define LOG_RING_SIZE       (64 * 1024)     /* must be a power of 2 */
+#define LOG_RECORD_BUFSZ    1024
+#define CACHE_LINE_SIZE     64
+
+/*
+ * The ring of the formatted log records of an instance. Only the thread
+ * of the instance produces records, and only the writer thread consumes
+ * them, so the positions need no lock.
+ */
+struct pcinst_log_ring {
+    struct list_head        ln;
+    FILE                   *fp;
+    /* the endpoint name of the instance; outlives the ring */
+    const char             *ident;
+
+    /* set by the instance to detach the ring, and by the writer when
+       the ring is drained and detached; protected by the lock of the
+       writer */
+    bool                    detaching;
+    bool                    detached;
+
+    /* the number of records dropped because the ring was full */
+    atomic_size_t           nr_dropped;
+
+    /* keep the positions to write and to read in separate cache lines */
+    char                    pad0[CACHE_LINE_SIZE];
+    atomic_size_t           head;
+    char                    pad1[CACHE_LINE_SIZE - sizeof(atomic_size_t)];
+    atomic_size_t           tail;
+    char                    pad2[CACHE_LINE_SIZE - sizeof(atomic_size_t)];
+
+    char                    buf[LOG_RING_SIZE];
+};
+
+/*
+ * The only writer thread of the process. It drains the rings of all
+ * instances logging to files, and sleeps on the condition when all rings
+ * are empty. It runs while there is any ring attached.
+ */
+static struct {
+    pthread_mutex_t         lock;
+    pthread_cond_t          cond;
+    /* signaled when a ring is detached */
+    pthread_cond_t          detached;
+    pthread_t               thread;
+    /* the thread is in its loop */
+    bool                    running;
+    /* the thread is created but not joined */
+    bool                    joinable;
+    atomic_bool             sleeping;
+    struct list_head        rings;
+} log_writer = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER,
+    .detached = PTHREAD_COND_INITIALIZER,
+    .rings = LIST_HEAD_INIT(log_writer.rings),
+};
+
+static void write_all(int fd, struct iovec *iov, int cnt)
+{
+    while (cnt > 0) {
+        ssize_t n = writev(fd, iov, cnt);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        while (cnt > 0 && (size_t)n >= iov->iov_len) {
+            n -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+
+        if (cnt > 0) {
+            iov->iov_base = (char *)iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+}
+
+/* the monotonic timestamp followed by the same prefix as the records
+   written to stderr */
+static int log_record_prefix(char *buf, size_t sz, const char *ident,
+        const char *tag)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return snprintf(buf, sz, "%ld.%06ld %s %s >> ",
+            (long)ts.tv_sec, ts.tv_nsec / 1000, ident, tag);
+}
+
+/* writes all pending records of the ring at once; returns false if
+   the ring was empty */
+static bool log_ring_drain(struct pcinst_log_ring *ring)
+{
+    int fd = fileno(ring->fp);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    if (head != tail) {
+        struct iovec iov[2];
+        int cnt = 1;
+        size_t off = tail & (LOG_RING_SIZE - 1);
+        size_t len = head - tail;
+        iov[0].iov_base = ring->buf + off;
+        iov[0].iov_len = len;
+        if (off + len > LOG_RING_SIZE) {
+            iov[0].iov_len = LOG_RING_SIZE - off;
+            iov[1].iov_base = ring->buf;
+            iov[1].iov_len = len - iov[0].iov_len;
+            cnt = 2;
+        }
+
+        write_all(fd, iov, cnt);
+        atomic_store_explicit(&ring->tail, head, memory_order_release);
+    }
+
+    size_t nr_dropped = atomic_exchange(&ring->nr_dropped, 0);
+    if (nr_dropped) {
+        char note[LOG_RECORD_BUFSZ];
+        struct iovec iov;
+        int n = log_record_prefix(note, sizeof(note), ring->ident, "WARN");
+        if (n > 0 && (size_t)n < sizeof(note))
+            n += snprintf(note + n, sizeof(note) - n,
+                    "%zu log records dropped\n", nr_dropped);
+        if (n > 0 && (size_t)n < sizeof(note)) {
+            iov.iov_base = note;
+            iov.iov_len = n;
+            write_all(fd, &iov, 1);
+        }
+    }
+
+    return head != tail || nr_dropped;
+}
+
+static bool log_rings_empty(void)
+{
+    struct pcinst_log_ring *ring;
+    list_for_each_entry(ring, &log_writer.rings, ln) {
+        if (ring->detaching ||
+                atomic_load(&ring->head) != atomic_load(&ring->tail) ||
+                atomic_load(&ring->nr_dropped))
+            return false;
+    }
+
+    return true;
+}
+
+static void *log_writer_routine(void *arg)
+{
+    UNUSED_PARAM(arg);
+
+    pthread_mutex_lock(&log_writer.lock);
+    while (!list_empty(&log_writer.rings)) {
+        struct pcinst_log_ring *ring, *next;
+        bool busy = false;
+
+        /* the lock is released while writing; only this thread removes
+           the rings, so the next one saved stays valid */
+        list_for_each_entry_safe(ring, next, &log_writer.rings, ln) {
+            bool detaching = ring->detaching;
+
+            pthread_mutex_unlock(&log_writer.lock);
+            if (log_ring_drain(ring))
+                busy = true;
+            pthread_mutex_lock(&log_writer.lock);
+
+            /* the instance puts nothing after asking to detach */
+            if (detaching) {
+                list_del(&ring->ln);
+                ring->detached = true;
+                pthread_cond_broadcast(&log_writer.detached);
+            }
+        }
+
+        if (busy)
+            continue;
+
+        atomic_store(&log_writer.sleeping, true);
+        if (log_rings_empty() && !list_empty(&log_writer.rings))
+            pthread_cond_wait(&log_writer.cond, &log_writer.lock);
+        atomic_store(&log_writer.sleeping, false);
+    }
+
+    log_writer.running = false;
+    pthread_mutex_unlock(&log_writer.lock);
+    return NULL;
+}
+
+static struct pcinst_log_ring *log_ring_start(FILE *fp, const char *ident)
+{
+    struct pcinst_log_ring *ring = malloc(sizeof(*ring));
+    if (ring == NULL) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    ring->fp = fp;
+    ring->ident = ident;
+    ring->detaching = false;
+    ring->detached = false;
+    atomic_init(&ring->nr_dropped, 0);
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+
+    pthread_mutex_lock(&log_writer.lock);
+    if (!log_writer.running && log_writer.joinable) {
+        /* the last writer has exited */
+        pthread_t thread = log_writer.thread;
+        log_writer.joinable = false;
+        pthread_mutex_unlock(&log_writer.lock);
+        pthread_join(thread, NULL);
+        pthread_mutex_lock(&log_writer.lock);
+    }
+
+    list_add_tail(&ring->ln, &log_writer.rings);
+    if (log_writer.running) {
+        pthread_cond_signal(&log_writer.cond);
+    }
+    else if (pthread_create(&log_writer.thread, NULL,
+                log_writer_routine, NULL) == 0) {
+        log_writer.running = true;
+        log_writer.joinable = true;
+    }
+    else {
+        list_del(&ring->ln);
+        pthread_mutex_unlock(&log_writer.lock);
+        free(ring);
+        purc_set_error(PURC_ERROR_BAD_SYSTEM_CALL);
+        return NULL;
+    }
+    pthread_mutex_unlock(&log_writer.lock);
+
+    return ring;
+}
+
+static void log_writer_wake_up(void)
+{
+    if (atomic_load(&log_writer.sleeping)) {
+        pthread_mutex_lock(&log_writer.lock);
+        pthread_cond_signal(&log_writer.cond);
+        pthread_mutex_unlock(&log_writer.lock);
+    }
+}
+
+/* Waits till the writer drains and detaches the ring; the writer exits
+   after the last ring detached. */
+static void log_ring_stop(struct pcinst_log_ring *ring)
+{
+    pthread_mutex_lock(&log_writer.lock);
+    ring->detaching = true;
+    pthread_cond_signal(&log_writer.cond);
+    while (!ring->detached)
+        pthread_cond_wait(&log_writer.detached, &log_writer.lock);
+
+    bool to_join = false;
+    pthread_t thread = log_writer.thread;
+    if (!log_writer.running && log_writer.joinable) {
+        log_writer.joinable = false;
+        to_join = true;
+    }
+    pthread_mutex_unlock(&log_writer.lock);
+
+    if (to_join)
+        pthread_join(thread, NULL);
+    free(ring);
+}
+
+static void log_ring_put(struct pcinst_log_ring *ring,
+        const char *rec, size_t len)
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    /* never stall the caller */
+    if (len > LOG_RING_SIZE - (head - tail)) {
+        atomic_fetch_add(&ring->nr_dropped, 1);
+        log_writer_wake_up();
+        return;
+    }
+
+    size_t off = head & (LOG_RING_SIZE - 1);
+    size_t len_1st = LOG_RING_SIZE - off;
+    if (len_1st >= len) {
+        memcpy(ring->buf + off, rec, len);
+    }
+    else {
+        memcpy(ring->buf + off, rec, len_1st);
+        memcpy(ring->buf, rec + len_1st, len - len_1st);
+    }
+
+    atomic_store(&ring->head, head + len);
+    log_writer_wake_up();
+}
+
+static void log_to_ring(struct pcinst_log_ring *ring,
+        const char *tag, const char *msg, va_list ap)
+{
+    char buf[LOG_RECORD_BUFSZ];
+    va_list ap_copy;
+
+    int n = log_record_prefix(buf, sizeof(buf), ring->ident, tag);
+    if (n < 0 || (size_t)n >= sizeof(buf))
+        return;
+
+    va_copy(ap_copy, ap);
+    int m = vsnprintf(buf + n, sizeof(buf) - n, msg, ap);
+    if (m < 0)
+        goto done;
+
+    if ((size_t)(n + m) < sizeof(buf)) {
+        log_ring_put(ring, buf, n + m);
+    }
+    else {
+        char *rec = malloc(n + m + 1);
+        if (rec) {
+            memcpy(rec, buf, n);
+            vsnprintf(rec + n, m + 1, msg, ap_copy);
+            log_ring_put(ring, rec, n + m);
+            free(rec);
+        }
+    }
+
+done:
+    va_end(ap_copy);
+}
+
+#endif /* HAVE(STDATOMIC_H) && USE(PTHREADS) */
+
+void pcinst_disable_log(struct pcinst *inst)
+{
+#if HAVE(STDATOMIC_H) && USE(PTHREADS)
+    if (inst->log_ring) {
+        log_ring_stop(inst->log_ring);
+        inst->log_ring = NULL;
+    }
+#endif
+
+    if (inst->fp_log && inst->fp_log != LOG_FILE_SYSLOG) {
+        fclose(inst->fp_log);
+    }
+    inst->fp_log = NULL;
+}
 
 bool purc_enable_log(bool enable, bool use_syslog)
 {
@@ -46,8 +405,8 @@ bool purc_enable_log(bool enable, bool use_syslog)
     if (enable) {
 #if HAVE(VSYSLOG)
         if (use_syslog) {
-            if (inst->fp_log && inst->fp_log != LOG_FILE_SYSLOG) {
-                fclose(inst->fp_log);
+            if (inst->fp_log != LOG_FILE_SYSLOG) {
+                pcinst_disable_log(inst);
             }
             inst->fp_log = LOG_FILE_SYSLOG;
         }
@@ -73,11 +432,17 @@ bool purc_enable_log(bool enable, bool use_syslog)
                 purc_set_error(PURC_ERROR_BAD_STDC_CALL);
                 return false;
             }
+
+#if HAVE(STDATOMIC_H) && USE(PTHREADS)
+            /* fall back to writing synchronously if failed */
+            const char *ident = purc_atom_to_string(inst->endpoint_atom);
+            inst->log_ring = log_ring_start(inst->fp_log,
+                    ident ? ident : "[unknown]");
+#endif
         }
     }
-    else if (inst->fp_log && inst->fp_log != LOG_FILE_SYSLOG) {
-        fclose(inst->fp_log);
-        inst->fp_log = NULL;
+    else if (inst->fp_log != LOG_FILE_SYSLOG) {
+        pcinst_disable_log(inst);
     }
 
     return true;
@@ -91,6 +456,13 @@ void purc_log_with_tag(const char *tag, const char *msg, va_list ap)
     if (inst)
         fp = inst->fp_log;
 
+#if HAVE(STDATOMIC_H) && USE(PTHREADS)
+    if (inst && inst->log_ring) {
+        log_to_ring(inst->log_ring, tag, msg, ap);
+        return;
+    }
+#endif
+
 #if HAVE(VSYSLOG)
     if (fp) {
         if (fp == LOG_FILE_SYSLOG) {
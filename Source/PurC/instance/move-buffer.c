@@ -42,6 +42,13 @@
 
 #include <stdatomic.h>
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if HAVE(SYS_EVENTFD_H)
+    #include <sys/eventfd.h>
+#endif
 
 #if HAVE(GLIB)
     #include <gmodule.h>
@@ -56,6 +63,10 @@ struct pcinst_move_buffer {
     unsigned int        flags;
     size_t              max_nr_msgs;
     size_t              nr_msgs;
+
+    /* signaled when the buffer becomes not empty; created on demand.
+       With eventfd, both are the same descriptor. */
+    int                 notify_fds[2];
 };
 
 /* the header of the struct pcrdr_msg */
@@ -211,6 +222,7 @@ purc_inst_create_move_buffer(unsigned int flags, size_t max_msgs)
     }
 
     mb->flags = flags;
+    mb->notify_fds[0] = mb->notify_fds[1] = -1;
     mb->nr_msgs = 0;
     mb->max_nr_msgs = (max_msgs > 0) ? max_msgs : NR_DEF_MAX_MSGS;
     list_head_init(&mb->msgs);
@@ -301,6 +313,11 @@ purc_inst_destroy_move_buffer(void)
 
     pcutils_sorted_array_remove(mb_atom2buff_map, (void *)(uintptr_t)atom);
     purc_rwlock_clear(&mb->lock);
+    if (mb->notify_fds[0] >= 0) {
+        close(mb->notify_fds[0]);
+        if (mb->notify_fds[1] != mb->notify_fds[0])
+            close(mb->notify_fds[1]);
+    }
     free(mb);
 
 done:
@@ -338,6 +355,22 @@ do_take_message(struct pcinst* inst, pcrdr_msg *msg)
     }
 }
 
+/* Called with mb_lock held, so the descriptors will not be closed. */
+static void
+notify_not_empty(int fd)
+{
+    ssize_t n;
+#if HAVE(SYS_EVENTFD_H)
+    uint64_t one = 1;
+    n = write(fd, &one, sizeof(one));
+#else
+    n = write(fd, "", 1);
+#endif
+    /* EAGAIN: it is readable already */
+    if (n < 0 && errno != EAGAIN)
+        PC_ERROR("failed to notify move buffer: %s\n", strerror(errno));
+}
+
 size_t
 purc_inst_move_message(purc_atom_t inst_to, pcrdr_msg *msg)
 {
@@ -374,9 +407,11 @@ purc_inst_move_message(purc_atom_t inst_to, pcrdr_msg *msg)
         purc_rwlock_writer_lock(&mb->lock);
         struct pcrdr_msg_hdr *hdr = (struct pcrdr_msg_hdr *)msg;
         list_add_tail(&hdr->ln, &mb->msgs);
-        mb->nr_msgs++;
+        int fd = (mb->nr_msgs++ == 0) ? mb->notify_fds[1] : -1;
         purc_rwlock_writer_unlock(&mb->lock);
 
+        if (fd >= 0)
+            notify_not_empty(fd);
         nr++;
     }
     else {
@@ -412,8 +447,11 @@ purc_inst_move_message(purc_atom_t inst_to, pcrdr_msg *msg)
                 purc_rwlock_writer_lock(&mb->lock);
                 struct pcrdr_msg_hdr *hdr = (struct pcrdr_msg_hdr *)my_msg;
                 list_add_tail(&hdr->ln, &mb->msgs);
-                mb->nr_msgs++;
+                int fd = (mb->nr_msgs++ == 0) ? mb->notify_fds[1] : -1;
                 purc_rwlock_writer_unlock(&mb->lock);
+
+                if (fd >= 0)
+                    notify_not_empty(fd);
                 nr++;
             }
         }
@@ -467,6 +505,89 @@ done:
     return errcode;
 }
 
+static int
+make_notify_fds(int fds[2])
+{
+#if HAVE(SYS_EVENTFD_H)
+    fds[0] = fds[1] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    return fds[0] >= 0 ? 0 : -1;
+#else
+    if (pipe(fds))
+        return -1;
+
+    for (int i = 0; i < 2; i++) {
+        fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+        fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+    }
+    return 0;
+#endif
+}
+
+int
+purc_inst_move_buffer_fd(void)
+{
+    struct pcinst* inst = pcinst_current();
+    if (inst == NULL) {
+        purc_set_error(PURC_ERROR_NO_INSTANCE);
+        return -1;
+    }
+
+    int errcode = 0;
+    int fd = -1;
+    struct pcinst_move_buffer *mb;
+
+    purc_rwlock_reader_lock(&mb_lock);
+
+    if (!pcutils_sorted_array_find(mb_atom2buff_map,
+                (void *)(uintptr_t)inst->endpoint_atom, (void **)&mb)) {
+        errcode = PURC_ERROR_NOT_EXISTS;
+        goto done;
+    }
+
+    purc_rwlock_writer_lock(&mb->lock);
+    if (mb->notify_fds[0] < 0) {
+        if (make_notify_fds(mb->notify_fds)) {
+            mb->notify_fds[0] = mb->notify_fds[1] = -1;
+            errcode = PURC_ERROR_BAD_SYSTEM_CALL;
+        }
+        else if (mb->nr_msgs > 0) {
+            /* the messages moved before */
+            notify_not_empty(mb->notify_fds[1]);
+        }
+    }
+    fd = mb->notify_fds[0];
+    purc_rwlock_writer_unlock(&mb->lock);
+
+done:
+    purc_rwlock_reader_unlock(&mb_lock);
+
+    if (errcode) {
+        purc_set_error(errcode);
+    }
+
+    return fd;
+}
+
+void
+pcinst_move_buffer_wake_up(purc_atom_t inst_to)
+{
+    struct pcinst_move_buffer *mb;
+
+    purc_rwlock_reader_lock(&mb_lock);
+
+    if (pcutils_sorted_array_find(mb_atom2buff_map,
+                (void *)(uintptr_t)inst_to, (void **)&mb)) {
+        purc_rwlock_reader_lock(&mb->lock);
+        int fd = mb->notify_fds[1];
+        purc_rwlock_reader_unlock(&mb->lock);
+
+        if (fd >= 0)
+            notify_not_empty(fd);
+    }
+
+    purc_rwlock_reader_unlock(&mb_lock);
+}
+
 const pcrdr_msg *
 purc_inst_retrieve_message(size_t index)
 {
@@ -651,6 +772,19 @@ purc_inst_take_away_message(size_t index)
     return NULL;
 }
 
+int
+purc_inst_move_buffer_fd(void)
+{
+    purc_set_error(PURC_ERROR_NOT_SUPPORTED);
+    return -1;
+}
+
+void
+pcinst_move_buffer_wake_up(purc_atom_t inst_to)
+{
+    UNUSED_PARAM(inst_to);
+}
+
 #endif  /* !HAVE(STDATOMIC_H) */
 
 struct pcmodule _module_mvbuf = {
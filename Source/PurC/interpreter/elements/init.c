@@ -57,6 +57,7 @@ struct ctxt_for_init {
     int                           ret_code;
     int                           err;
     purc_rwstream_t               resp;
+    struct pcejson               *body_parser;
 
     enum VIA                      via;
     purc_variant_t                v_for;
@@ -94,6 +95,10 @@ ctxt_for_init_destroy(struct ctxt_for_init *ctxt)
             purc_rwstream_destroy(ctxt->resp);
             ctxt->resp = NULL;
         }
+        if (ctxt->body_parser) {
+            pcejson_destroy(ctxt->body_parser);
+            ctxt->body_parser = NULL;
+        }
         free(ctxt);
     }
 }
@@ -527,6 +532,36 @@ static void on_sync_complete(purc_variant_t request_id, void *ud,
         PURC_VARIANT_INVALID, ctxt->sync_id);
 }
 
+/* parse the body while it is arriving */
+static bool
+feed_body_parser(struct pcejson **parser, const char *data, size_t sz)
+{
+    if (*parser == NULL) {
+        *parser = pcejson_parse_chunk_begin(PCEJSON_DEFAULT_DEPTH);
+        if (*parser == NULL)
+            return false;
+    }
+
+    return pcejson_parse_chunk(*parser, data, sz) == 0;
+}
+
+static void on_sync_chunk(purc_variant_t request_id, void *ud,
+        const char *data, size_t sz)
+{
+    UNUSED_PARAM(request_id);
+
+    pcintr_stack_frame_t frame;
+    frame = (pcintr_stack_frame_t)ud;
+    struct ctxt_for_init *ctxt;
+    ctxt = (struct ctxt_for_init*)frame->ctxt;
+
+    if (ctxt->co->stack.exited) {
+        return;
+    }
+
+    feed_body_parser(&ctxt->body_parser, data, sz);
+}
+
 static bool
 is_observer_match(struct pcintr_observer *observer, pcrdr_msg *msg,
         purc_variant_t observed, purc_atom_t type, const char *sub_type)
@@ -576,7 +611,7 @@ observer_handle(pcintr_coroutine_t cor, struct pcintr_observer *observer,
         goto out;
     }
 
-    if (!ctxt->resp || ctxt->ret_code != 200) {
+    if ((!ctxt->resp && !ctxt->body_parser) || ctxt->ret_code != 200) {
         if (frame->silently) {
             frame->next_step = NEXT_STEP_ON_POPPING;
             goto out;
@@ -588,7 +623,8 @@ observer_handle(pcintr_coroutine_t cor, struct pcintr_observer *observer,
         goto out;
     }
 
-    purc_variant_t ret = purc_variant_load_from_json_stream(ctxt->resp);
+    purc_variant_t ret = pcintr_load_from_response(ctxt->body_parser,
+            ctxt->resp);
     PRINT_VARIANT(ret);
     if (ret == PURC_VARIANT_INVALID) {
         frame->next_step = NEXT_STEP_ON_POPPING;
@@ -645,8 +681,9 @@ process_from_sync(pcintr_coroutine_t co, pcintr_stack_frame_t frame)
     params = params_from_with(ctxt);
 
     ctxt->co = co;
-    purc_variant_t v = pcintr_load_from_uri_async(stack, ctxt->from_uri,
-            method, params, on_sync_complete, frame, PURC_VARIANT_INVALID);
+    purc_variant_t v = pcintr_load_from_uri_async_ex(stack, ctxt->from_uri,
+            method, params, on_sync_complete, on_sync_chunk, frame,
+            PURC_VARIANT_INVALID);
     if (v == PURC_VARIANT_INVALID)
         return -1;
 
@@ -679,6 +716,7 @@ struct load_data {
     int                       ret_code;
     int                       err;
     purc_rwstream_t           resp;
+    struct pcejson           *body_parser;
 
     purc_variant_t            as;
     purc_variant_t            at;
@@ -702,6 +740,10 @@ static void load_data_release(struct load_data *data)
             purc_rwstream_destroy(data->resp);
             data->resp = NULL;
         }
+        if (data->body_parser) {
+            pcejson_destroy(data->body_parser);
+            data->body_parser = NULL;
+        }
     }
 }
 
@@ -723,7 +765,7 @@ static void on_async_resume_on_frame_pseudo(pcintr_coroutine_t co,
     if (data->ret_code == RESP_CODE_USER_STOP)
         return;
 
-    if (!data->resp || data->ret_code != 200) {
+    if ((!data->resp && !data->body_parser) || data->ret_code != 200) {
         if (frame->silently) {
             return;
         }
@@ -734,7 +776,8 @@ static void on_async_resume_on_frame_pseudo(pcintr_coroutine_t co,
         return;
     }
 
-    purc_variant_t ret = purc_variant_load_from_json_stream(data->resp);
+    purc_variant_t ret = pcintr_load_from_response(data->body_parser,
+            data->resp);
     PRINT_VARIANT(ret);
     if (ret == PURC_VARIANT_INVALID)
         return;
@@ -840,6 +883,21 @@ static void on_async_complete(purc_variant_t request_id, void *ud,
     purc_variant_unref(payload);
 }
 
+static void on_async_chunk(purc_variant_t request_id, void *ud,
+        const char *data, size_t sz)
+{
+    UNUSED_PARAM(request_id);
+
+    struct load_data *load_data;
+    load_data = (struct load_data*)ud;
+
+    if (load_data->co->stack.exited) {
+        return;
+    }
+
+    feed_body_parser(&load_data->body_parser, data, sz);
+}
+
 static void load_data_cancel(void *ud)
 {
     struct load_data *data;
@@ -890,8 +948,8 @@ process_from_async(pcintr_coroutine_t co, pcintr_stack_frame_t frame)
         return -1;
     }
 
-    data->async_id = pcintr_load_from_uri_async(stack, ctxt->from_uri,
-            method, params, on_async_complete, data, dest);
+    data->async_id = pcintr_load_from_uri_async_ex(stack, ctxt->from_uri,
+            method, params, on_async_complete, on_async_chunk, data, dest);
     purc_variant_unref(dest);
 
     if (data->async_id == PURC_VARIANT_INVALID) {
@@ -768,6 +768,14 @@ update_elements(pcintr_stack_t stack,
         purc_variant_t template_data_type,
         enum hvml_update_op operator)
 {
+    /* send the same change on several elements to renderer in one request */
+    struct pcintr_rdr_dom_batch batch;
+    bool batching = false;
+    if (pcdvobjs_get_element_from_elements(elems, 1)) {
+        batching = pcintr_rdr_begin_dom_batch(stack, &batch);
+    }
+
+    int ret = 0;
     size_t idx = 0;
     while (1) {
         pcdoc_element_t target;
@@ -776,11 +784,17 @@ update_elements(pcintr_stack_t stack,
             break;
         int r = update_target(stack, target, at, to, src, with_eval,
                 template_data_type, operator);
-        if (r)
-            return -1;
+        if (r) {
+            ret = -1;
+            break;
+        }
     }
 
-    return 0;
+    if (batching) {
+        pcintr_rdr_end_dom_batch(stack);
+    }
+
+    return ret;
 }
 
 static enum hvml_update_op
@@ -0,0 +1,835 @@
+/*
+ * @file global-channel.c
+ * @brief The implementation of the channel shared by instances.
+ *
+ * Copyright (C) 2026 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// #undef NDEBUG
+
+#include "config.h"
+
+#include "purc-variant.h"
+#include "purc-errors.h"
+#include "private/channel.h"
+#include "private/instance.h"
+#include "private/interpreter.h"
+#include "private/variant.h"
+#include "private/ports.h"
+#include "private/map.h"
+#include "private/debug.h"
+
+/* this feature needs C11 (stdatomic.h) or above */
+#if HAVE(STDATOMIC_H)
+
+#include <stdatomic.h>
+#include <assert.h>
+
+#define CACHE_LINE_SIZE     64
+
+/* a cell of the ring; see Dmitry Vyukov's bounded MPMC queue */
+struct chan_cell {
+    atomic_size_t           seq;
+    purc_variant_t          vrt;
+};
+
+struct chan_waiter {
+    /* the node in the waiter list of the channel; guarded by chan->lock */
+    struct list_head        ln;
+    /* the node in the waiter list of the heap owning the coroutine */
+    struct list_head        ln_heap;
+
+    struct pcchan_global   *chan;
+    pcintr_coroutine_t      crtn;
+    /* the move buffer of the instance owning the coroutine */
+    purc_atom_t             inst;
+    bool                    to_send;
+    atomic_bool             signaled;
+};
+
+struct pcchan_global {
+    char                   *name;
+
+    /* the node in the list of all global channels */
+    struct list_head        ln;
+
+    /* size of the ring */
+    unsigned int            qsize;
+
+    /* the entities and the waiters referring to the channel;
+       guarded by the registry lock. */
+    unsigned int            refc;
+    atomic_bool             closed;
+
+    /* the waiters; guarded by the lock */
+    struct purc_mutex       lock;
+    struct list_head        send_waiters;
+    struct list_head        recv_waiters;
+    atomic_uint             nr_send_waiters;
+    atomic_uint             nr_recv_waiters;
+
+    struct chan_cell       *cells;
+
+    /* keep the positions to send and to receive in separate cache lines */
+    char                    pad0[CACHE_LINE_SIZE];
+    atomic_size_t           sendx;
+    char                    pad1[CACHE_LINE_SIZE - sizeof(atomic_size_t)];
+    atomic_size_t           recvx;
+    char                    pad2[CACHE_LINE_SIZE - sizeof(atomic_size_t)];
+};
+
+/* the registry of the global channels */
+static struct purc_mutex    gc_lock;
+static pcutils_map         *gc_name_map;
+static struct list_head     gc_channels;
+
+static bool
+ring_push(struct pcchan_global *chan, purc_variant_t vrt)
+{
+    struct chan_cell *cell;
+    size_t pos = atomic_load_explicit(&chan->sendx, memory_order_relaxed);
+
+    for (;;) {
+        cell = chan->cells + pos % chan->qsize;
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&chan->sendx, &pos,
+                        pos + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0) {
+            /* full */
+            return false;
+        }
+        else {
+            pos = atomic_load_explicit(&chan->sendx, memory_order_relaxed);
+        }
+    }
+
+    cell->vrt = vrt;
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+    return true;
+}
+
+static purc_variant_t
+ring_pop(struct pcchan_global *chan)
+{
+    struct chan_cell *cell;
+    size_t pos = atomic_load_explicit(&chan->recvx, memory_order_relaxed);
+
+    for (;;) {
+        cell = chan->cells + pos % chan->qsize;
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&chan->recvx, &pos,
+                        pos + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0) {
+            /* empty */
+            return PURC_VARIANT_INVALID;
+        }
+        else {
+            pos = atomic_load_explicit(&chan->recvx, memory_order_relaxed);
+        }
+    }
+
+    purc_variant_t vrt = cell->vrt;
+    cell->vrt = PURC_VARIANT_INVALID;
+    atomic_store_explicit(&cell->seq, pos + chan->qsize,
+            memory_order_release);
+    return vrt;
+}
+
+static inline size_t
+ring_count(struct pcchan_global *chan)
+{
+    size_t recvx = atomic_load(&chan->recvx);
+    size_t sendx = atomic_load(&chan->sendx);
+    return (sendx > recvx) ? (sendx - recvx) : 0;
+}
+
+/* discards the variants left in the ring; the caller should not
+   hold the lock of the move heap. */
+static unsigned int
+discard_data(struct pcchan_global *chan)
+{
+    unsigned int nr = 0;
+    purc_variant_t vrt;
+
+    if (pcinst_current() == NULL) {
+        /* no instance to unreference the variants in the move heap */
+        return (unsigned int)ring_count(chan);
+    }
+
+    pcvariant_use_move_heap();
+    while ((vrt = ring_pop(chan))) {
+        purc_variant_unref(vrt);
+        nr++;
+    }
+    pcvariant_use_norm_heap();
+
+    return nr;
+}
+
+/* called with the registry lock held */
+static void
+chan_destroy(struct pcchan_global *chan)
+{
+    unsigned int nr = discard_data(chan);
+    if (nr > 0) {
+        PC_WARN("destroying a global channel not empty: %s (%u)\n",
+                chan->name, nr);
+    }
+
+    assert(list_empty(&chan->send_waiters));
+    assert(list_empty(&chan->recv_waiters));
+
+    list_del(&chan->ln);
+    purc_mutex_clear(&chan->lock);
+    free(chan->cells);
+    free(chan->name);
+    free(chan);
+}
+
+static struct pcchan_global *
+chan_new(const char *chan_name, unsigned int cap)
+{
+    struct pcchan_global *chan = calloc(1, sizeof(*chan));
+    if (chan == NULL)
+        goto failed;
+
+    chan->cells = malloc(sizeof(struct chan_cell) * cap);
+    if (chan->cells == NULL)
+        goto failed;
+
+    chan->name = strdup(chan_name);
+    if (chan->name == NULL)
+        goto failed;
+
+    purc_mutex_init(&chan->lock);
+    if (chan->lock.native_impl == NULL)
+        goto failed;
+
+    list_head_init(&chan->ln);
+    chan->qsize = cap;
+    chan->refc = 0;
+    atomic_init(&chan->closed, false);
+    list_head_init(&chan->send_waiters);
+    list_head_init(&chan->recv_waiters);
+    atomic_init(&chan->nr_send_waiters, 0);
+    atomic_init(&chan->nr_recv_waiters, 0);
+
+    for (unsigned int i = 0; i < cap; i++) {
+        atomic_init(&chan->cells[i].seq, i);
+        chan->cells[i].vrt = PURC_VARIANT_INVALID;
+    }
+    atomic_init(&chan->sendx, 0);
+    atomic_init(&chan->recvx, 0);
+    return chan;
+
+failed:
+    if (chan) {
+        free(chan->name);
+        free(chan->cells);
+        free(chan);
+    }
+    purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    return NULL;
+}
+
+static void
+chan_ref(struct pcchan_global *chan)
+{
+    purc_mutex_lock(&gc_lock);
+    chan->refc++;
+    purc_mutex_unlock(&gc_lock);
+}
+
+static void
+chan_unref(struct pcchan_global *chan)
+{
+    purc_mutex_lock(&gc_lock);
+    assert(chan->refc > 0);
+    chan->refc--;
+    if (chan->refc == 0 && atomic_load(&chan->closed)) {
+        chan_destroy(chan);
+    }
+    purc_mutex_unlock(&gc_lock);
+}
+
+/* marks the first waiter in the list signaled, and wakes up the scheduler
+   of the instance owning the waiting coroutine to resume the coroutine. */
+static void
+signal_waiters(struct pcchan_global *chan, struct list_head *waiters,
+        atomic_uint *nr_waiters, bool all)
+{
+    purc_mutex_lock(&chan->lock);
+    while (!list_empty(waiters)) {
+        struct chan_waiter *waiter;
+        waiter = list_first_entry(waiters, struct chan_waiter, ln);
+        list_del_init(&waiter->ln);
+        atomic_fetch_sub(nr_waiters, 1);
+        atomic_store(&waiter->signaled, true);
+        pcinst_move_buffer_wake_up(waiter->inst);
+
+        if (!all)
+            break;
+    }
+    purc_mutex_unlock(&chan->lock);
+}
+
+/*
+ * Records the coroutine as a waiter of the channel and stops it.
+ *
+ * The counter of waiters is increased before checking the ring again,
+ * and the peer checks the counter after changing the ring, so one of
+ * them will see the change made by the other. Returns false if the
+ * condition to wait is gone, and the caller should try again.
+ */
+static bool
+wait_on(struct pcchan_global *chan, pcintr_coroutine_t crtn, bool to_send)
+{
+    struct chan_waiter *waiter = calloc(1, sizeof(*waiter));
+    if (waiter == NULL) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return false;
+    }
+
+    struct list_head *waiters;
+    atomic_uint *nr_waiters;
+    if (to_send) {
+        waiters = &chan->send_waiters;
+        nr_waiters = &chan->nr_send_waiters;
+    }
+    else {
+        waiters = &chan->recv_waiters;
+        nr_waiters = &chan->nr_recv_waiters;
+    }
+
+    /* the scheduler sleeps on the notification descriptor of the move
+       buffer while the coroutine waits; make sure there is one before
+       the peers can signal the wait */
+    pcintr_heap_t heap = crtn->owner;
+    purc_inst_move_buffer_fd();
+
+    chan_ref(chan);
+    waiter->chan = chan;
+    waiter->crtn = crtn;
+    waiter->inst = heap->move_buff;
+    waiter->to_send = to_send;
+    atomic_init(&waiter->signaled, false);
+
+    purc_mutex_lock(&chan->lock);
+    atomic_fetch_add(nr_waiters, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    size_t count = ring_count(chan);
+    if (atomic_load(&chan->closed) ||
+            (to_send && count < chan->qsize) || (!to_send && count > 0)) {
+        atomic_fetch_sub(nr_waiters, 1);
+        purc_mutex_unlock(&chan->lock);
+
+        chan_unref(chan);
+        free(waiter);
+        return false;
+    }
+
+    list_add_tail(&waiter->ln, waiters);
+    purc_mutex_unlock(&chan->lock);
+
+    list_add_tail(&waiter->ln_heap, &heap->chan_waiters);
+    pcintr_stop_coroutine(crtn, &crtn->timeout);
+    return true;
+}
+
+static void
+release_waiter(struct chan_waiter *waiter)
+{
+    list_del(&waiter->ln_heap);
+    chan_unref(waiter->chan);
+    free(waiter);
+}
+
+size_t
+pcchan_global_dispatch_waiters(struct pcintr_heap *heap)
+{
+    size_t nr = 0;
+    struct list_head *p, *n;
+
+    list_for_each_safe(p, n, &heap->chan_waiters) {
+        struct chan_waiter *waiter;
+        waiter = list_entry(p, struct chan_waiter, ln_heap);
+        if (!atomic_load(&waiter->signaled))
+            continue;
+
+        pcintr_coroutine_t crtn = waiter->crtn;
+        release_waiter(waiter);
+
+        /* the coroutine may have been resumed for timeout */
+        if (crtn->state == CO_STATE_STOPPED) {
+            pcintr_resume_coroutine(crtn);
+            nr++;
+        }
+    }
+
+    return nr;
+}
+
+void
+pcchan_global_cancel_wait(struct pcintr_coroutine *crtn)
+{
+    pcintr_heap_t heap = crtn->owner;
+    struct list_head *p, *n;
+
+    list_for_each_safe(p, n, &heap->chan_waiters) {
+        struct chan_waiter *waiter;
+        waiter = list_entry(p, struct chan_waiter, ln_heap);
+        if (waiter->crtn != crtn)
+            continue;
+
+        struct pcchan_global *chan = waiter->chan;
+        struct list_head *waiters;
+        atomic_uint *nr_waiters;
+        if (waiter->to_send) {
+            waiters = &chan->send_waiters;
+            nr_waiters = &chan->nr_send_waiters;
+        }
+        else {
+            waiters = &chan->recv_waiters;
+            nr_waiters = &chan->nr_recv_waiters;
+        }
+
+        bool signaled = false;
+        purc_mutex_lock(&chan->lock);
+        if (!list_empty(&waiter->ln)) {
+            /* not signaled yet */
+            list_del_init(&waiter->ln);
+            atomic_fetch_sub(nr_waiters, 1);
+        }
+        else {
+            signaled = true;
+        }
+        purc_mutex_unlock(&chan->lock);
+
+        /* the peer signaled only this waiter for the slot or the data it
+           made available; pass the signal on, or the next waiter would
+           sleep until it times out */
+        if (signaled)
+            signal_waiters(chan, waiters, nr_waiters, false);
+
+        release_waiter(waiter);
+    }
+}
+
+static purc_variant_t
+send_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
+                unsigned call_flags)
+{
+    struct pcchan_global *chan = native_entity;
+    pcintr_coroutine_t crtn = pcintr_get_coroutine();
+
+    if (call_flags & PCVRT_CALL_FLAG_AGAIN &&
+            call_flags & PCVRT_CALL_FLAG_TIMEOUT) {
+        if (crtn)
+            pcchan_global_cancel_wait(crtn);
+        purc_set_error(PURC_ERROR_TIMEOUT);
+        goto failed;
+    }
+
+    if (nr_args < 1) {
+        purc_set_error(PURC_ERROR_ARGUMENT_MISSED);
+        goto failed;
+    }
+
+    if (purc_variant_is_undefined(argv[0])) {
+        purc_set_error(PURC_ERROR_INVALID_VALUE);
+        goto failed;
+    }
+
+    for (;;) {
+        if (atomic_load(&chan->closed)) {
+            purc_set_error(PURC_ERROR_ENTITY_GONE);
+            goto failed;
+        }
+
+        if (ring_count(chan) < chan->qsize) {
+            /* the move heap takes over the reference */
+            purc_variant_t moved;
+            moved = pcvariant_move_heap_in(purc_variant_ref(argv[0]));
+            if (moved == PURC_VARIANT_INVALID)
+                goto failed;
+
+            if (ring_push(chan, moved)) {
+                atomic_thread_fence(memory_order_seq_cst);
+                if (atomic_load(&chan->nr_recv_waiters) > 0) {
+                    signal_waiters(chan, &chan->recv_waiters,
+                            &chan->nr_recv_waiters, false);
+                }
+                break;
+            }
+
+            /* filled by other senders in the meantime */
+            pcvariant_use_move_heap();
+            purc_variant_unref(moved);
+            pcvariant_use_norm_heap();
+        }
+
+        if (crtn == NULL || wait_on(chan, crtn, true)) {
+            purc_set_error(PURC_ERROR_AGAIN);
+            return PURC_VARIANT_INVALID;
+        }
+    }
+
+    return purc_variant_make_boolean(true);
+
+failed:
+    if (call_flags & PCVRT_CALL_FLAG_SILENTLY)
+        return purc_variant_make_boolean(false);
+
+    return PURC_VARIANT_INVALID;
+}
+
+static purc_variant_t
+recv_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
+                unsigned call_flags)
+{
+    UNUSED_PARAM(nr_args);
+    UNUSED_PARAM(argv);
+
+    struct pcchan_global *chan = native_entity;
+    pcintr_coroutine_t crtn = pcintr_get_coroutine();
+
+    if (call_flags & PCVRT_CALL_FLAG_AGAIN &&
+            call_flags & PCVRT_CALL_FLAG_TIMEOUT) {
+        if (crtn)
+            pcchan_global_cancel_wait(crtn);
+        purc_set_error(PURC_ERROR_TIMEOUT);
+        goto failed;
+    }
+
+    purc_variant_t vrt;
+    for (;;) {
+        if (atomic_load(&chan->closed)) {
+            purc_set_error(PURC_ERROR_ENTITY_GONE);
+            goto failed;
+        }
+
+        vrt = ring_pop(chan);
+        if (vrt) {
+            atomic_thread_fence(memory_order_seq_cst);
+            if (atomic_load(&chan->nr_send_waiters) > 0) {
+                signal_waiters(chan, &chan->send_waiters,
+                        &chan->nr_send_waiters, false);
+            }
+            break;
+        }
+
+        if (crtn == NULL || wait_on(chan, crtn, false)) {
+            purc_set_error(PURC_ERROR_AGAIN);
+            return PURC_VARIANT_INVALID;
+        }
+    }
+
+    return pcvariant_move_heap_out(vrt);
+
+failed:
+    if (call_flags & PCVRT_CALL_FLAG_SILENTLY)
+        return purc_variant_make_undefined();
+
+    return PURC_VARIANT_INVALID;
+}
+
+static purc_variant_t
+cap_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
+                unsigned call_flags)
+{
+    UNUSED_PARAM(nr_args);
+    UNUSED_PARAM(argv);
+
+    struct pcchan_global *chan = native_entity;
+    if (atomic_load(&chan->closed)) {
+        purc_set_error(PURC_ERROR_ENTITY_GONE);
+        goto failed;
+    }
+
+    return purc_variant_make_ulongint(chan->qsize);
+
+failed:
+    if (call_flags & PCVRT_CALL_FLAG_SILENTLY)
+        return purc_variant_make_boolean(false);
+
+    return PURC_VARIANT_INVALID;
+}
+
+static purc_variant_t
+len_getter(void *native_entity, size_t nr_args, purc_variant_t *argv,
+                unsigned call_flags)
+{
+    UNUSED_PARAM(nr_args);
+    UNUSED_PARAM(argv);
+
+    struct pcchan_global *chan = native_entity;
+    if (atomic_load(&chan->closed)) {
+        purc_set_error(PURC_ERROR_ENTITY_GONE);
+        goto failed;
+    }
+
+    return purc_variant_make_ulongint(ring_count(chan));
+
+failed:
+    if (call_flags & PCVRT_CALL_FLAG_SILENTLY)
+        return purc_variant_make_boolean(false);
+
+    return PURC_VARIANT_INVALID;
+}
+
+static purc_nvariant_method
+property_getter(void *entity, const char *name)
+{
+    UNUSED_PARAM(entity);
+    switch (name[0]) {
+    case 's':
+        if (strcmp(name, "send") == 0) {
+            return send_getter;
+        }
+        break;
+
+    case 'r':
+        if (strcmp(name, "recv") == 0) {
+            return recv_getter;
+        }
+        break;
+
+    case 'c':
+        if (strcmp(name, "cap") == 0) {
+            return cap_getter;
+        }
+        break;
+
+    case 'l':
+        if (strcmp(name, "len") == 0) {
+            return len_getter;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
+static void
+on_release(void *native_entity)
+{
+    chan_unref(native_entity);
+}
+
+purc_variant_t
+pcchan_global_make_entity(const char *chan_name)
+{
+    static const struct purc_native_ops ops = {
+        .property_getter = property_getter,
+        .on_observe = NULL,
+        .on_forget = NULL,
+        .on_release = on_release,
+    };
+
+    struct pcchan_global *chan = NULL;
+
+    purc_mutex_lock(&gc_lock);
+    pcutils_map_entry *entry = pcutils_map_find(gc_name_map, chan_name);
+    if (entry) {
+        chan = entry->val;
+        chan->refc++;
+    }
+    purc_mutex_unlock(&gc_lock);
+
+    if (chan == NULL) {
+        purc_set_error(PURC_ERROR_NOT_EXISTS);
+        return PURC_VARIANT_INVALID;
+    }
+
+    purc_variant_t retv = purc_variant_make_native(chan, &ops);
+    if (retv == PURC_VARIANT_INVALID) {
+        chan_unref(chan);
+    }
+
+    return retv;
+}
+
+bool
+pcchan_global_ctrl(const char *chan_name, unsigned int cap)
+{
+    int errcode = PURC_ERROR_OK;
+    struct pcchan_global *chan = NULL;
+
+    if (UNLIKELY(chan_name == NULL || chan_name[0] == '\0' ||
+                strlen(chan_name) > PCCHAN_MAX_LEN_NAME)) {
+        purc_set_error(PURC_ERROR_INVALID_VALUE);
+        return false;
+    }
+
+    purc_mutex_lock(&gc_lock);
+
+    pcutils_map_entry *entry = pcutils_map_find(gc_name_map, chan_name);
+    if (entry) {
+        chan = entry->val;
+        if (cap == 0) {
+            /* close the channel; the name can be used for a new channel */
+            pcutils_map_erase(gc_name_map, chan->name);
+            atomic_store(&chan->closed, true);
+
+            if (chan->refc == 0) {
+                chan_destroy(chan);
+            }
+            else {
+                discard_data(chan);
+                signal_waiters(chan, &chan->send_waiters,
+                        &chan->nr_send_waiters, true);
+                signal_waiters(chan, &chan->recv_waiters,
+                        &chan->nr_recv_waiters, true);
+            }
+        }
+        else if (cap != chan->qsize) {
+            /* the ring of a global channel can not be resized in place */
+            errcode = PURC_ERROR_NOT_SUPPORTED;
+        }
+    }
+    else if (cap == 0) {
+        errcode = PURC_ERROR_NOT_EXISTS;
+    }
+    else if ((chan = chan_new(chan_name, cap)) == NULL) {
+        errcode = PURC_ERROR_OUT_OF_MEMORY;
+    }
+    else if (pcutils_map_insert(gc_name_map, chan->name, chan)) {
+        chan_destroy(chan);
+        errcode = PURC_ERROR_OUT_OF_MEMORY;
+    }
+    else {
+        list_add_tail(&chan->ln, &gc_channels);
+    }
+
+    purc_mutex_unlock(&gc_lock);
+
+    if (errcode) {
+        purc_set_error(errcode);
+        return false;
+    }
+
+    return true;
+}
+
+static void gc_cleanup_once(void)
+{
+    struct list_head *p, *n;
+    list_for_each_safe(p, n, &gc_channels) {
+        struct pcchan_global *chan;
+        chan = list_entry(p, struct pcchan_global, ln);
+        chan_destroy(chan);
+    }
+
+    if (gc_name_map) {
+        pcutils_map_destroy(gc_name_map);
+        gc_name_map = NULL;
+    }
+
+    if (gc_lock.native_impl) {
+        purc_mutex_clear(&gc_lock);
+        gc_lock.native_impl = NULL;
+    }
+}
+
+int
+pcchan_global_init_once(void)
+{
+    list_head_init(&gc_channels);
+
+    purc_mutex_init(&gc_lock);
+    if (gc_lock.native_impl == NULL)
+        goto fail_lock;
+
+    gc_name_map = pcutils_map_create(NULL, NULL, NULL, NULL,
+            comp_key_string, false);
+    if (gc_name_map == NULL)
+        goto fail_map;
+
+    if (atexit(gc_cleanup_once))
+        goto fail_atexit;
+
+    return 0;
+
+fail_atexit:
+    pcutils_map_destroy(gc_name_map);
+    gc_name_map = NULL;
+
+fail_map:
+    purc_mutex_clear(&gc_lock);
+    gc_lock.native_impl = NULL;
+
+fail_lock:
+    return -1;
+}
+
+#else   /* HAVE(STDATOMIC_H) */
+
+int
+pcchan_global_init_once(void)
+{
+    // do nothing.
+    return 0;
+}
+
+bool
+pcchan_global_ctrl(const char *chan_name, unsigned int cap)
+{
+    UNUSED_PARAM(chan_name);
+    UNUSED_PARAM(cap);
+
+    purc_set_error(PURC_ERROR_NOT_SUPPORTED);
+    return false;
+}
+
+purc_variant_t
+pcchan_global_make_entity(const char *chan_name)
+{
+    UNUSED_PARAM(chan_name);
+
+    purc_set_error(PURC_ERROR_NOT_SUPPORTED);
+    return PURC_VARIANT_INVALID;
+}
+
+size_t
+pcchan_global_dispatch_waiters(struct pcintr_heap *heap)
+{
+    UNUSED_PARAM(heap);
+    return 0;
+}
+
+void
+pcchan_global_cancel_wait(struct pcintr_coroutine *crtn)
+{
+    UNUSED_PARAM(crtn);
+}
+
+#endif  /* !HAVE(STDATOMIC_H) */
@@ -31,6 +31,7 @@
 
 #include "private/interpreter.h"
 #include "private/fetcher.h"
+#include "private/ejson.h"
 
 #include "keywords.h"
 
@@ -160,6 +161,20 @@ pcintr_load_from_uri_async(pcintr_stack_t stack, const char* uri,
         pcfetcher_response_handler handler, void* ctxt,
         purc_variant_t progress_event_dest);
 
+/* the chunk handler is called with the body chunks if the fetcher
+   delivers the body in chunks */
+purc_variant_t
+pcintr_load_from_uri_async_ex(pcintr_stack_t stack, const char* uri,
+        enum pcfetcher_request_method method, purc_variant_t params,
+        pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler, void* ctxt,
+        purc_variant_t progress_event_dest);
+
+/* parse the fetched eJSON from the chunks fed to `parser` if any,
+   or from `resp` */
+purc_variant_t
+pcintr_load_from_response(struct pcejson *parser, purc_rwstream_t resp);
+
 bool
 pcintr_save_async_request_id(pcintr_stack_t stack, purc_variant_t req_id);
 
@@ -317,6 +332,31 @@ pcintr_rdr_send_dom_req_simple_raw(pcintr_stack_t stack, pcdoc_operation op,
         pcdoc_element_t element, const char *property,
         pcrdr_msg_data_type data_type, const char *data, size_t len);
 
+/* The DOM requests made by pcintr_rdr_send_dom_req_simple_raw() between
+   pcintr_rdr_begin_dom_batch() and pcintr_rdr_end_dom_batch() are merged:
+   the requests with the same operation, property, and data for different
+   elements are sent as one request by using the `handles` selector. */
+struct pcintr_rdr_dom_batch {
+    pcdoc_operation         op;
+    pcrdr_msg_data_type     data_type;
+    char                   *property;
+    char                   *data;
+    size_t                  len;
+
+    size_t                  nr_handles;
+    // the handles in hexadecimal separated by commas
+    char                    handles[PCRDR_MAX_HANDLES * 17];
+};
+
+/* Returns false if the renderer does not support the `handles` selector,
+   or there is already a batch in progress. */
+bool
+pcintr_rdr_begin_dom_batch(pcintr_stack_t stack,
+        struct pcintr_rdr_dom_batch *batch);
+
+bool
+pcintr_rdr_end_dom_batch(pcintr_stack_t stack);
+
 
 #define pcintr_rdr_dom_append_content(stack, element, content)          \
     pcintr_rdr_send_dom_req_simple_raw(stack, PCDOC_OP_APPEND,          \
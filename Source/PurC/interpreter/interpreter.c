@@ -64,6 +64,77 @@
 #define BUFF_MIN            1024
 #define BUFF_MAX            1024 * 1024 * 4
 
+/* the max numbers of the released frames and coroutines kept in heap */
+#define MAX_FREE_FRAMES     32
+#define MAX_FREE_CRTNS      4
+
+/* the normal and the pseudo frames have the same layout */
+static void *
+stack_frame_alloc(pcintr_stack_t stack)
+{
+    struct pcintr_heap *heap = stack->co ? stack->co->owner : NULL;
+    if (heap && heap->nr_free_frames > 0) {
+        struct pcintr_stack_frame *frame;
+        frame = list_first_entry(&heap->free_frames,
+                struct pcintr_stack_frame, node);
+        list_del(&frame->node);
+        heap->nr_free_frames--;
+
+        /* keep the emptied array of the attribute results */
+        pcutils_array_t *attrs_result = frame->attrs_result;
+        struct pcintr_stack_frame_normal *frame_normal;
+        frame_normal = container_of(frame,
+                struct pcintr_stack_frame_normal, frame);
+        memset(frame_normal, 0, sizeof(*frame_normal));
+        frame_normal->frame.attrs_result = attrs_result;
+        return frame_normal;
+    }
+
+    void *p = calloc(1, sizeof(struct pcintr_stack_frame_normal));
+    if (p == NULL) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    }
+    return p;
+}
+
+static void
+stack_frame_free(struct pcintr_stack_frame *frame)
+{
+    struct pcintr_heap *heap = NULL;
+    if (frame->owner && frame->owner->co)
+        heap = frame->owner->co->owner;
+
+    if (heap && heap->nr_free_frames < MAX_FREE_FRAMES) {
+        list_add(&frame->node, &heap->free_frames);
+        heap->nr_free_frames++;
+        return;
+    }
+
+    if (frame->attrs_result)
+        pcutils_array_destroy(frame->attrs_result, true);
+    free(container_of(frame, struct pcintr_stack_frame_normal, frame));
+}
+
+static void
+free_frames_and_crtns(struct pcintr_heap *heap)
+{
+    struct pcintr_stack_frame *frame, *next_frame;
+    list_for_each_entry_safe(frame, next_frame, &heap->free_frames, node) {
+        list_del(&frame->node);
+        if (frame->attrs_result)
+            pcutils_array_destroy(frame->attrs_result, true);
+        free(container_of(frame, struct pcintr_stack_frame_normal, frame));
+    }
+    heap->nr_free_frames = 0;
+
+    pcintr_coroutine_t co, next_co;
+    list_for_each_entry_safe(co, next_co, &heap->free_crtns, ln) {
+        list_del(&co->ln);
+        free(co);
+    }
+    heap->nr_free_crtns = 0;
+}
+
 static void
 stack_frame_release(struct pcintr_stack_frame *frame)
 {
@@ -99,8 +170,7 @@ stack_frame_release(struct pcintr_stack_frame *frame)
                 purc_variant_unref(v);
             }
         }
-        pcutils_array_destroy(frame->attrs_result, true);
-        frame->attrs_result = NULL;
+        pcutils_array_clean(frame->attrs_result);
     }
 }
 
@@ -120,7 +190,7 @@ stack_frame_pseudo_destroy(struct pcintr_stack_frame_pseudo *frame_pseudo)
         return;
 
     stack_frame_pseudo_release(frame_pseudo);
-    free(frame_pseudo);
+    stack_frame_free(&frame_pseudo->frame);
 }
 
 static void
@@ -139,7 +209,7 @@ stack_frame_normal_destroy(struct pcintr_stack_frame_normal *frame_normal)
         return;
 
     stack_frame_normal_release(frame_normal);
-    free(frame_normal);
+    stack_frame_free(&frame_normal->frame);
 }
 
 static int
@@ -399,6 +469,8 @@ coroutine_release(pcintr_coroutine_t co)
         struct pcintr_heap *heap = pcintr_get_heap();
         PC_ASSERT(heap && co->owner == heap);
 
+        pcutils_timer_wheel_cancel(heap->timer_wheel, &co->stopped_timer);
+        pcchan_global_cancel_wait(co);
         stack_release(&co->stack);
         pcvdom_document_unref(co->vdom);
 
@@ -474,12 +546,44 @@ coroutine_release(pcintr_coroutine_t co)
     }
 }
 
+static pcintr_coroutine_t
+coroutine_alloc(struct pcintr_heap *heap)
+{
+    pcintr_coroutine_t co;
+    if (heap->nr_free_crtns > 0) {
+        co = list_first_entry(&heap->free_crtns, struct pcintr_coroutine, ln);
+        list_del(&co->ln);
+        heap->nr_free_crtns--;
+        memset(co, 0, sizeof(*co));
+        return co;
+    }
+
+    co = (pcintr_coroutine_t)calloc(1, sizeof(*co));
+    if (!co) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    }
+    return co;
+}
+
+static void
+coroutine_free(struct pcintr_heap *heap, pcintr_coroutine_t co)
+{
+    if (heap && heap->nr_free_crtns < MAX_FREE_CRTNS) {
+        list_add(&co->ln, &heap->free_crtns);
+        heap->nr_free_crtns++;
+    }
+    else {
+        free(co);
+    }
+}
+
 static void
 coroutine_destroy(pcintr_coroutine_t co)
 {
     if (co) {
+        struct pcintr_heap *heap = co->owner;
         coroutine_release(co);
-        free(co);
+        coroutine_free(heap, co);
     }
 }
 
@@ -518,8 +622,6 @@ static void _cleanup_instance(struct pcinst* inst)
         coroutine_destroy(pco);
     }
 
-    pcutils_sorted_array_destroy(heap->wait_timeout_crtns);
-
     if (heap->move_buff) {
         size_t n = purc_inst_destroy_move_buffer();
         PC_DEBUG("Instance is quiting, %u messages discarded\n", (unsigned)n);
@@ -536,6 +638,12 @@ static void _cleanup_instance(struct pcinst* inst)
         heap->name_chan_map = NULL;
     }
 
+    if (heap->timer_wheel) {
+        pcutils_timer_wheel_destroy(heap->timer_wheel);
+        heap->timer_wheel = NULL;
+    }
+
+    free_frames_and_crtns(heap);
     free(heap);
     inst->intr_heap = NULL;
 }
@@ -564,10 +672,8 @@ static int _init_instance(struct pcinst* inst,
         return PURC_ERROR_OUT_OF_MEMORY;
     }
 
-    if (!pcintr_bind_builtin_runner_variables()) {
-        free(heap);
-        return purc_get_last_error();
-    }
+    /* the built-in runner variables are created on demand;
+       see pcintr_make_builtin_runner_variable() */
 
     inst->running_loop = purc_runloop_get_current();
     inst->intr_heap = heap;
@@ -577,8 +683,16 @@ static int _init_instance(struct pcinst* inst,
 
     list_head_init(&heap->crtns);
     list_head_init(&heap->stopped_crtns);
-    heap->wait_timeout_crtns = pcutils_sorted_array_create(
-            SAFLAG_ORDER_ASC | SAFLAG_DUPLCATE_SORTV, 0, NULL, NULL);
+    list_head_init(&heap->chan_waiters);
+    list_head_init(&heap->free_frames);
+    list_head_init(&heap->free_crtns);
+    heap->timer_wheel = pcutils_timer_wheel_new(pcutils_timer_wheel_now());
+    if (!heap->timer_wheel) {
+        purc_inst_destroy_move_buffer();
+        heap->move_buff = 0;
+        free(heap);
+        return PURC_ERROR_OUT_OF_MEMORY;
+    }
 
     heap->name_chan_map =
         pcutils_map_create(NULL, NULL, NULL,
@@ -586,6 +700,7 @@ static int _init_instance(struct pcinst* inst,
 
     heap->event_timer = pcintr_timer_create(NULL, NULL, event_timer_fire, inst);
     if (!heap->event_timer) {
+        pcutils_timer_wheel_destroy(heap->timer_wheel);
         purc_inst_destroy_move_buffer();
         heap->move_buff = 0;
         free(heap);
@@ -604,6 +719,9 @@ static int _init_once(void)
     PC_ASSERT(runloop);
     init_ops();
 
+    if (pcchan_global_init_once())
+        return -1;
+
     return pcintr_init_loader_once();
 }
 
@@ -846,7 +964,8 @@ init_stack_frame(pcintr_stack_t stack, struct pcintr_stack_frame* frame)
         return -1;
     }
 
-    frame->attrs_result = pcutils_array_create();
+    if (frame->attrs_result == NULL)
+        frame->attrs_result = pcutils_array_create();
     if (!frame->attrs_result) {
         purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
         return -1;
@@ -875,10 +994,8 @@ static struct pcintr_stack_frame_pseudo*
 stack_frame_pseudo_create(pcintr_stack_t stack)
 {
     struct pcintr_stack_frame_pseudo *frame_pseudo;
-    frame_pseudo = (struct pcintr_stack_frame_pseudo*)calloc(1,
-            sizeof(*frame_pseudo));
+    frame_pseudo = stack_frame_alloc(stack);
     if (!frame_pseudo) {
-        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
         return NULL;
     }
 
@@ -979,10 +1096,8 @@ static struct pcintr_stack_frame_normal*
 stack_frame_normal_create(pcintr_stack_t stack)
 {
     struct pcintr_stack_frame_normal *frame_normal;
-    frame_normal = (struct pcintr_stack_frame_normal*)calloc(1,
-            sizeof(*frame_normal));
+    frame_normal = stack_frame_alloc(stack);
     if (!frame_normal) {
-        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
         return NULL;
     }
 
@@ -1793,11 +1908,11 @@ coroutine_create(purc_vdom_t vdom, pcintr_coroutine_t parent,
     pcintr_coroutine_t co = NULL;
     pcintr_stack_t stack = NULL;
 
-    co = (pcintr_coroutine_t)calloc(1, sizeof(*co));
+    co = coroutine_alloc(heap);
     if (!co) {
-        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
         goto fail;
     }
+    pcutils_timer_init(&co->stopped_timer, NULL);
 
     if (set_coroutine_id(co)) {
         goto fail_co;
@@ -1838,7 +1953,7 @@ coroutine_create(purc_vdom_t vdom, pcintr_coroutine_t parent,
         stack->inherit = 1;
     }
     else if (doc_init(stack)) {
-        goto fail_variables;
+        goto fail_linked;
     }
 
     if (parent) {
@@ -1847,7 +1962,7 @@ coroutine_create(purc_vdom_t vdom, pcintr_coroutine_t parent,
         child = (pcintr_coroutine_child_t)calloc(1, sizeof(*child));
         if (!child) {
             purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-            goto fail_variables;
+            goto fail_linked;
         }
         child->cid = co->cid;
         list_add_tail(&child->ln, &parent->children);
@@ -1862,15 +1977,16 @@ coroutine_create(purc_vdom_t vdom, pcintr_coroutine_t parent,
                 (void *)(uintptr_t)co->cid);
     }
 
-    co->stopped_timeout = -1;
-
     return co;
 
+fail_linked:
+    list_del(&co->ln);
+
 fail_variables:
     pcinst_msg_queue_destroy(co->mq);
 
 fail_co:
-    free(co);
+    coroutine_free(heap, co);
 
 fail:
     return NULL;
@@ -1951,6 +2067,7 @@ failed:
         pcvdom_document_unref(vdom);
     }
     else {
+        list_del(&co->ln);
         coroutine_destroy(co);
     }
 
@@ -2142,6 +2259,7 @@ pcintr_load_from_uri(pcintr_stack_t stack, const char* uri)
 
 struct load_async_data {
     pcfetcher_response_handler handler;
+    pcfetcher_chunk_handler    chunk_handler;
     void* ctxt;
     pthread_t                  requesting_thread;
     pcintr_stack_t             requesting_stack;
@@ -2156,6 +2274,7 @@ release_load_async_data(struct load_async_data *data)
         PURC_VARIANT_SAFE_CLEAR(data->progress_event_dest);
         PURC_VARIANT_SAFE_CLEAR(data->request_id);
         data->handler           = NULL;
+        data->chunk_handler     = NULL;
         data->ctxt              = NULL;
         data->requesting_thread = 0;
         data->requesting_stack  = NULL;
@@ -2183,6 +2302,15 @@ on_load_async_done(
     destroy_load_async_data(data);
 }
 
+static void
+on_load_async_chunk(purc_variant_t request_id, void* ctxt,
+        const char *data, size_t sz)
+{
+    struct load_async_data *load_data;
+    load_data = (struct load_async_data*)ctxt;
+    load_data->chunk_handler(request_id, load_data->ctxt, data, sz);
+}
+
 void pcintr_fetcher_progress_tracker(purc_variant_t request_id,
         void* ctxt, double progress)
 {
@@ -2217,6 +2345,17 @@ pcintr_load_from_uri_async(pcintr_stack_t stack, const char* uri,
         enum pcfetcher_request_method method, purc_variant_t params,
         pcfetcher_response_handler handler, void* ctxt,
         purc_variant_t progress_event_dest)
+{
+    return pcintr_load_from_uri_async_ex(stack, uri, method, params,
+            handler, NULL, ctxt, progress_event_dest);
+}
+
+purc_variant_t
+pcintr_load_from_uri_async_ex(pcintr_stack_t stack, const char* uri,
+        enum pcfetcher_request_method method, purc_variant_t params,
+        pcfetcher_response_handler handler,
+        pcfetcher_chunk_handler chunk_handler, void* ctxt,
+        purc_variant_t progress_event_dest)
 {
     PC_ASSERT(stack);
     PC_ASSERT(uri);
@@ -2231,6 +2370,7 @@ pcintr_load_from_uri_async(pcintr_stack_t stack, const char* uri,
         return PURC_VARIANT_INVALID;
     }
     data->handler              = handler;
+    data->chunk_handler        = chunk_handler;
     data->ctxt                 = ctxt;
     data->requesting_thread    = pthread_self();
     data->requesting_stack     = stack;
@@ -2247,12 +2387,13 @@ pcintr_load_from_uri_async(pcintr_stack_t stack, const char* uri,
     }
 
     uint32_t timeout = stack->co->timeout.tv_sec;
-    data->request_id = pcfetcher_request_async(
+    data->request_id = pcfetcher_request_async_ex(
             uri,
             method,
             params,
             timeout,
             on_load_async_done,
+            chunk_handler ? on_load_async_chunk : NULL,
             data,
             pcintr_fetcher_progress_tracker,
             data);
@@ -2265,6 +2406,23 @@ pcintr_load_from_uri_async(pcintr_stack_t stack, const char* uri,
     return data->request_id;
 }
 
+purc_variant_t
+pcintr_load_from_response(struct pcejson *parser, purc_rwstream_t resp)
+{
+    if (parser == NULL) {
+        return purc_variant_load_from_json_stream(resp);
+    }
+
+    purc_variant_t ret = PURC_VARIANT_INVALID;
+    struct pcvcm_node *root = NULL;
+    if (pcejson_parse_chunk_end(parser, &root) == PCEJSON_SUCCESS) {
+        ret = pcvcm_eval(root, NULL, false);
+        pcvcm_node_destroy(root);
+    }
+
+    return ret;
+}
+
 bool
 pcintr_save_async_request_id(pcintr_stack_t stack, purc_variant_t req_id)
 {
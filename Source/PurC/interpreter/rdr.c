@@ -41,12 +41,19 @@
 #define LAYOUT_STYLE_KEY        "layoutStyle"
 #define TOOLKIT_STYLE_KEY       "toolkitStyle"
 
-#define BUFF_MIN                1024
-#define BUFF_MAX                1024 * 1024 * 4
 #define LEN_BUFF_LONGLONGINT    128
 
 #define DEF_LEN_ONE_WRITE       1024 * 10
 
+/* the room reserved for the header lines of a request message */
+#define LEN_RESERVED_HEADERS    1024
+
+/* the max number of writeBegin/writeMore requests waiting for responses */
+#define MAX_WRITES_IN_FLIGHT    8
+
+/* the timeout in milliseconds when waiting for a free slot */
+#define TIMEOUT_WAIT_SLOT       100
+
 static struct pcintr_rdr_data_type {
     const char *type_name;
     pcrdr_msg_data_type type;
@@ -811,108 +818,237 @@ pcintr_attach_to_renderer(pcintr_coroutine_t cor,
     return true;
 }
 
-static pcrdr_msg *
-rdr_page_control_load_large_page(struct pcrdr_conn *conn,
-        pcrdr_msg_target target, uint64_t target_value,
-        pcrdr_msg_data_type data_type,
-        const char *doc_content, size_t len_content)
+/*
+ * The page writer splits the serialized document into UTF-8-safe chunks
+ * while the document is being serialized, and sends the chunks by
+ * writeBegin/writeMore requests without waiting for the responses one by
+ * one; only the final writeEnd (or load) waits for the response.
+ */
+struct page_writer {
+    struct pcrdr_conn  *conn;
+    pcrdr_msg_target    target;
+    uint64_t            target_value;
+    pcrdr_msg_data_type data_type;
+
+    size_t              sz_chunk;
+
+    /* the bytes serialized but not sent yet; always null-terminated */
+    char               *buf;
+    size_t              len;
+    size_t              sz_buf;
+
+    unsigned            nr_sent;
+    unsigned            nr_in_flight;
+    unsigned            failed:1;
+    /* the writer is freed by the last response handler if set */
+    unsigned            abandoned:1;
+};
+
+static size_t
+rdr_chunk_size(struct pcinst *inst)
 {
-    pcrdr_msg *response_msg = NULL;
-    pcrdr_msg_element_type element_type = PCRDR_MSG_ELEMENT_TYPE_VOID;
-    purc_variant_t data;
-    size_t len_wrotten;
-    size_t len_to_write = 0;
+    /* The renderers speaking the current protocol hold a payload up to
+       PCRDR_MAX_INMEM_PAYLOAD_SIZE in memory; be conservative for others. */
+    if (inst->rdr_caps &&
+            inst->rdr_caps->prot_version >= PCRDR_PURCMC_PROTOCOL_VERSION) {
+        return PCRDR_MAX_INMEM_PAYLOAD_SIZE - LEN_RESERVED_HEADERS;
+    }
 
-    // writeBegin
-    const char *start = doc_content;
-    const char *end;
-    pcutils_string_check_utf8_len(start, DEF_LEN_ONE_WRITE, NULL, &end);
-    if (end > start) {
-        len_to_write = end - start;
+    return DEF_LEN_ONE_WRITE;
+}
 
-        data = purc_variant_make_string_static(start, false);
-        len_wrotten = len_to_write;
+static void
+page_writer_release(struct page_writer *writer)
+{
+    if (writer->nr_in_flight > 0) {
+        writer->abandoned = 1;
+        return;
     }
-    else {
-        LOG_ERROR("No valid character in document content\n");
-        goto failed;
+
+    if (writer->buf)
+        free(writer->buf);
+    free(writer);
+}
+
+static int
+on_chunk_written(pcrdr_conn* conn, const char *request_id, int state,
+        void *context, const pcrdr_msg *response_msg)
+{
+    UNUSED_PARAM(conn);
+    UNUSED_PARAM(request_id);
+
+    struct page_writer *writer = context;
+
+    PC_ASSERT(writer->nr_in_flight > 0);
+    writer->nr_in_flight--;
+
+    if (state != PCRDR_RESPONSE_RESULT ||
+            response_msg->retCode != PCRDR_SC_OK) {
+        PC_ERROR("failed to write content to rdr\n");
+        writer->failed = 1;
     }
 
-    response_msg = pcintr_rdr_send_request_and_wait_response(
-            conn, target, target_value, PCRDR_OPERATION_WRITEBEGIN,
-            element_type, NULL, NULL, data_type, data, len_to_write);
-    if (response_msg == NULL) {
-        goto failed;
+    if (writer->abandoned && writer->nr_in_flight == 0) {
+        writer->abandoned = 0;
+        page_writer_release(writer);
     }
 
-    if (response_msg->retCode != PCRDR_SC_OK) {
-        PC_ERROR("failed to write content to rdr\n");
-        goto failed;
+    return 0;
+}
+
+static pcrdr_msg *
+make_write_request(struct page_writer *writer, const char *operation,
+        size_t len)
+{
+    pcrdr_msg *msg = pcrdr_make_request_message(
+            writer->target,                     /* target */
+            writer->target_value,               /* target_value */
+            operation,                          /* operation */
+            NULL,                               /* request_id */
+            NULL,                               /* source_uri */
+            PCRDR_MSG_ELEMENT_TYPE_VOID,        /* element_type */
+            NULL,                               /* element */
+            NULL,                               /* property */
+            PCRDR_MSG_DATA_TYPE_VOID,           /* data_type */
+            NULL,                               /* data */
+            0                                   /* data_len */
+            );
+    if (msg == NULL) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return NULL;
     }
 
-    if (len_wrotten == len_content) {
-        goto done;
+    /* copy the chunk: the message may be moved to another instance and
+       read after the buffer is shifted or reallocated */
+    msg->data = purc_variant_make_string_ex(writer->buf, len, false);
+    if (msg->data == PURC_VARIANT_INVALID) {
+        pcrdr_release_message(msg);
+        return NULL;
     }
 
-writting:
-    len_to_write = 0;
-    if (len_wrotten + DEF_LEN_ONE_WRITE > len_content) {
-        // writeEnd
-        data = purc_variant_make_string_static(doc_content + len_wrotten,
-                false);
-        response_msg = pcintr_rdr_send_request_and_wait_response(
-                conn, target, target_value, PCRDR_OPERATION_WRITEEND,
-                element_type, NULL, NULL, data_type, data, 0);
-        if (response_msg == NULL) {
-            goto failed;
-        }
+    msg->dataType = writer->data_type;
+    msg->textLen = len;
+    return msg;
+}
 
-        if (response_msg->retCode != PCRDR_SC_OK) {
-            PC_ERROR("failed to write content to rdr\n");
-            goto failed;
-        }
-        goto done;
+/* Send the head of the buffer (up to max bytes) by writeBegin/writeMore. */
+static int
+page_writer_send_chunk(struct page_writer *writer, size_t max)
+{
+    const char *end;
+
+    pcutils_string_check_utf8_len(writer->buf, max, NULL, &end);
+    size_t len = end - writer->buf;
+    if (len == 0) {
+        PC_WARN("no valid character for rdr\n");
+        goto failed;
     }
-    else {
-        // writeMore
-        start = doc_content + len_wrotten;
-        pcutils_string_check_utf8_len(start, DEF_LEN_ONE_WRITE, NULL, &end);
-        if (end > start) {
-            len_to_write = end - start;
-            len_wrotten += len_to_write;
-            data = purc_variant_make_string_static(start, false);
-        }
-        else {
-            PC_WARN("no valid character for rdr\n");
-            goto failed;
-        }
 
-        response_msg = pcintr_rdr_send_request_and_wait_response(
-                conn, target, target_value, PCRDR_OPERATION_WRITEMORE,
-                element_type, NULL, NULL, data_type, data, len_to_write);
-        if (response_msg == NULL) {
+    while (writer->nr_in_flight >= MAX_WRITES_IN_FLIGHT && !writer->failed) {
+        if (pcrdr_wait_and_dispatch_message(writer->conn,
+                    TIMEOUT_WAIT_SLOT) < 0 &&
+                purc_get_last_error() != PCRDR_ERROR_TIMEOUT) {
             goto failed;
         }
+    }
 
-        if (response_msg->retCode != PCRDR_SC_OK) {
-            PC_ERROR("failed to write content to rdr\n");
-            goto failed;
+    if (writer->failed)
+        return -1;
+
+    pcrdr_msg *msg = make_write_request(writer, writer->nr_sent ?
+            PCRDR_OPERATION_WRITEMORE : PCRDR_OPERATION_WRITEBEGIN, len);
+    if (msg == NULL)
+        goto failed;
+
+    int ret = pcrdr_send_request(writer->conn, msg,
+            PCRDR_TIME_DEF_EXPECTED, writer, on_chunk_written);
+    pcrdr_release_message(msg);
+    if (ret < 0)
+        goto failed;
+
+    writer->nr_in_flight++;
+    writer->nr_sent++;
+
+    writer->len -= len;
+    memmove(writer->buf, writer->buf + len, writer->len + 1);
+    return 0;
+
+failed:
+    writer->failed = 1;
+    return -1;
+}
+
+static ssize_t
+page_writer_write(void *ctxt, const void *buf, size_t count)
+{
+    struct page_writer *writer = ctxt;
+
+    if (writer->failed)
+        return -1;
+
+    if (writer->len + count + 1 > writer->sz_buf) {
+        size_t sz = writer->sz_buf * 2;
+        while (sz < writer->len + count + 1)
+            sz *= 2;
+
+        char *p = realloc(writer->buf, sz);
+        if (p == NULL) {
+            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            writer->failed = 1;
+            return -1;
         }
+        writer->buf = p;
+        writer->sz_buf = sz;
+    }
+
+    memcpy(writer->buf + writer->len, buf, count);
+    writer->len += count;
+    writer->buf[writer->len] = 0;
+
+    /* always keep one chunk at least for writeEnd */
+    while (writer->len >= writer->sz_chunk * 2) {
+        if (page_writer_send_chunk(writer, writer->sz_chunk))
+            return -1;
+    }
+
+    return count;
+}
+
+/* Send the rest by writeEnd (or load if nothing sent) and wait for it. */
+static pcrdr_msg *
+page_writer_finish(struct page_writer *writer)
+{
+    pcrdr_msg *response_msg = NULL;
+    const char *operation = PCRDR_OPERATION_LOAD;
+
+    if (writer->failed)
+        return NULL;
 
-        if (len_wrotten == len_content) {
-            goto done;
+    if (writer->nr_sent > 0 || writer->len > writer->sz_chunk) {
+        while (writer->len > writer->sz_chunk) {
+            if (page_writer_send_chunk(writer, writer->sz_chunk))
+                return NULL;
         }
-        goto writting;
+        operation = PCRDR_OPERATION_WRITEEND;
     }
 
-done:
-    return response_msg;
+    pcrdr_msg *msg = make_write_request(writer, operation, writer->len);
+    if (msg == NULL)
+        return NULL;
 
-failed:
-    if (response_msg) {
+    /* the responses to the chunks come before this one */
+    if (pcrdr_send_request_and_wait_response(writer->conn, msg,
+            PCRDR_TIME_DEF_EXPECTED, &response_msg) < 0) {
+        response_msg = NULL;
+    }
+    pcrdr_release_message(msg);
+
+    if (response_msg && writer->failed) {
         pcrdr_release_message(response_msg);
+        response_msg = NULL;
     }
-    return NULL;
+
+    return response_msg;
 }
 
 bool
@@ -934,6 +1070,7 @@ pcintr_rdr_page_control_load(pcintr_stack_t stack)
     pcrdr_msg_data_type data_type = doc->def_text_type;// VW
     purc_variant_t req_data = PURC_VARIANT_INVALID;
     purc_rwstream_t out = NULL;
+    struct page_writer *writer = NULL;
 
     switch (stack->co->target_page_type) {
     case PCRDR_PAGE_TYPE_NULL:
@@ -968,7 +1105,26 @@ pcintr_rdr_page_control_load(pcintr_stack_t stack)
     else {
         unsigned opt = 0;
 
-        out = purc_rwstream_new_buffer(BUFF_MIN, BUFF_MAX);
+        writer = calloc(1, sizeof(*writer));
+        if (writer == NULL) {
+            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            goto failed;
+        }
+
+        writer->conn = inst->conn_to_rdr;
+        writer->target = target;
+        writer->target_value = target_value;
+        writer->data_type = data_type;
+        writer->sz_chunk = rdr_chunk_size(inst);
+        writer->sz_buf = writer->sz_chunk * 2 + 1;
+        writer->buf = malloc(writer->sz_buf);
+        if (writer->buf == NULL) {
+            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            goto failed;
+        }
+        writer->buf[0] = 0;
+
+        out = purc_rwstream_new_for_dump(writer, page_writer_write);
         if (out == NULL) {
             goto failed;
         }
@@ -979,36 +1135,17 @@ pcintr_rdr_page_control_load(pcintr_stack_t stack)
         opt |= PCDOC_SERIALIZE_OPT_FULL_DOCTYPE;
         opt |= PCDOC_SERIALIZE_OPT_WITH_HVML_HANDLE;
 
+        /* the chunks are sent while serializing */
         if (0 != purc_document_serialize_contents_to_stream(doc, opt, out)) {
             goto failed;
         }
 
-        size_t sz_content = 0;
-        size_t sz_buff = 0;
-        char *p = (char*)purc_rwstream_get_mem_buffer_ex(out, &sz_content,
-                &sz_buff,true);
-        req_data = purc_variant_make_string_reuse_buff(p, sz_content, false);
-        if (req_data == PURC_VARIANT_INVALID) {
-            free(p);
-            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-            goto failed;
-        }
-
-        if (sz_content > DEF_LEN_ONE_WRITE) {
-            response_msg = rdr_page_control_load_large_page(inst->conn_to_rdr,
-                        target, target_value, data_type,
-                        p, sz_content);
-        }
-        else {
-            response_msg = pcintr_rdr_send_request_and_wait_response(
-                    inst->conn_to_rdr, target, target_value, operation,
-                    element_type, NULL, NULL, data_type, req_data, 0);
-        }
+        purc_rwstream_destroy(out);
+        out = NULL;
 
-        if (out) {
-            purc_rwstream_destroy(out);
-            out = NULL;
-        }
+        response_msg = page_writer_finish(writer);
+        page_writer_release(writer);
+        writer = NULL;
     }
 
     if (response_msg == NULL) {
@@ -1034,6 +1171,10 @@ failed:
         purc_rwstream_destroy(out);
     }
 
+    if (writer) {
+        page_writer_release(writer);
+    }
+
     /* VW: double free here
     if (req_data != PURC_VARIANT_INVALID) {
         purc_variant_unref(req_data);
@@ -1054,29 +1195,27 @@ static const char *rdr_ops[] = {
     "",     // unknown
 };
 
-pcrdr_msg *
-pcintr_rdr_send_dom_req(pcintr_stack_t stack, pcdoc_operation op,
-        pcdoc_element_t element, const char* property,
-        pcrdr_msg_data_type data_type, purc_variant_t data)
+static bool
+dom_target_ready(pcintr_stack_t stack)
 {
     if (!stack) {
-        return NULL;
+        return false;
     }
 
     pcintr_coroutine_t co = stack->co;
     if (co->target_page_handle == 0 || co->target_dom_handle == 0) {
         if (!co->stack.inherit) {
-            return NULL;
+            return false;
         }
 
         pcintr_coroutine_t parent = pcintr_coroutine_get_by_id(co->curator);
         if (!parent || parent->stack.doc != co->stack.doc) {
-            return NULL;
+            return false;
         }
 
         if (parent->target_page_handle == 0
                 || parent->target_page_handle == 0) {
-            return NULL;
+            return false;
         }
 
         co->target_workspace_handle = parent->target_workspace_handle;
@@ -1086,6 +1225,21 @@ pcintr_rdr_send_dom_req(pcintr_stack_t stack, pcdoc_operation op,
     }
 
     if (co->stage != CO_STAGE_OBSERVING && !co->stack.inherit) {
+        return false;
+    }
+
+    return true;
+}
+
+/* if the renderer refuses the request, the result value of the response
+   is returned through failed_value if it is not NULL */
+static pcrdr_msg *
+send_dom_req(pcintr_stack_t stack, pcdoc_operation op,
+        pcrdr_msg_element_type element_type, const char *element_value,
+        const char* property, pcrdr_msg_data_type data_type,
+        purc_variant_t data, uint64_t *failed_value)
+{
+    if (!dom_target_ready(stack)) {
         return NULL;
     }
 
@@ -1099,24 +1253,10 @@ pcintr_rdr_send_dom_req(pcintr_stack_t stack, pcdoc_operation op,
 
     pcrdr_msg_target target = PCRDR_MSG_TARGET_DOM;
     uint64_t target_value = stack->co->target_dom_handle;
-    pcrdr_msg_element_type element_type = PCRDR_MSG_ELEMENT_TYPE_HANDLE;
-
-    char elem[LEN_BUFF_LONGLONGINT];
-    int n = snprintf(elem, sizeof(elem),
-            "%llx", (unsigned long long int)(uint64_t)element);
-    if (n < 0) {
-        purc_set_error(PURC_ERROR_BAD_STDC_CALL);
-        goto failed;
-    }
-    else if ((size_t)n >= sizeof (elem)) {
-        PC_DEBUG ("Too small elemer to serialize message.\n");
-        purc_set_error(PURC_ERROR_TOO_SMALL_BUFF);
-        goto failed;
-    }
 
     struct pcinst *inst = pcinst_current();
     response_msg = pcintr_rdr_send_request_and_wait_response(inst->conn_to_rdr,
-        target, target_value, operation, element_type, elem,
+        target, target_value, operation, element_type, element_value,
         property, data_type, data, 0);
 
     if (response_msg == NULL) {
@@ -1125,6 +1265,8 @@ pcintr_rdr_send_dom_req(pcintr_stack_t stack, pcdoc_operation op,
 
     int ret_code = response_msg->retCode;
     if (ret_code != PCRDR_SC_OK) {
+        if (failed_value)
+            *failed_value = response_msg->resultValue;
         purc_set_error(PCRDR_ERROR_SERVER_REFUSED);
         goto failed;
     }
@@ -1138,67 +1280,189 @@ failed:
     return NULL;
 }
 
+static bool
+flush_dom_batch(pcintr_stack_t stack, struct pcintr_rdr_dom_batch *batch);
+
 pcrdr_msg *
-pcintr_rdr_send_dom_req_raw(pcintr_stack_t stack, pcdoc_operation op,
+pcintr_rdr_send_dom_req(pcintr_stack_t stack, pcdoc_operation op,
         pcdoc_element_t element, const char* property,
-        pcrdr_msg_data_type data_type, const char *data, size_t len)
+        pcrdr_msg_data_type data_type, purc_variant_t data)
 {
-    if (!stack) {
+    /* keep the order of the requests */
+    if (stack && stack->rdr_batch) {
+        flush_dom_batch(stack, stack->rdr_batch);
+    }
+
+    char elem[LEN_BUFF_LONGLONGINT];
+    int n = snprintf(elem, sizeof(elem),
+            "%llx", (unsigned long long int)(uint64_t)element);
+    if (n < 0) {
+        purc_set_error(PURC_ERROR_BAD_STDC_CALL);
+        return NULL;
+    }
+    else if ((size_t)n >= sizeof (elem)) {
+        PC_DEBUG ("Too small elemer to serialize message.\n");
+        purc_set_error(PURC_ERROR_TOO_SMALL_BUFF);
         return NULL;
     }
 
-    pcintr_coroutine_t co = stack->co;
-    if (co->target_page_handle == 0 || co->target_dom_handle == 0) {
-        if (!co->stack.inherit) {
-            return NULL;
-        }
+    return send_dom_req(stack, op, PCRDR_MSG_ELEMENT_TYPE_HANDLE, elem,
+            property, data_type, data, NULL);
+}
 
-        pcintr_coroutine_t parent = pcintr_coroutine_get_by_id(co->curator);
-        if (!parent || parent->stack.doc != co->stack.doc) {
-            return NULL;
-        }
+static purc_variant_t
+make_dom_req_data(pcrdr_msg_data_type data_type, const char *data, size_t len)
+{
+    purc_variant_t req_data;
+    if (data_type == PCRDR_MSG_DATA_TYPE_JSON) {
+        req_data = purc_variant_make_from_json_string(data, len);
+    }
+    else {  /* VW: for other data types */
+        req_data = purc_variant_make_string(data, false);
+    }
 
-        if (parent->target_page_handle == 0
-                || parent->target_page_handle == 0) {
-            return NULL;
-        }
+    if (req_data == PURC_VARIANT_INVALID) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    }
+    return req_data;
+}
 
-        co->target_workspace_handle = parent->target_workspace_handle;
-        co->target_page_type = parent->target_page_type;
-        co->target_page_handle = parent->target_page_handle;
-        co->target_dom_handle = parent->target_dom_handle;
+pcrdr_msg *
+pcintr_rdr_send_dom_req_raw(pcintr_stack_t stack, pcdoc_operation op,
+        pcdoc_element_t element, const char* property,
+        pcrdr_msg_data_type data_type, const char *data, size_t len)
+{
+    if (!dom_target_ready(stack)) {
+        return NULL;
     }
 
-    if (co->stage != CO_STAGE_OBSERVING && !co->stack.inherit) {
+    purc_variant_t req_data = make_dom_req_data(data_type, data, len);
+    if (req_data == PURC_VARIANT_INVALID) {
         return NULL;
     }
 
-    pcrdr_msg *ret = NULL;
+    return pcintr_rdr_send_dom_req(stack, op, element,
+            property, data_type, req_data);
+}
+
+static bool
+flush_dom_batch(pcintr_stack_t stack, struct pcintr_rdr_dom_batch *batch)
+{
+    if (batch->nr_handles == 0)
+        return true;
+
+    bool ret = false;
     purc_variant_t req_data = PURC_VARIANT_INVALID;
-    if (data_type == PCRDR_MSG_DATA_TYPE_JSON) {
-        req_data = purc_variant_make_from_json_string(data, len);
-        if (req_data == PURC_VARIANT_INVALID) {
-            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-            goto failed;
+    if (dom_target_ready(stack)) {
+        req_data = make_dom_req_data(batch->data_type, batch->data, batch->len);
+    }
+
+    if (req_data != PURC_VARIANT_INVALID) {
+        uint64_t failed_idx = UINT64_MAX;
+        pcrdr_msg *response_msg = send_dom_req(stack, batch->op,
+                batch->nr_handles > 1 ?  PCRDR_MSG_ELEMENT_TYPE_HANDLES :
+                    PCRDR_MSG_ELEMENT_TYPE_HANDLE,
+                batch->handles, batch->property, batch->data_type, req_data,
+                &failed_idx);
+        if (response_msg != NULL) {
+            pcrdr_release_message(response_msg);
+            ret = true;
+        }
+        else if (batch->nr_handles > 1 && failed_idx < batch->nr_handles) {
+            /* tell the element failed rather than the whole batch */
+            const char *handle = batch->handles;
+            for (uint64_t i = 0; i < failed_idx; i++)
+                handle = strchr(handle, ',') + 1;
+            size_t len = strcspn(handle, ",");
+
+            PC_WARN("Renderer refused %s on element %.*s (%zu of %zu)\n",
+                    rdr_ops[batch->op], (int)len, handle,
+                    (size_t)failed_idx + 1, batch->nr_handles);
+            purc_set_error_with_info(PCRDR_ERROR_SERVER_REFUSED,
+                    "element: %.*s", (int)len, handle);
         }
     }
-    else {  /* VW: for other data types */
-        req_data = purc_variant_make_string(data, false);
-        if (req_data == PURC_VARIANT_INVALID) {
+
+    free(batch->property);
+    free(batch->data);
+    batch->property = NULL;
+    batch->data = NULL;
+    batch->nr_handles = 0;
+    batch->handles[0] = 0;
+    return ret;
+}
+
+static bool
+add_to_dom_batch(pcintr_stack_t stack, pcdoc_operation op,
+        pcdoc_element_t element, const char *property,
+        pcrdr_msg_data_type data_type, const char *data, size_t len)
+{
+    struct pcintr_rdr_dom_batch *batch = stack->rdr_batch;
+    bool ret = true;
+
+    if (!dom_target_ready(stack)) {
+        return false;
+    }
+
+    if (batch->nr_handles > 0 && (batch->nr_handles == PCRDR_MAX_HANDLES ||
+                batch->op != op || batch->data_type != data_type ||
+                batch->len != len || memcmp(batch->data, data, len) ||
+                (batch->property == NULL) != (property == NULL) ||
+                (property && strcmp(batch->property, property)))) {
+        ret = flush_dom_batch(stack, batch);
+    }
+
+    if (batch->nr_handles == 0) {
+        batch->data = malloc(len + 1);
+        batch->property = property ? strdup(property) : NULL;
+        if (batch->data == NULL || (property && batch->property == NULL)) {
+            free(batch->data);
+            free(batch->property);
+            batch->data = NULL;
+            batch->property = NULL;
             purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-            goto failed;
+            return false;
         }
+
+        memcpy(batch->data, data, len);
+        batch->data[len] = 0;
+        batch->len = len;
+        batch->op = op;
+        batch->data_type = data_type;
     }
 
-    ret = pcintr_rdr_send_dom_req(stack, op, element,
-            property, data_type, req_data);
+    size_t used = strlen(batch->handles);
+    snprintf(batch->handles + used, sizeof(batch->handles) - used,
+            batch->nr_handles ? ",%llx" : "%llx",
+            (unsigned long long int)(uint64_t)element);
+    batch->nr_handles++;
     return ret;
+}
 
-failed:
-    if (req_data != PURC_VARIANT_INVALID) {
-        purc_variant_unref(req_data);
+bool
+pcintr_rdr_begin_dom_batch(pcintr_stack_t stack,
+        struct pcintr_rdr_dom_batch *batch)
+{
+    struct pcinst *inst = pcinst_current();
+    if (stack->rdr_batch || inst->rdr_caps == NULL ||
+            !(inst->rdr_caps->selectors & PCRDR_K_SELECTOR_HANDLES_b)) {
+        return false;
     }
-    return ret;
+
+    memset(batch, 0, sizeof(*batch));
+    stack->rdr_batch = batch;
+    return true;
+}
+
+bool
+pcintr_rdr_end_dom_batch(pcintr_stack_t stack)
+{
+    struct pcintr_rdr_dom_batch *batch = stack->rdr_batch;
+    if (batch == NULL)
+        return true;
+
+    stack->rdr_batch = NULL;
+    return flush_dom_batch(stack, batch);
 }
 
 bool
@@ -1229,6 +1493,12 @@ pcintr_rdr_send_dom_req_simple_raw(pcintr_stack_t stack,
         data = " ";
         len = 1;
     }
+
+    if (stack && stack->rdr_batch) {
+        return add_to_dom_batch(stack, op, element, property, data_type,
+                data, len);
+    }
+
     pcrdr_msg *response_msg = pcintr_rdr_send_dom_req_raw(stack, op,
             element, property, data_type, data, len);
 
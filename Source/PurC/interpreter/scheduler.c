@@ -35,33 +35,170 @@
 #include "private/variant.h"
 #include "private/ports.h"
 #include "private/msg-queue.h"
+#include "private/channel.h"
 
 #include <stdlib.h>
 #include <string.h>
 
 #include <sys/time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
 
 #define SCHEDULE_SLEEP          10 * 1000       // usec
 #define IDLE_EVENT_TIMEOUT      100             // ms
 #define TIME_SLIECE             0.005           // s
+#define STATS_RATE_WINDOW       1000            // ms
 
 #define BUILTIN_VAR_CRTN        PURC_PREDEF_VARNAME_CRTN
 
 #define YIELD_EVENT_HANDLER     "_yield_event_handler"
 #define ATTR_FOR                "for"
 
-static inline time_t
-timespec_to_ms(const struct timespec *ts)
+static inline uint64_t
+timespec_to_ns(const struct timespec *ts)
 {
-    return ts->tv_sec * 1000 + ts->tv_nsec * 1.0E-6;
+    return (uint64_t)ts->tv_sec * 1000000000 + ts->tv_nsec;
 }
 
-static time_t
-pcintr_monotonic_time_ms()
+static inline uint64_t
+monotonic_ns(void)
 {
     struct timespec ts;
     clock_gettime(CLOCK_MONOTONIC, &ts);
-    return timespec_to_ms(&ts);
+    return timespec_to_ns(&ts);
+}
+
+static void
+on_stopped_timeout(struct pcutils_timer *timer)
+{
+    pcintr_coroutine_t co;
+    co = container_of(timer, struct pcintr_coroutine, stopped_timer);
+
+    /* the wheel counts in milliseconds and fires up to 1ms early;
+       leave the rest of the deadline to resume_due_coroutines() */
+    if (co->stopped_deadline > monotonic_ns()) {
+        pcintr_heap_t heap = co->owner;
+        if (heap->fine_deadline == 0 ||
+                co->stopped_deadline < heap->fine_deadline) {
+            heap->fine_deadline = co->stopped_deadline;
+        }
+        return;
+    }
+
+    co->stack.timeout = true;
+    pcintr_resume_coroutine(co);
+}
+
+/* resume the stopped coroutines whose deadlines passed after their timeouts
+   fired early */
+static void
+resume_due_coroutines(struct pcintr_heap *heap)
+{
+    uint64_t now = monotonic_ns();
+    if (heap->fine_deadline == 0 || heap->fine_deadline > now) {
+        return;
+    }
+
+    heap->fine_deadline = 0;
+
+    pcintr_coroutine_t p, q;
+    list_for_each_entry_safe(p, q, &heap->stopped_crtns, ln) {
+        if (p->stopped_deadline == 0 ||
+                pcutils_timer_is_armed(&p->stopped_timer)) {
+            continue;
+        }
+
+        if (p->stopped_deadline <= now) {
+            p->stack.timeout = true;
+            pcintr_resume_coroutine(p);
+        }
+        else if (heap->fine_deadline == 0 ||
+                p->stopped_deadline < heap->fine_deadline) {
+            heap->fine_deadline = p->stopped_deadline;
+        }
+    }
+}
+
+/* sleep till the next timer expires, but no longer than SCHEDULE_SLEEP */
+static unsigned long long
+schedule_sleep_time(struct pcinst *inst)
+{
+    if (!inst || !inst->intr_heap) {
+        return SCHEDULE_SLEEP;
+    }
+
+    unsigned long long max_sleep = SCHEDULE_SLEEP;
+
+    /* a deadline within the current millisecond; sleep to it in usec */
+    uint64_t fine = inst->intr_heap->fine_deadline;
+    if (fine) {
+        uint64_t now_ns = monotonic_ns();
+        if (fine <= now_ns) {
+            return 0;
+        }
+        if ((fine - now_ns) / 1000 < max_sleep) {
+            max_sleep = (fine - now_ns) / 1000;
+        }
+    }
+
+    uint64_t next, now;
+    next = pcutils_timer_wheel_next_expiry(inst->intr_heap->timer_wheel);
+    now = pcutils_timer_wheel_now();
+    if (next <= now) {
+        return 0;
+    }
+    if ((next - now) * 1000 < max_sleep) {
+        return (next - now) * 1000;
+    }
+    return max_sleep;
+}
+
+/* the rate of the handled messages reported by $RUNNER.stats is
+   computed over fixed windows, independent of how often it is read */
+static void
+update_stats_rate(struct pcintr_heap *heap)
+{
+    uint64_t now = pcutils_timer_wheel_now();
+    if (heap->stats_time_mark == 0) {
+        heap->stats_msgs_mark = heap->nr_msgs_handled;
+        heap->stats_time_mark = now;
+    }
+    else if (now - heap->stats_time_mark >= STATS_RATE_WINDOW) {
+        heap->msgs_per_second =
+            (heap->nr_msgs_handled - heap->stats_msgs_mark) *
+            1000.0 / (now - heap->stats_time_mark);
+        heap->stats_msgs_mark = heap->nr_msgs_handled;
+        heap->stats_time_mark = now;
+    }
+}
+
+/* while any coroutine is waiting on a global channel, the peers on other
+   instances wake us up through the notification descriptor of the move
+   buffer (see signal_waiters() in global-channel.c); sleep on it instead
+   of polling the waits. */
+static void
+schedule_sleep(struct pcinst *inst)
+{
+    unsigned long long usec = schedule_sleep_time(inst);
+    int fd = -1;
+
+    if (inst && inst->intr_heap &&
+            !list_empty(&inst->intr_heap->chan_waiters)) {
+        fd = purc_inst_move_buffer_fd();
+    }
+
+    if (fd < 0 || usec < 1000) {
+        pcutils_usleep(usec);
+        return;
+    }
+
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    if (poll(&pfd, 1, (int)(usec / 1000)) > 0 && (pfd.revents & POLLIN)) {
+        /* drain the descriptor; the messages stay in the move buffer */
+        uint64_t buf[8];
+        while (read(fd, buf, sizeof(buf)) > 0 || errno == EINTR);
+    }
 }
 
 static void
@@ -502,33 +639,12 @@ execute_one_step(struct pcinst *inst)
     struct pcintr_heap *heap = inst->intr_heap;
 
     pcintr_coroutine_t p, q;
-    pcintr_coroutine_t co;
     struct list_head *crtns;
 
-    time_t now = pcintr_monotonic_time_ms();
-
-    pcutils_array_t *cos = pcutils_array_create();
-    if (!cos) {
-        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-        return false;
-    }
-
-    size_t nr = pcutils_sorted_array_count(heap->wait_timeout_crtns);
-    for (size_t i = 0; i < nr; i++) {
-        pcutils_sorted_array_get(heap->wait_timeout_crtns, i, (void **)&co);
-        if (now < co->stopped_timeout) {
-            break;
-        }
-        co->stack.timeout = true;
-        pcutils_array_push(cos, co);
-    }
-
-    nr = pcutils_array_length(cos);
-    for (size_t i = 0; i < nr; i++) {
-        co = pcutils_array_get(cos, i);
-        pcintr_resume_coroutine(co);
-    }
-    pcutils_array_destroy(cos, true);
+    /* resume the coroutines timed out and fire the expired timers */
+    pcutils_timer_wheel_advance(heap->timer_wheel,
+            pcutils_timer_wheel_now());
+    resume_due_coroutines(heap);
 
 
     crtns = &heap->crtns;
@@ -621,6 +737,7 @@ handle_coroutine_event(pcintr_coroutine_t co)
     int handle_ret = PURC_ERROR_INCOMPLETED;
     bool busy = false;
     bool msg_observed = false;
+    bool hvml_observed = false;
     char *type = NULL;
     purc_atom_t event_type = 0;
     const char *event_sub_type = NULL;
@@ -630,6 +747,8 @@ handle_coroutine_event(pcintr_coroutine_t co)
     }
 
     pcrdr_msg *msg = pcinst_msg_queue_get_msg(co->mq);
+    if (msg)
+        co->owner->nr_msgs_handled++;
 
     if (msg && msg->eventName) {
         const char *event = purc_variant_get_string_const(msg->eventName);
@@ -668,7 +787,8 @@ handle_coroutine_event(pcintr_coroutine_t co)
         else {
             handle_ret = handle_event_by_observer_list(co,
                     &co->stack.hvml_observers, msg, event_type, event_sub_type,
-                    &msg_observed, &busy);
+                    &hvml_observed, &busy);
+            msg_observed = msg_observed || hvml_observed;
 
             if (handle_ret == PURC_ERROR_OK) {
                 pcrdr_release_message(msg);
@@ -693,6 +813,14 @@ handle_coroutine_event(pcintr_coroutine_t co)
 
     if (msg_observed) {
         pcinst_msg_queue_append(co->mq, msg);
+
+        /* an event observed by the program cuts the sleep short; it is
+           handled once the coroutine is observing */
+        if (hvml_observed && co->state == CO_STATE_STOPPED &&
+                co->stopped_interruptible) {
+            pcintr_resume_coroutine(co);
+            busy = true;
+        }
     }
     else {
         pcrdr_release_message(msg);
@@ -720,6 +848,10 @@ again:
 #endif
     check_and_dispatch_event_from_conn(inst);
 
+    if (pcchan_global_dispatch_waiters(inst->intr_heap) > 0) {
+        is_busy = true;
+    }
+
     bool co_is_busy = false;
     struct pcintr_heap *heap = inst->intr_heap;
     struct list_head *crtns = &heap->crtns;
@@ -776,6 +908,8 @@ pcintr_schedule(void *ctxt)
     }
 
 again:
+    // 0. update the rate window of the statistics
+    update_stats_rate(heap);
 
     // 1. exec one step for all ready coroutines and
     // return whether step is busy
@@ -798,7 +932,7 @@ again:
     }
 
 out_sleep:
-    pcutils_usleep(SCHEDULE_SLEEP);
+    schedule_sleep(inst);
 
     return;
 }
@@ -1010,20 +1144,24 @@ void pcintr_stop_coroutine(pcintr_coroutine_t crtn,
     pcintr_heap_t heap = crtn->owner;
     list_add_tail(&crtn->ln, &heap->stopped_crtns);
 
+    crtn->stopped_deadline = 0;
+    crtn->stopped_interruptible = false;
     if (timeout) {
-        time_t curr = pcintr_monotonic_time_ms();
-        crtn->stopped_timeout = curr + timespec_to_ms(timeout);
-    }
-    else {
-        crtn->stopped_timeout = -1;
-    }
-    if (crtn->stopped_timeout != -1) {
-        if (pcutils_sorted_array_add(heap->wait_timeout_crtns,
-                    (void *)(uintptr_t)crtn->stopped_timeout, crtn) < 0) {
-            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-        }
+        /* arm the wheel at the millisecond the deadline falls in;
+           on_stopped_timeout() waits for the rest of it */
+        crtn->stopped_deadline = monotonic_ns() + timespec_to_ns(timeout);
+        crtn->stopped_timer.fire = on_stopped_timeout;
+        pcutils_timer_wheel_arm(heap->timer_wheel, &crtn->stopped_timer,
+                crtn->stopped_deadline / 1000000);
     }
+}
 
+/* stop the specific coroutine till the timeout or an observed event */
+void pcintr_sleep_coroutine(pcintr_coroutine_t crtn,
+        const struct timespec *timeout)
+{
+    pcintr_stop_coroutine(crtn, timeout);
+    crtn->stopped_interruptible = true;
 }
 
 /* resume the specific coroutine */
@@ -1035,18 +1173,15 @@ void pcintr_resume_coroutine(pcintr_coroutine_t crtn)
     pcintr_heap_t heap = crtn->owner;
     list_add_tail(&crtn->ln, &heap->crtns);
 
-    if (crtn->stopped_timeout != -1) {
-        size_t nr = pcutils_sorted_array_count(heap->wait_timeout_crtns);
-        for (size_t i = 0; i < nr; i++) {
-            pcintr_coroutine_t co;
-            pcutils_sorted_array_get(heap->wait_timeout_crtns, i, (void **)&co);
-            if (co == crtn) {
-                pcutils_sorted_array_delete(heap->wait_timeout_crtns, i);
-                break;
-            }
-        }
-    }
+    pcutils_timer_wheel_cancel(heap->timer_wheel, &crtn->stopped_timer);
+}
 
-    crtn->stopped_timeout = -1;
+uint64_t pcintr_coroutine_remaining_time(pcintr_coroutine_t crtn)
+{
+    uint64_t now = monotonic_ns();
+    if (crtn->stopped_deadline > now) {
+        return crtn->stopped_deadline - now;
+    }
+    return 0;
 }
 
@@ -33,61 +33,69 @@
 #include "private/interpreter.h"
 #include "purc-runloop.h"
 
-#include <wtf/RunLoop.h>
-#include <wtf/Seconds.h>
-
 #include <stdlib.h>
 #include <string.h>
 
-class Timer : public PurCWTF::RunLoop::TimerBase {
-    public:
-        Timer(const char *id, pcintr_timer_fire_func func, RunLoop& runLoop,
-                void *data)
-            : TimerBase(runLoop)
-            , m_id(NULL)
-            , m_func(func)
-            , m_data(data)
-        {
-            m_id = id ? strdup(id) : NULL;
-        }
-
-        ~Timer()
-        {
-            stop();
-            if (m_id) {
-                free(m_id);
-            }
-        }
-
-        void setInterval(uint32_t interval) { m_interval = interval; }
-        uint32_t getInterval() { return m_interval; }
-        const char *getId() { return m_id; }
-        void *getData() { return m_data; }
+/* All timers of an instance go with the timer wheel of the interpreter
+   heap, and fire in the scheduler when the wheel is advanced. */
+struct pcintr_timer {
+    struct pcutils_timer        entry;
+    struct pcutils_timer_wheel *wheel;
+
+    char                       *id;
+    pcintr_timer_fire_func      func;
+    void                       *data;
+    uint32_t                    interval;
+    bool                        repeating;
+};
 
-        virtual void fired()
-        {
-            m_func(this, m_id, m_data);
-        }
+static void
+timer_fired(struct pcutils_timer *entry)
+{
+    struct pcintr_timer *timer;
+    timer = container_of(entry, struct pcintr_timer, entry);
 
-        virtual void processed(void) {}
+    /* re-arm before calling the function which may destroy the timer */
+    if (timer->repeating) {
+        pcutils_timer_wheel_arm(timer->wheel, &timer->entry,
+                pcutils_timer_wheel_now() + timer->interval);
+    }
 
-    private:
-        char *m_id;
-        pcintr_timer_fire_func m_func;
-        void *m_data;
-        uint32_t m_interval;
-};
+    timer->func(timer, timer->id, timer->data);
+}
 
 pcintr_timer_t
 pcintr_timer_create(purc_runloop_t runloop, const char* id,
         pcintr_timer_fire_func func, void *data)
 {
-    RunLoop* loop = runloop ? (RunLoop*)runloop : &RunLoop::current();
-    Timer* timer = new Timer(id, func, *loop, data);
+    UNUSED_PARAM(runloop);
+
+    struct pcintr_heap *heap = pcintr_get_heap();
+    if (!heap || !heap->timer_wheel) {
+        purc_set_error(PURC_ERROR_INVALID_VALUE);
+        return NULL;
+    }
+
+    struct pcintr_timer *timer;
+    timer = (struct pcintr_timer *)calloc(1, sizeof(*timer));
     if (!timer) {
         purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
         return NULL;
     }
+
+    if (id) {
+        timer->id = strdup(id);
+        if (!timer->id) {
+            free(timer);
+            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            return NULL;
+        }
+    }
+
+    pcutils_timer_init(&timer->entry, timer_fired);
+    timer->wheel = heap->timer_wheel;
+    timer->func = func;
+    timer->data = data;
     return timer;
 }
 
@@ -95,7 +103,7 @@ void
 pcintr_timer_set_interval(pcintr_timer_t timer, uint32_t interval)
 {
     if (timer) {
-        ((Timer*)timer)->setInterval(interval);
+        ((struct pcintr_timer *)timer)->interval = interval;
     }
 }
 
@@ -103,18 +111,24 @@ uint32_t
 pcintr_timer_get_interval(pcintr_timer_t timer)
 {
     if (timer) {
-        return ((Timer*)timer)->getInterval();
+        return ((struct pcintr_timer *)timer)->interval;
     }
     return 0;
 }
 
+static void
+timer_start(struct pcintr_timer *timer, bool repeating)
+{
+    timer->repeating = repeating;
+    pcutils_timer_wheel_arm(timer->wheel, &timer->entry,
+            pcutils_timer_wheel_now() + timer->interval);
+}
+
 void
 pcintr_timer_start(pcintr_timer_t timer)
 {
     if (timer) {
-        Timer* tm = (Timer*)timer;
-        tm->startRepeating(
-                PurCWTF::Seconds::fromMilliseconds(tm->getInterval()));
+        timer_start((struct pcintr_timer *)timer, true);
     }
 }
 
@@ -122,9 +136,7 @@ void
 pcintr_timer_start_oneshot(pcintr_timer_t timer)
 {
     if (timer) {
-        Timer* tm = (Timer*)timer;
-        tm->startOneShot(
-                PurCWTF::Seconds::fromMilliseconds(tm->getInterval()));
+        timer_start((struct pcintr_timer *)timer, false);
     }
 }
 
@@ -132,22 +144,29 @@ void
 pcintr_timer_stop(pcintr_timer_t timer)
 {
     if (timer) {
-        ((Timer*)timer)->stop();
+        struct pcintr_timer *tm = (struct pcintr_timer *)timer;
+        pcutils_timer_wheel_cancel(tm->wheel, &tm->entry);
     }
 }
 
 bool
 pcintr_timer_is_active(pcintr_timer_t timer)
 {
-    return timer ? ((Timer*)timer)->isActive() : false;
+    return timer ?
+        pcutils_timer_is_armed(&((struct pcintr_timer *)timer)->entry) :
+        false;
 }
 
 void
 pcintr_timer_destroy(pcintr_timer_t timer)
 {
     if (timer) {
-        Timer* tm = (Timer*)timer;
-        delete tm;
+        struct pcintr_timer *tm = (struct pcintr_timer *)timer;
+        pcutils_timer_wheel_cancel(tm->wheel, &tm->entry);
+        if (tm->id) {
+            free(tm->id);
+        }
+        free(tm);
     }
 }
 
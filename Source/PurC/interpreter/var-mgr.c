@@ -225,7 +225,114 @@ add_listener_for_co_variables(pcvarmgr_t mgr)
     return -1;
 }
 
-#define DEF_ARRAY_SIZE 10
+struct pcvarmgr_slot {
+    size_t              hash;
+    const char         *name;   /* NULL for an empty slot */
+    purc_variant_t      key;
+    purc_variant_t      val;    /* the object holds the reference */
+};
+
+#define MIN_NR_SLOTS    8
+
+static inline size_t
+name_hash(const char *name)
+{
+    return pcutils_hash_hash((const unsigned char *)name, strlen(name));
+}
+
+static struct pcvarmgr_slot *
+find_slot(pcvarmgr_t mgr, const char *name, size_t hash)
+{
+    if (mgr->nr_vars == 0)
+        return NULL;
+
+    size_t mask = mgr->nr_slots - 1;
+    for (size_t i = hash & mask; mgr->slots[i].name; i = (i + 1) & mask) {
+        struct pcvarmgr_slot *slot = mgr->slots + i;
+        if (slot->hash == hash && strcmp(slot->name, name) == 0)
+            return slot;
+    }
+
+    return NULL;
+}
+
+static void
+insert_slot(struct pcvarmgr_slot *slots, size_t nr_slots,
+        const struct pcvarmgr_slot *slot)
+{
+    size_t mask = nr_slots - 1;
+    size_t i = slot->hash & mask;
+    while (slots[i].name)
+        i = (i + 1) & mask;
+    slots[i] = *slot;
+}
+
+static bool
+index_set(pcvarmgr_t mgr, const char *name, purc_variant_t k,
+        purc_variant_t val)
+{
+    size_t hash = name_hash(name);
+    struct pcvarmgr_slot *slot = find_slot(mgr, name, hash);
+    if (slot) {
+        slot->val = val;
+        return true;
+    }
+
+    /* keep the load factor under 3/4 */
+    if ((mgr->nr_vars + 1) * 4 > mgr->nr_slots * 3) {
+        size_t nr_slots = mgr->nr_slots ? mgr->nr_slots * 2 : MIN_NR_SLOTS;
+        struct pcvarmgr_slot *slots = calloc(nr_slots, sizeof(*slots));
+        if (slots == NULL) {
+            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            return false;
+        }
+
+        for (size_t i = 0; i < mgr->nr_slots; i++) {
+            if (mgr->slots[i].name)
+                insert_slot(slots, nr_slots, mgr->slots + i);
+        }
+
+        free(mgr->slots);
+        mgr->slots = slots;
+        mgr->nr_slots = nr_slots;
+    }
+
+    struct pcvarmgr_slot new_slot = {
+        hash, purc_variant_get_string_const(k), purc_variant_ref(k), val };
+    insert_slot(mgr->slots, mgr->nr_slots, &new_slot);
+    mgr->nr_vars++;
+    return true;
+}
+
+static void
+index_remove(pcvarmgr_t mgr, const char *name)
+{
+    struct pcvarmgr_slot *slot = find_slot(mgr, name, name_hash(name));
+    if (slot == NULL)
+        return;
+
+    purc_variant_unref(slot->key);
+    mgr->nr_vars--;
+
+    /* shift back the following entries of the cluster */
+    size_t mask = mgr->nr_slots - 1;
+    size_t i = slot - mgr->slots;
+    size_t j = i;
+    while (true) {
+        j = (j + 1) & mask;
+        if (mgr->slots[j].name == NULL)
+            break;
+
+        size_t k = mgr->slots[j].hash & mask;
+        if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+            mgr->slots[i] = mgr->slots[j];
+            i = j;
+        }
+    }
+
+    memset(mgr->slots + i, 0, sizeof(*slot));
+}
+
 pcvarmgr_t pcvarmgr_create(void)
 {
     pcvarmgr_t mgr = (pcvarmgr_t)calloc(1,
@@ -267,6 +374,11 @@ int pcvarmgr_destroy(pcvarmgr_t mgr)
             purc_variant_revoke_listener(mgr->object, mgr->listener);
         }
         purc_variant_unref(mgr->object);
+        for (size_t i = 0; i < mgr->nr_slots; i++) {
+            if (mgr->slots[i].name)
+                purc_variant_unref(mgr->slots[i].key);
+        }
+        free(mgr->slots);
         free(mgr);
     }
     return 0;
@@ -290,12 +402,16 @@ bool pcvarmgr_add(pcvarmgr_t mgr, const char* name,
         return false;
     }
     bool ret = false;
-    purc_variant_t v = purc_variant_object_get(mgr->object, k);
-    if (v == PURC_VARIANT_INVALID) {
-        purc_clr_error();
+    struct pcvarmgr_slot *slot = find_slot(mgr, name, name_hash(name));
+    if (slot == NULL) {
         ret = purc_variant_object_set(mgr->object, k, variant);
+        if (ret && !index_set(mgr, name, k, variant)) {
+            purc_variant_object_remove_by_static_ckey(mgr->object, name, true);
+            ret = false;
+        }
     }
     else {
+        purc_variant_t v = slot->val;
         enum purc_variant_type type = purc_variant_get_type(v);
         switch (type) {
         case PURC_VARIANT_TYPE_OBJECT:
@@ -308,6 +424,8 @@ bool pcvarmgr_add(pcvarmgr_t mgr, const char* name,
         default:
             // XXX: observe on=$name
             ret = purc_variant_object_set(mgr->object, k, variant);
+            if (ret)
+                slot->val = variant;
             break;
         }
     }
@@ -316,6 +434,23 @@ bool pcvarmgr_add(pcvarmgr_t mgr, const char* name,
     return ret;
 }
 
+bool pcvarmgr_add_silently(pcvarmgr_t mgr, const char* name,
+        purc_variant_t variant)
+{
+    /* the handlers of the listener ignore the operations without context */
+    void *ctxt = NULL;
+    if (mgr->listener) {
+        ctxt = mgr->listener->ctxt;
+        mgr->listener->ctxt = NULL;
+    }
+
+    bool ret = pcvarmgr_add(mgr, name, variant);
+
+    if (mgr->listener)
+        mgr->listener->ctxt = ctxt;
+    return ret;
+}
+
 purc_variant_t pcvarmgr_get(pcvarmgr_t mgr, const char* name)
 {
     if (mgr == NULL || name == NULL) {
@@ -323,10 +458,9 @@ purc_variant_t pcvarmgr_get(pcvarmgr_t mgr, const char* name)
         return PURC_VARIANT_INVALID;
     }
 
-    purc_variant_t v;
-    v = purc_variant_object_get_by_ckey(mgr->object, name);
-    if (v) {
-        return v;
+    struct pcvarmgr_slot *slot = find_slot(mgr, name, name_hash(name));
+    if (slot) {
+        return slot->val;
     }
 
     purc_set_error_with_info(PCVARIANT_ERROR_NOT_FOUND, "name:%s", name);
@@ -336,8 +470,11 @@ purc_variant_t pcvarmgr_get(pcvarmgr_t mgr, const char* name)
 bool pcvarmgr_remove_ex(pcvarmgr_t mgr, const char* name, bool silently)
 {
     if (name) {
-        return purc_variant_object_remove_by_static_ckey(mgr->object,
+        bool ret = purc_variant_object_remove_by_static_ckey(mgr->object,
                 name, silently);
+        if (ret)
+            index_remove(mgr, name);
+        return ret;
     }
     return false;
 }
@@ -465,6 +602,13 @@ purc_get_runner_variable(const char* name)
     if (v) {
         return v;
     }
+
+    v = pcintr_make_builtin_runner_variable(name);
+    if (v) {
+        purc_clr_error();
+        return v;
+    }
+
     purc_set_error_with_info(PCVARIANT_ERROR_NOT_FOUND, "name:%s", name);
     return PURC_VARIANT_INVALID;
 }
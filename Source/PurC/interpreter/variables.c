@@ -169,82 +169,95 @@ add_runner_myobj_listener(purc_variant_t runner)
     return ret;
 }
 
-bool
-pcintr_bind_builtin_runner_variables(void)
+static purc_variant_t
+make_runner(void)
 {
-    bool ret = false;
-    purc_variant_t runner = PURC_VARIANT_INVALID;
-
-    // $SYS
-    purc_variant_t sys = purc_dvobj_system_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_SYS, sys)) {
-        goto out;
+    purc_variant_t runner = purc_dvobj_runner_new();
+    if (runner && !add_runner_myobj_listener(runner)) {
+        purc_variant_unref(runner);
+        return PURC_VARIANT_INVALID;
     }
-    purc_variant_unref(sys);
 
-    // $RUNNER
-    runner = purc_dvobj_runner_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_RUNNER, runner)) {
-        goto out;
-    }
+    return runner;
+}
 
+/* $SYS, $RUNNER, $L, $STR, $URL, $DATA, $STREAM, $DATETIME
+ * are all runner-level variables; they are created and bound on
+ * the first reference, so a runner only pays for the ones it uses. */
+static const struct builtin_runner_var {
+    const char         *name;
+    /* the other name bound to the same object */
+    const char         *alias;
+    purc_variant_t    (*create)(void);
+} builtin_runner_vars[] = {
+    { PURC_PREDEF_VARNAME_SYS,      NULL, purc_dvobj_system_new },
 #if ENABLE(CHINESE_NAMES) && defined(PURC_PREDEF_VARNAME_RUNNER_ZH)
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_RUNNER_ZH, runner)) {
-        goto out;
-    }
+    { PURC_PREDEF_VARNAME_RUNNER,   PURC_PREDEF_VARNAME_RUNNER_ZH,
+        make_runner },
+    { PURC_PREDEF_VARNAME_RUNNER_ZH, PURC_PREDEF_VARNAME_RUNNER,
+        make_runner },
+#else
+    { PURC_PREDEF_VARNAME_RUNNER,   NULL, make_runner },
 #endif
+    { PURC_PREDEF_VARNAME_L,        NULL, purc_dvobj_logical_new },
+    { PURC_PREDEF_VARNAME_STR,      NULL, purc_dvobj_string_new },
+    { PURC_PREDEF_VARNAME_URL,      NULL, purc_dvobj_url_new },
+    { PURC_PREDEF_VARNAME_DATA,     NULL, purc_dvobj_data_new },
+    { PURC_PREDEF_VARNAME_STREAM,   NULL, purc_dvobj_stream_new },
+    { PURC_PREDEF_VARNAME_DATETIME, NULL, purc_dvobj_datetime_new },
+};
 
-    /* $L, $STR, $URL, $DATA, $STREAM, $DATETIME
-     * are all runner-level variables */
-
-    // $L
-    purc_variant_t l = purc_dvobj_logical_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_L, l)) {
-        goto out;
-    }
-    purc_variant_unref(l);
-
-    // $STR
-    purc_variant_t str = purc_dvobj_string_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_STR, str)) {
-        goto out;
-    }
-    purc_variant_unref(str);
-
-    // $URL
-    purc_variant_t url = purc_dvobj_url_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_URL, url)) {
-        goto out;
-    }
-    purc_variant_unref(url);
+/* Make sure every built-in variable has a bit in pcintr_heap::builtin_vars */
+#define _COMPILE_TIME_ASSERT(name, x)               \
+       typedef int _dummy_ ## name[(x) * 2 - 1]
+_COMPILE_TIME_ASSERT(vars,
+        PCA_TABLESIZE(builtin_runner_vars) <= sizeof(unsigned int) * 8);
+#undef _COMPILE_TIME_ASSERT
 
-    // $DATA
-    purc_variant_t data = purc_dvobj_data_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_DATA, data)) {
-        goto out;
+static int
+find_builtin_runner_var(const char *name)
+{
+    for (size_t i = 0; i < PCA_TABLESIZE(builtin_runner_vars); i++) {
+        if (strcmp(builtin_runner_vars[i].name, name) == 0)
+            return (int)i;
     }
-    purc_variant_unref(data);
 
-    // $STREAM
-    purc_variant_t stream = purc_dvobj_stream_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_STREAM, stream)) {
-        goto out;
-    }
-    purc_variant_unref(stream);
+    return -1;
+}
 
-    // $DATETIME
-    purc_variant_t dt = purc_dvobj_datetime_new();
-    if (!purc_bind_runner_variable(PURC_PREDEF_VARNAME_DATETIME, dt)) {
-        goto out;
+purc_variant_t
+pcintr_make_builtin_runner_variable(const char *name)
+{
+    struct pcintr_heap *heap = pcintr_get_heap();
+    if (heap == NULL)
+        return PURC_VARIANT_INVALID;
+
+    int idx = find_builtin_runner_var(name);
+    /* created once only; it may have been removed by the program */
+    if (idx < 0 || (heap->builtin_vars & (1U << idx)))
+        return PURC_VARIANT_INVALID;
+
+    const struct builtin_runner_var *var = builtin_runner_vars + idx;
+    purc_variant_t v = var->create();
+    if (v == PURC_VARIANT_INVALID)
+        return PURC_VARIANT_INVALID;
+
+    pcvarmgr_t varmgr = pcinst_get_variables();
+    heap->builtin_vars |= (1U << idx);
+    if (!pcvarmgr_add_silently(varmgr, var->name, v))
+        goto failed;
+
+    if (var->alias) {
+        heap->builtin_vars |= (1U << find_builtin_runner_var(var->alias));
+        if (!pcvarmgr_add_silently(varmgr, var->alias, v))
+            goto failed;
     }
-    purc_variant_unref(dt);
 
-    ret = add_runner_myobj_listener(runner);
+    /* the runner variables manager holds the reference */
+    purc_variant_unref(v);
+    return v;
 
-out:
-    if (runner) {
-        purc_variant_unref(runner);
-    }
-    return ret;
+failed:
+    purc_variant_unref(v);
+    return PURC_VARIANT_INVALID;
 }
-
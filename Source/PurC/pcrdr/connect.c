@@ -151,13 +151,123 @@ int pcrdr_conn_set_poll_timeout(pcrdr_conn* conn, int timeout_ms)
 
 size_t pcrdr_conn_pending_requests_count(pcrdr_conn* conn)
 {
-    size_t n = 0;
+    return conn->nr_pending;
+}
+
+static inline uint64_t
+monotonic_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void
+record_round_trip(pcrdr_conn *conn, uint64_t rtt)
+{
+    unsigned bucket = 0;
+    uint64_t v = rtt;
+    while (v > 1 && bucket < PCRDR_NR_RTT_BUCKETS - 1) {
+        v >>= 1;
+        bucket++;
+    }
+
+    conn->rtt_buckets[bucket]++;
+    if (rtt > conn->max_rtt)
+        conn->max_rtt = rtt;
+}
+
+/* Returns the upper bound of the bucket in which the percentile falls. */
+static uint64_t
+round_trip_percentile(pcrdr_conn *conn, unsigned percent)
+{
+    uint64_t total = 0;
+    for (unsigned i = 0; i < PCRDR_NR_RTT_BUCKETS; i++)
+        total += conn->rtt_buckets[i];
+
+    if (total == 0)
+        return 0;
+
+    uint64_t rank = (total * percent + 99) / 100;
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < PCRDR_NR_RTT_BUCKETS; i++) {
+        seen += conn->rtt_buckets[i];
+        if (seen >= rank) {
+            uint64_t upper = (uint64_t)1 << (i + 1);
+            return upper < conn->max_rtt ? upper : conn->max_rtt;
+        }
+    }
+
+    return conn->max_rtt;
+}
+
+int pcrdr_conn_get_stats(pcrdr_conn* conn, struct pcrdr_conn_stats *stats)
+{
+    if (conn == NULL || stats == NULL) {
+        purc_set_error(PURC_ERROR_INVALID_VALUE);
+        return -1;
+    }
+
+    stats->nr_pending = conn->nr_pending;
+    stats->nr_requests = conn->nr_requests;
+    stats->nr_responses = conn->nr_responses;
+    stats->nr_timeouts = conn->nr_timeouts;
+    stats->rtt_p50 = round_trip_percentile(conn, 50);
+    stats->rtt_p90 = round_trip_percentile(conn, 90);
+    stats->rtt_p99 = round_trip_percentile(conn, 99);
+    stats->rtt_max = conn->max_rtt;
+    return 0;
+}
+
+static void
+release_pending_request(struct pending_request *pr)
+{
+    if (pr->conn) {
+        pcutils_timer_wheel_cancel(pr->conn->timeouts, &pr->timeout);
+        pr->conn->nr_pending--;
+    }
+    list_del(&pr->list);
+    purc_variant_unref(pr->request_id);
+    free(pr);
+}
+
+static void
+on_request_timeout(struct pcutils_timer *timer)
+{
     struct pending_request *pr;
-    list_for_each_entry(pr, &conn->pending_requests, list) {
-        n++;
+    pr = container_of(timer, struct pending_request, timeout);
+
+    pr->conn->nr_timeouts++;
+    if (pr->response_handler) {
+        pr->response_handler(pr->conn,
+            purc_variant_get_string_const(pr->request_id),
+                PCRDR_RESPONSE_TIMEOUT, pr->context, NULL);
     }
 
-    return n;
+    release_pending_request(pr);
+}
+
+static int
+arm_request_timeout(pcrdr_conn *conn, struct pending_request *pr,
+        int seconds_expected)
+{
+    if (conn->timeouts == NULL) {
+        conn->timeouts = pcutils_timer_wheel_new(pcutils_timer_wheel_now());
+        if (conn->timeouts == NULL)
+            return -1;
+    }
+
+    if (seconds_expected <= 0 || seconds_expected > 3600)
+        seconds_expected = 3600;
+
+    pr->conn = conn;
+    pr->sent_at = monotonic_time_us();
+    pcutils_timer_init(&pr->timeout, on_request_timeout);
+    pcutils_timer_wheel_arm(conn->timeouts, &pr->timeout,
+            pcutils_timer_wheel_now() + seconds_expected * 1000);
+    conn->nr_pending++;
+    conn->nr_requests++;
+    return 0;
 }
 
 int pcrdr_free_connection(pcrdr_conn* conn)
@@ -175,11 +285,11 @@ int pcrdr_free_connection(pcrdr_conn* conn)
                     purc_variant_get_string_const(pr->request_id),
                     PCRDR_RESPONSE_CANCELLED, pr->context, NULL);
         }
-        list_del(&pr->list);
-        purc_variant_unref(pr->request_id);
-        free(pr);
+        release_pending_request(pr);
     }
 
+    if (conn->timeouts)
+        pcutils_timer_wheel_destroy(conn->timeouts);
     free(conn);
 
     return 0;
@@ -236,18 +346,19 @@ pcrdr_set_handler_for_response_from_extra_source(pcrdr_conn* conn,
     }
 
     struct pending_request *pr;
-    if ((pr = malloc(sizeof(*pr))) == NULL) {
+    if ((pr = calloc(1, sizeof(*pr))) == NULL) {
         purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
         return -1;
     }
 
+    if (arm_request_timeout(conn, pr, seconds_expected)) {
+        free(pr);
+        return -1;
+    }
+
     pr->request_id = purc_variant_ref(request_id);
     pr->response_handler = response_handler;
     pr->context = context;
-    if (seconds_expected <= 0 || seconds_expected > 3600)
-        pr->time_expected = purc_get_monotoic_time() + 3600;
-    else
-        pr->time_expected = purc_get_monotoic_time() + seconds_expected;
     list_add_tail(&pr->list, &conn->pending_requests);
 
     return 0;
@@ -290,11 +401,23 @@ handle_response_message(pcrdr_conn* conn, const pcrdr_msg *msg)
     int retval = -1;
 
     if (!list_empty(&conn->pending_requests)) {
-        struct pending_request *pr;
-        pr = list_first_entry(&conn->pending_requests,
-                struct pending_request, list);
+        struct pending_request *pr, *found = NULL;
+
+        /* A synchronous request is put at the head while the asynchronous
+           ones sent before it may be still waiting for their responses,
+           so search the whole list; the first one matches mostly. */
+        list_for_each_entry(pr, &conn->pending_requests, list) {
+            if (variant_strcmp(msg->requestId, pr->request_id) == 0) {
+                found = pr;
+                break;
+            }
+        }
+
+        if (found) {
+            pr = found;
+            conn->nr_responses++;
+            record_round_trip(conn, monotonic_time_us() - pr->sent_at);
 
-        if (variant_strcmp(msg->requestId, pr->request_id) == 0) {
             const char *request_id =
                 purc_variant_get_string_const(msg->requestId);
             if (pr->response_handler && pr->response_handler(conn,
@@ -305,12 +428,10 @@ handle_response_message(pcrdr_conn* conn, const pcrdr_msg *msg)
             }
 
             retval = 0;
-            list_del(&pr->list);
-            purc_variant_unref(pr->request_id);
-            free(pr);
+            release_pending_request(pr);
         }
         else {
-            purc_log_error("response not matched the first pending request\n");
+            purc_log_error("response not matched any pending request\n");
             purc_set_error(PCRDR_ERROR_UNEXPECTED);
         }
     }
@@ -325,22 +446,9 @@ handle_response_message(pcrdr_conn* conn, const pcrdr_msg *msg)
 static int
 check_timeout_requests(pcrdr_conn *conn)
 {
-    struct pending_request *pr, *n;
-    time_t now = purc_get_monotoic_time();
-
-    list_for_each_entry_safe(pr, n, &conn->pending_requests, list) {
-        if (now >= pr->time_expected) {
-            if (pr->response_handler) {
-                pr->response_handler(conn,
-                    purc_variant_get_string_const(pr->request_id),
-                        PCRDR_RESPONSE_TIMEOUT, pr->context, NULL);
-            }
-
-            list_del(&pr->list);
-            purc_variant_unref(pr->request_id);
-            free(pr);
-        }
-    }
+    if (conn->timeouts)
+        pcutils_timer_wheel_advance(conn->timeouts,
+                pcutils_timer_wheel_now());
 
     return 0;
 }
@@ -507,13 +615,14 @@ pcrdr_wait_response_for_specific_request(pcrdr_conn* conn,
     struct pending_request *pr = calloc(1, sizeof(*pr));
     assert(pr);
 
+    if (arm_request_timeout(conn, pr, seconds_expected)) {
+        free(pr);
+        return -1;
+    }
+
     pr->request_id = purc_variant_ref(request_id);
     pr->response_handler = my_sync_response_handler;
     pr->context = response_msg;
-    if (seconds_expected <= 0 || seconds_expected > 3600)
-        pr->time_expected = purc_get_monotoic_time() + 3600;
-    else
-        pr->time_expected = purc_get_monotoic_time() + seconds_expected;
     list_add(&pr->list, &conn->pending_requests);
 
     while (*response_msg == NULL) {
@@ -564,9 +673,7 @@ pcrdr_wait_response_for_specific_request(pcrdr_conn* conn,
     }
 
     if (*response_msg == NULL) {
-        list_del(&pr->list);
-        purc_variant_unref(pr->request_id);
-        free(pr);
+        release_pending_request(pr);
     }
     else if (*response_msg == MSG_POINTER_INVALID) {
         *response_msg = NULL;   /* reset response messge to NULL */
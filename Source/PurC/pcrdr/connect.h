@@ -31,6 +31,7 @@
 
 #include "purc-pcrdr.h"
 #include "private/list.h"
+#include "private/timer-wheel.h"
 
 struct pending_request {
     struct list_head        list;
@@ -39,9 +40,17 @@ struct pending_request {
     pcrdr_response_handler  response_handler;
     void   *context;
 
-    time_t  time_expected;
+    /* armed in the timeout wheel of the connection */
+    struct pcutils_timer    timeout;
+    struct pcrdr_conn      *conn;
+
+    /* the monotonic time in microseconds when the request was sent */
+    uint64_t                sent_at;
 };
 
+/* The round trip times in the bucket N are in [2^N, 2^(N+1)) microseconds. */
+#define PCRDR_NR_RTT_BUCKETS    32
+
 struct pcrdr_prot_data;
 
 struct pcrdr_conn {
@@ -66,6 +75,16 @@ struct pcrdr_conn {
 
     /* the pending requests queue */
     struct list_head pending_requests;
+    /* the timeouts of the pending requests; created on demand */
+    struct pcutils_timer_wheel *timeouts;
+
+    /* the statistics of the traffic; see pcrdr_conn_get_stats() */
+    size_t   nr_pending;
+    uint64_t nr_requests;
+    uint64_t nr_responses;
+    uint64_t nr_timeouts;
+    uint64_t max_rtt;
+    uint64_t rtt_buckets[PCRDR_NR_RTT_BUCKETS];
 
     /* operations */
     int (*wait_message) (pcrdr_conn* conn, int timeout_ms);
@@ -51,12 +51,15 @@
 #define __STRING(x) #x
 
 #define RENDERER_FEATURES                           \
+    PCRDR_PURCMC_PROTOCOL_NAME ":"                  \
+    PCRDR_PURCMC_PROTOCOL_VERSION_STRING "\n"       \
     "HEADLESS:100\n"                                \
     "HTML:5.3/XGML:1.0/XML:1.0\n"                   \
     "workspace:" __STRING(8)                        \
     "/tabbedWindow:" __STRING(8)                    \
     "/widgetInTabbedWindow:" __STRING(32)           \
-    "/plainWindow:" __STRING(256)
+    "/plainWindow:" __STRING(256) "\n"              \
+    "DOMElementSelectors:handle,handles"
 
 struct tabbed_window_info {
     // handle of this tabbedWindow; NULL for not used slot.
@@ -1085,7 +1088,7 @@ static void on_write_begin(struct pcrdr_prot_data *prot_data,
     void **domdocs = NULL;
 
     UNUSED_PARAM(op_id);
-    if (find_domdoc_ptr(prot_data, msg, result) == NULL) {
+    if ((domdocs = find_domdoc_ptr(prot_data, msg, result)) == NULL) {
         return;
     }
 
@@ -1101,7 +1104,7 @@ static void on_write_more(struct pcrdr_prot_data *prot_data,
     void **domdocs = NULL;
 
     UNUSED_PARAM(op_id);
-    if (find_domdoc_ptr(prot_data, msg, result) == NULL) {
+    if ((domdocs = find_domdoc_ptr(prot_data, msg, result)) == NULL) {
         return;
     }
 
@@ -1123,7 +1126,7 @@ static void on_write_end(struct pcrdr_prot_data *prot_data,
     void **domdocs = NULL;
 
     UNUSED_PARAM(op_id);
-    if (find_domdoc_ptr(prot_data, msg, result) == NULL) {
+    if ((domdocs = find_domdoc_ptr(prot_data, msg, result)) == NULL) {
         return;
     }
 
@@ -1193,6 +1196,32 @@ found:
         return;
     }
 
+    if (msg->elementType == PCRDR_MSG_ELEMENT_TYPE_HANDLES) {
+        /* like a real renderer, report the index of the first element
+           in the list failed */
+        const char *value = purc_variant_get_string_const(msg->elementValue);
+        uint64_t idx = 0;
+        while (value) {
+            char *end;
+            uint64_t handle = strtoull(value, &end, 16);
+            if (end == value || handle == 0 || (*end && *end != ',') ||
+                    idx == PCRDR_MAX_HANDLES) {
+                result->retCode = PCRDR_SC_BAD_REQUEST;
+                result->resultValue = idx;
+                return;
+            }
+
+            idx++;
+            value = *end ? end + 1 : NULL;
+        }
+
+        if (idx == 0) {
+            result->retCode = PCRDR_SC_BAD_REQUEST;
+            result->resultValue = 0;
+            return;
+        }
+    }
+
     result->retCode = PCRDR_SC_OK;
     result->resultValue = msg->targetValue;
 }
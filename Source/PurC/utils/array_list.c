@@ -261,3 +261,27 @@ pcutils_array_list_sort(struct pcutils_array_list *al,
     }
 }
 
+
+int
+pcutils_array_list_permute(struct pcutils_array_list *al,
+        const size_t *order)
+{
+    size_t nr = al->nr;
+    if (nr < 2)
+        return 0;
+
+    struct pcutils_array_list_node **nodes;
+    nodes = (struct pcutils_array_list_node**)malloc(nr * sizeof(*nodes));
+    if (!nodes)
+        return -1;
+
+    for (size_t i = 0; i < nr; ++i) {
+        PC_ASSERT(order[i] < nr);
+        nodes[i] = al->nodes[order[i]];
+        nodes[i]->idx = i;
+    }
+
+    memcpy(al->nodes, nodes, nr * sizeof(*nodes));
+    free(nodes);
+    return 0;
+}
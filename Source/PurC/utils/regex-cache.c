@@ -0,0 +1,320 @@
+/*
+ * @file regex-cache.c
+ * @brief The LRU cache of compiled regular expressions.
+ *
+ * Copyright (C) 2026 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "purc-utils.h"
+#include "purc-errors.h"
+#include "private/errors.h"
+#include "private/instance.h"
+#include "private/hashtable.h"
+#include "private/list.h"
+#include "private/regex.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+struct pcregex_cached {
+    /* the key */
+    enum pcregex_cache_kind     kind;
+    int                         cflags;
+    int                         mflags;
+    char                       *pattern;
+    unsigned long               hash;
+
+    /* one reference is held by the cache if the entry is cached */
+    unsigned int                refc;
+    unsigned int                in_cache:1;
+
+    /* the node in the LRU list; the most recently used one comes first */
+    struct list_head            ln;
+
+    union {
+        regex_t                 posix;
+        struct pcregex         *pcre;
+    };
+};
+
+struct pcregex_cache {
+    struct pchash_table        *table;
+    struct list_head            lru;
+    size_t                      capacity;
+
+    struct purc_regex_cache_stat stat;
+};
+
+static unsigned long
+cached_hash(const void *k)
+{
+    const struct pcregex_cached *key = k;
+    return key->hash;
+}
+
+static int
+cached_equal(const void *k1, const void *k2)
+{
+    const struct pcregex_cached *a = k1;
+    const struct pcregex_cached *b = k2;
+
+    return a->hash == b->hash && a->kind == b->kind &&
+        a->cflags == b->cflags && a->mflags == b->mflags &&
+        strcmp(a->pattern, b->pattern) == 0;
+}
+
+static unsigned long
+make_hash(enum pcregex_cache_kind kind, int cflags, int mflags,
+        const char *pattern)
+{
+    unsigned long h = pchash_perllike_str_hash(pattern);
+
+    h = h * 33 + (unsigned long)kind;
+    h = h * 33 + (unsigned long)(unsigned int)cflags;
+    h = h * 33 + (unsigned long)(unsigned int)mflags;
+    return h;
+}
+
+static void
+cached_free(struct pcregex_cached *cached)
+{
+    switch (cached->kind) {
+    case PCREGEX_CACHE_POSIX:
+        regfree(&cached->posix);
+        break;
+    case PCREGEX_CACHE_PCRE:
+        pcregex_destroy(cached->pcre);
+        break;
+    }
+
+    free(cached->pattern);
+    free(cached);
+}
+
+void pcregex_cached_release(struct pcregex_cached *cached)
+{
+    if (cached == NULL)
+        return;
+
+    assert(cached->refc > 0);
+    if (--cached->refc == 0)
+        cached_free(cached);
+}
+
+const regex_t *pcregex_cached_posix(const struct pcregex_cached *cached)
+{
+    assert(cached->kind == PCREGEX_CACHE_POSIX);
+    return &cached->posix;
+}
+
+struct pcregex *pcregex_cached_regex(const struct pcregex_cached *cached)
+{
+    assert(cached->kind == PCREGEX_CACHE_PCRE);
+    return cached->pcre;
+}
+
+struct pcregex_cache *pcregex_cache_new(size_t capacity)
+{
+    struct pcregex_cache *cache = calloc(1, sizeof(*cache));
+    if (cache == NULL)
+        goto failed;
+
+    cache->table = pchash_table_new(HASHTABLE_DEFAULT_SIZE, NULL,
+            cached_hash, cached_equal);
+    if (cache->table == NULL)
+        goto failed;
+
+    list_head_init(&cache->lru);
+    cache->capacity = capacity ? capacity : PCREGEX_CACHE_CAPACITY;
+    return cache;
+
+failed:
+    if (cache)
+        free(cache);
+    purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    return NULL;
+}
+
+static void
+evict(struct pcregex_cache *cache, struct pcregex_cached *cached)
+{
+    pchash_table_delete(cache->table, cached);
+    list_del(&cached->ln);
+    cached->in_cache = 0;
+    cache->stat.nr_entries--;
+    pcregex_cached_release(cached);
+}
+
+void pcregex_cache_destroy(struct pcregex_cache *cache)
+{
+    struct pcregex_cached *p, *n;
+
+    list_for_each_entry_safe(p, n, &cache->lru, ln) {
+        evict(cache, p);
+    }
+
+    pchash_table_free(cache->table);
+    free(cache);
+}
+
+static struct pcregex_cache *
+current_cache(void)
+{
+    struct pcinst *inst = pcinst_current();
+    if (inst == NULL)
+        return NULL;
+
+    if (inst->regex_cache == NULL)
+        inst->regex_cache = pcregex_cache_new(PCREGEX_CACHE_CAPACITY);
+
+    return inst->regex_cache;
+}
+
+static struct pcregex_cached *
+cached_new(enum pcregex_cache_kind kind, int cflags, int mflags,
+        const char *pattern, unsigned long hash)
+{
+    struct pcregex_cached *cached = calloc(1, sizeof(*cached));
+    if (cached == NULL)
+        goto failed;
+
+    cached->pattern = strdup(pattern);
+    if (cached->pattern == NULL)
+        goto failed;
+
+    switch (kind) {
+    case PCREGEX_CACHE_POSIX:
+        if (regcomp(&cached->posix, pattern, cflags)) {
+            free(cached->pattern);
+            free(cached);
+            return NULL;
+        }
+        break;
+
+    case PCREGEX_CACHE_PCRE:
+        cached->pcre = pcregex_new_ex(pattern, cflags, mflags);
+        if (cached->pcre == NULL) {
+            free(cached->pattern);
+            free(cached);
+            return NULL;
+        }
+        break;
+    }
+
+    cached->kind = kind;
+    cached->cflags = cflags;
+    cached->mflags = mflags;
+    cached->hash = hash;
+    cached->refc = 1;
+    list_head_init(&cached->ln);
+    return cached;
+
+failed:
+    if (cached)
+        free(cached);
+    purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    return NULL;
+}
+
+static struct pcregex_cached *
+cache_get(enum pcregex_cache_kind kind, int cflags, int mflags,
+        const char *pattern)
+{
+    struct pcregex_cache *cache = current_cache();
+    unsigned long hash = make_hash(kind, cflags, mflags, pattern);
+
+    if (cache == NULL) {
+        /* no instance: hand out a private one which is freed on release */
+        return cached_new(kind, cflags, mflags, pattern, hash);
+    }
+
+    struct pcregex_cached key;
+    key.kind = kind;
+    key.cflags = cflags;
+    key.mflags = mflags;
+    key.pattern = (char *)pattern;
+    key.hash = hash;
+
+    struct pchash_entry *e;
+    e = pchash_table_lookup_entry_w_hash(cache->table, &key, hash);
+    if (e) {
+        struct pcregex_cached *cached = (struct pcregex_cached *)e->v;
+        list_move(&cached->ln, &cache->lru);
+        cache->stat.nr_hits++;
+        cached->refc++;
+        return cached;
+    }
+
+    cache->stat.nr_misses++;
+    struct pcregex_cached *cached;
+    cached = cached_new(kind, cflags, mflags, pattern, hash);
+    if (cached == NULL)
+        return NULL;
+
+    if (pchash_table_insert_w_hash(cache->table, cached, cached, hash,
+                PCHASH_OBJECT_KEY_IS_CONSTANT)) {
+        /* still usable, only not cached */
+        return cached;
+    }
+
+    list_add(&cached->ln, &cache->lru);
+    cached->in_cache = 1;
+    cached->refc++;
+    cache->stat.nr_entries++;
+
+    while (cache->stat.nr_entries > cache->capacity) {
+        struct pcregex_cached *last;
+        last = list_last_entry(&cache->lru, struct pcregex_cached, ln);
+        evict(cache, last);
+        cache->stat.nr_evictions++;
+    }
+
+    return cached;
+}
+
+struct pcregex_cached *pcregex_cache_get_posix(const char *pattern,
+        int cflags)
+{
+    if (pattern == NULL)
+        return NULL;
+
+    return cache_get(PCREGEX_CACHE_POSIX, cflags, 0, pattern);
+}
+
+struct pcregex_cached *pcregex_cache_get(const char *pattern,
+        enum pcregex_compile_flags compile_options,
+        enum pcregex_match_flags match_options)
+{
+    if (pattern == NULL)
+        return NULL;
+
+    return cache_get(PCREGEX_CACHE_PCRE, compile_options | PCREGEX_OPTIMIZE,
+            match_options, pattern);
+}
+
+const struct purc_regex_cache_stat *purc_regex_cache_stat(void)
+{
+    struct pcregex_cache *cache = current_cache();
+    if (cache == NULL)
+        return NULL;
+
+    return &cache->stat;
+}
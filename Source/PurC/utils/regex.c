@@ -240,9 +240,17 @@ bool pcregex_is_match_ex(const char *pattern, const char *str,
     if (!pattern || !str) {
         return false;
     }
-    return g_regex_match_simple(pattern, str,
-            to_g_regex_compile_flags(compile_options),
-            to_g_regex_match_flags(match_options));
+
+    struct pcregex_cached *cached = pcregex_cache_get(pattern,
+            compile_options, 0);
+    if (cached == NULL) {
+        return false;
+    }
+
+    bool ret = g_regex_match(pcregex_cached_regex(cached)->g_regex, str,
+            to_g_regex_match_flags(match_options), NULL);
+    pcregex_cached_release(cached);
+    return ret;
 }
 
 bool pcregex_is_match(const char *pattern, const char *str)
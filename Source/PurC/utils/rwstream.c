@@ -38,6 +38,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <fcntl.h>
+
+#if OS(LINUX) || OS(UNIX) || OS(DARWIN)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #endif // 0S(UNIX)
 
 #include "rwstream_err_msgs.inc"
@@ -125,6 +130,12 @@ struct fd_rwstream
     purc_rwstream rwstream;
     int fd;
 };
+
+struct mmap_rwstream
+{
+    struct mem_rwstream mem;
+    size_t sz_mapped;
+};
 #endif // OS(LINUX) || OS(UNIX) || OS(DARWIN)
 
 static off_t stdio_seek (purc_rwstream_t rws, off_t offset, int whence);
@@ -200,6 +211,19 @@ static rwstream_funcs fd_funcs = {
     fd_destroy,
     NULL,
 };
+
+static int mmap_destroy (purc_rwstream_t rws);
+
+/* the memory functions work on the mapping except for writing */
+static rwstream_funcs mmap_funcs = {
+    mem_seek,
+    mem_tell,
+    mem_read,
+    NULL,           // write
+    NULL,           // flush
+    mmap_destroy,
+    mem_get_mem_buffer
+};
 #endif // OS(LINUX) || OS(UNIX) || OS(DARWIN)
 
 static size_t get_min_size(size_t sz_min, size_t sz_max) {
@@ -255,6 +279,56 @@ purc_rwstream_t purc_rwstream_new_from_mem (void* mem, size_t sz)
     return (purc_rwstream_t)rws;
 }
 
+purc_rwstream_t purc_rwstream_new_from_mmap (int fd, size_t sz)
+{
+#if OS(LINUX) || OS(UNIX) || OS(DARWIN)
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) == -1) {
+        pcinst_set_error(fd < 0 ? PURC_ERROR_INVALID_VALUE :
+                purc_error_from_errno(errno));
+        return NULL;
+    }
+
+    if ((uint64_t)st.st_size < sz) {
+        pcinst_set_error(PURC_ERROR_INVALID_VALUE);
+        return NULL;
+    }
+
+    /* map the terminating byte too if there is one */
+    size_t sz_mapped = ((uint64_t)st.st_size > sz) ? sz + 1 : sz;
+    static uint8_t empty[1];
+    void *base = empty;
+    if (sz_mapped > 0) {
+        base = mmap(NULL, sz_mapped, PROT_READ, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) {
+            pcinst_set_error(purc_error_from_errno(errno));
+            return NULL;
+        }
+    }
+
+    struct mmap_rwstream* rws = (struct mmap_rwstream*) calloc(
+            1, sizeof(struct mmap_rwstream));
+    if (rws == NULL) {
+        if (sz_mapped > 0)
+            munmap(base, sz_mapped);
+        pcinst_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    rws->mem.rwstream.funcs = &mmap_funcs;
+    rws->mem.base = base;
+    rws->mem.here = rws->mem.base;
+    rws->mem.stop = rws->mem.base + sz;
+    rws->sz_mapped = sz_mapped;
+    return (purc_rwstream_t)rws;
+#else
+    UNUSED_PARAM(fd);
+    UNUSED_PARAM(sz);
+    pcinst_set_error(PURC_ERROR_NOT_IMPLEMENTED);
+    return NULL;
+#endif
+}
+
 purc_rwstream_t purc_rwstream_new_from_file (const char* file, const char* mode)
 {
     FILE* fp = fopen(file, mode);
@@ -794,7 +868,7 @@ static void* mem_get_mem_buffer (purc_rwstream_t rws,
     }
 
     if (sz_buffer) {
-        *sz_content = mem->stop - mem->base;
+        *sz_buffer = mem->stop - mem->base;
     }
 
     UNUSED_PARAM(res_buff);
@@ -996,4 +1070,14 @@ static int fd_destroy (purc_rwstream_t rws)
     return 0;
 }
 
+/* mmap rwstream functions */
+static int mmap_destroy (purc_rwstream_t rws)
+{
+    struct mmap_rwstream* mmap_rws = (struct mmap_rwstream *)rws;
+    if (mmap_rws->sz_mapped > 0)
+        munmap(mmap_rws->mem.base, mmap_rws->sz_mapped);
+    free(rws);
+    return 0;
+}
+
 #endif // OS(LINUX) || OS(UNIX) || OS(DARWIN)
@@ -0,0 +1,240 @@
+/*
+ * @file timer-wheel.c
+ * @brief The implementation of the hierarchical timer wheel.
+ *
+ * Copyright (C) 2026 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "purc-errors.h"
+#include "private/errors.h"
+#include "private/timer-wheel.h"
+
+#include <stdlib.h>
+#include <assert.h>
+
+#define WHEEL_BITS      PCUTILS_TIMER_WHEEL_BITS
+#define WHEEL_SLOTS     PCUTILS_TIMER_WHEEL_SLOTS
+#define WHEEL_MASK      (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS    PCUTILS_TIMER_WHEEL_LEVELS
+
+/* the range covered by the wheel in ticks */
+#define WHEEL_RANGE     (1ULL << (WHEEL_BITS * WHEEL_LEVELS))
+
+struct pcutils_timer_wheel {
+    /* the next tick to process; all ticks before it have been processed */
+    uint64_t            now;
+    size_t              nr_armed;
+
+    struct list_head    slots[WHEEL_LEVELS][WHEEL_SLOTS];
+};
+
+static inline unsigned
+slot_index(uint64_t ticks, int level)
+{
+    return (unsigned)(ticks >> (level * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+static void
+add_timer(struct pcutils_timer_wheel *wheel, struct pcutils_timer *timer)
+{
+    uint64_t expires = timer->expires;
+    if (expires < wheel->now)
+        expires = wheel->now;
+
+    uint64_t delta = expires - wheel->now;
+    if (delta >= WHEEL_RANGE) {
+        /* park it in the farthest slot; re-hashed when cascaded */
+        delta = WHEEL_RANGE - 1;
+        expires = wheel->now + delta;
+    }
+
+    int level = 0;
+    while (delta >= (1ULL << ((level + 1) * WHEEL_BITS)))
+        level++;
+
+    list_add_tail(&timer->ln,
+            &wheel->slots[level][slot_index(expires, level)]);
+    wheel->nr_armed++;
+}
+
+struct pcutils_timer_wheel *
+pcutils_timer_wheel_new(uint64_t now)
+{
+    struct pcutils_timer_wheel *wheel = malloc(sizeof(*wheel));
+    if (wheel == NULL) {
+        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    wheel->now = now;
+    wheel->nr_armed = 0;
+    for (int l = 0; l < WHEEL_LEVELS; l++) {
+        for (int i = 0; i < WHEEL_SLOTS; i++)
+            list_head_init(&wheel->slots[l][i]);
+    }
+
+    return wheel;
+}
+
+void
+pcutils_timer_wheel_destroy(struct pcutils_timer_wheel *wheel)
+{
+    for (int l = 0; l < WHEEL_LEVELS; l++) {
+        for (int i = 0; i < WHEEL_SLOTS; i++) {
+            struct list_head *slot = &wheel->slots[l][i];
+            while (!list_empty(slot))
+                list_del_init(slot->next);
+        }
+    }
+
+    free(wheel);
+}
+
+void
+pcutils_timer_wheel_arm(struct pcutils_timer_wheel *wheel,
+        struct pcutils_timer *timer, uint64_t expires)
+{
+    pcutils_timer_wheel_cancel(wheel, timer);
+
+    timer->expires = expires;
+    add_timer(wheel, timer);
+}
+
+void
+pcutils_timer_wheel_cancel(struct pcutils_timer_wheel *wheel,
+        struct pcutils_timer *timer)
+{
+    if (pcutils_timer_is_armed(timer)) {
+        list_del_init(&timer->ln);
+        assert(wheel->nr_armed > 0);
+        wheel->nr_armed--;
+    }
+}
+
+/* re-hashes the timers in the current slot of the level to lower levels */
+static unsigned
+cascade(struct pcutils_timer_wheel *wheel, int level)
+{
+    unsigned idx = slot_index(wheel->now, level);
+    LIST_HEAD(list);
+
+    list_splice_init(&wheel->slots[level][idx], &list);
+    while (!list_empty(&list)) {
+        struct pcutils_timer *timer;
+        timer = list_first_entry(&list, struct pcutils_timer, ln);
+        list_del_init(&timer->ln);
+        wheel->nr_armed--;
+        add_timer(wheel, timer);
+    }
+
+    return idx;
+}
+
+size_t
+pcutils_timer_wheel_advance(struct pcutils_timer_wheel *wheel, uint64_t now)
+{
+    size_t nr_fired = 0;
+
+    while (wheel->now <= now) {
+        if (wheel->nr_armed == 0) {
+            /* nothing to cascade nor to fire: jump to the end */
+            wheel->now = now + 1;
+            break;
+        }
+
+        unsigned idx = slot_index(wheel->now, 0);
+        if (idx == 0) {
+            for (int l = 1; l < WHEEL_LEVELS; l++) {
+                if (cascade(wheel, l) != 0)
+                    break;
+            }
+        }
+
+        LIST_HEAD(expired);
+        list_splice_init(&wheel->slots[0][idx], &expired);
+
+        /* the timers armed by the callbacks go to the following ticks */
+        wheel->now++;
+
+        while (!list_empty(&expired)) {
+            struct pcutils_timer *timer;
+            timer = list_first_entry(&expired, struct pcutils_timer, ln);
+            list_del_init(&timer->ln);
+            wheel->nr_armed--;
+
+            timer->fire(timer);
+            nr_fired++;
+        }
+    }
+
+    return nr_fired;
+}
+
+uint64_t
+pcutils_timer_wheel_next_expiry(struct pcutils_timer_wheel *wheel)
+{
+    uint64_t next = PCUTILS_TIMER_NEVER;
+
+    if (wheel->nr_armed == 0)
+        return next;
+
+    for (int l = 0; l < WHEEL_LEVELS; l++) {
+        uint64_t pos = wheel->now >> (l * WHEEL_BITS);
+
+        for (unsigned k = 0; k < WHEEL_SLOTS; k++) {
+            if (list_empty(&wheel->slots[l][(pos + k) & WHEEL_MASK]))
+                continue;
+
+            uint64_t bound;
+            if (l == 0) {
+                bound = wheel->now + k;
+            }
+            else if (k > 0) {
+                bound = (pos + k) << (l * WHEEL_BITS);
+            }
+            else if ((wheel->now & ((1ULL << (l * WHEEL_BITS)) - 1)) == 0) {
+                /* the current slot is to be cascaded on the next tick */
+                bound = wheel->now;
+            }
+            else {
+                /* the current slot has been cascaded; it only holds
+                   the timers wrapped to the next round, which expire
+                   later than those in the other slots of this level */
+                bound = (pos + WHEEL_SLOTS) << (l * WHEEL_BITS);
+                if (bound < next)
+                    next = bound;
+                continue;
+            }
+
+            if (bound < next)
+                next = bound;
+            break;
+        }
+    }
+
+    return next;
+}
+
+size_t
+pcutils_timer_wheel_count(struct pcutils_timer_wheel *wheel)
+{
+    return wheel->nr_armed;
+}
+
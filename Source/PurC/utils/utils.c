@@ -490,6 +490,67 @@ pcutils_get_next_token_len(const char *data, size_t str_len,
     return head;
 }
 
+const char *
+pcutils_memmem(const char *haystack, size_t len_haystack,
+        const char *needle, size_t len_needle)
+{
+    if (len_needle == 0 || len_needle > len_haystack)
+        return NULL;
+
+    const unsigned char *h = (const unsigned char *)haystack;
+    const unsigned char *n = (const unsigned char *)needle;
+    const unsigned char *last = h + len_haystack - len_needle;
+
+    /* short needles: let memchr() scan for the first byte */
+    if (len_needle <= 2) {
+        while (h <= last) {
+            h = memchr(h, n[0], last - h + 1);
+            if (h == NULL)
+                break;
+            if (len_needle == 1 || h[1] == n[1])
+                return (const char *)h;
+            h++;
+        }
+        return NULL;
+    }
+
+    /* Horspool: skip by the distance of the byte under the window end;
+       the distances are capped to keep the table small to set up. */
+    uint8_t skip[256];
+    size_t max_skip = len_needle > UINT8_MAX ? UINT8_MAX : len_needle;
+    memset(skip, (int)max_skip, sizeof(skip));
+    for (size_t i = len_needle - max_skip; i < len_needle - 1; i++)
+        skip[n[i]] = (uint8_t)(len_needle - 1 - i);
+
+    unsigned char tail = n[len_needle - 1];
+    while (h <= last) {
+        unsigned char c = h[len_needle - 1];
+        if (c == tail && h[0] == n[0] &&
+                memcmp(h + 1, n + 1, len_needle - 2) == 0)
+            return (const char *)h;
+        h += skip[c];
+    }
+
+    return NULL;
+}
+
+size_t
+pcutils_memmem_count(const char *haystack, size_t len_haystack,
+        const char *needle, size_t len_needle)
+{
+    size_t nr = 0;
+    const char *end = haystack + len_haystack;
+    const char *p;
+
+    while ((p = pcutils_memmem(haystack, end - haystack,
+                    needle, len_needle))) {
+        nr++;
+        haystack = p + len_needle;
+    }
+
+    return nr;
+}
+
 const char *
 pcutils_get_prev_token(const char *data, size_t str_len,
         const char *delims, size_t *length)
@@ -193,6 +193,10 @@ pcvariant_object_clear(purc_variant_t object, bool silently)
         goto end;
     }
 
+    if (pcvariant_container_unshare(object)) {
+        goto end;
+    }
+
     purc_variant_t key;
     purc_variant_t value;
     UNUSED_VARIABLE(value);
@@ -221,6 +225,11 @@ pcvariant_array_clear(purc_variant_t array, bool silently)
         goto end;
     }
 
+    // the removal below must not switch the data in the middle
+    if (pcvariant_container_unshare(array)) {
+        goto end;
+    }
+
     purc_variant_t val;
     size_t curr;
     UNUSED_VARIABLE(val);
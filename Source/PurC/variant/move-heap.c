@@ -73,18 +73,15 @@ static int mvheap_init_once(void)
     move_heap.v_undefined.type = PURC_VARIANT_TYPE_UNDEFINED;
     move_heap.v_undefined.refc = 0;
     move_heap.v_undefined.flags = PCVARIANT_FLAG_NOFREE;
-    INIT_LIST_HEAD(&move_heap.v_undefined.listeners);
 
     move_heap.v_null.type = PURC_VARIANT_TYPE_NULL;
     move_heap.v_null.refc = 0;
     move_heap.v_null.flags = PCVARIANT_FLAG_NOFREE;
-    INIT_LIST_HEAD(&move_heap.v_null.listeners);
 
     move_heap.v_false.type = PURC_VARIANT_TYPE_BOOLEAN;
     move_heap.v_false.refc = 0;
     move_heap.v_false.flags = PCVARIANT_FLAG_NOFREE;
     move_heap.v_false.b = false;
-    INIT_LIST_HEAD(&move_heap.v_false.listeners);
 
     move_heap.v_true.type = PURC_VARIANT_TYPE_BOOLEAN;
     move_heap.v_true.refc = 0;
@@ -438,6 +435,11 @@ static bool
 move_or_clone_mutable_descendants_in_array(struct travel_context *ctxt,
         purc_variant_t arr)
 {
+    /* the nodes are changed in place, and the data must not be shared
+       with any container staying in the instance */
+    if (pcvariant_container_unshare(arr))
+        return false;
+
     size_t idx;
     purc_variant_t v;
     foreach_value_in_variant_array(arr, v, idx) {
@@ -493,6 +495,9 @@ static bool
 move_or_clone_mutable_descendants_in_object(struct travel_context *ctxt,
         purc_variant_t obj)
 {
+    if (pcvariant_container_unshare(obj))
+        return false;
+
     purc_variant_t k,v;
     foreach_key_value_in_variant_object(obj, k, v) {
         purc_variant_t retk, retv;
@@ -708,6 +713,9 @@ static bool
 move_or_clone_immutable_descendants_in_array(struct travel_context *ctxt,
         purc_variant_t arr)
 {
+    if (pcvariant_container_unshare(arr))
+        return false;
+
     size_t idx;
     purc_variant_t v;
     foreach_value_in_variant_array(arr, v, idx) {
@@ -759,6 +767,9 @@ static bool
 move_or_clone_immutable_descendants_in_object(struct travel_context *ctxt,
         purc_variant_t obj)
 {
+    if (pcvariant_container_unshare(obj))
+        return false;
+
     purc_variant_t k,v;
     foreach_key_value_in_variant_object(obj, k, v) {
         purc_variant_t retk, retv;
@@ -25,20 +25,105 @@
 #include "purc-errors.h"
 #include "private/debug.h"
 #include "private/errors.h"
+#include "private/instance.h"
+#include "private/hashtable.h"
 #include "variant-internals.h"
 
 #include <stdlib.h>
 
+/*
+ * Only a few containers have listeners, so the list heads of the listeners
+ * are not kept in the variant cells but in a map of the variant heap,
+ * and the flag PCVARIANT_FLAG_LISTENERS tells whether to look up the map.
+ */
+#define LISTENERS_MAP_SIZE      16
+
+static inline struct pcvariant_heap *
+listeners_heap(void)
+{
+    struct pcinst *inst = pcinst_current();
+    return inst ? inst->org_vrt_heap : NULL;
+}
+
+static struct list_head *
+find_listeners(purc_variant_t v)
+{
+    if (!(v->flags & PCVARIANT_FLAG_LISTENERS))
+        return NULL;
+
+    struct pcvariant_heap *heap = listeners_heap();
+    void *data;
+    if (heap && heap->listeners_map &&
+            pchash_table_lookup_ex(heap->listeners_map, v, &data))
+        return data;
+
+    return NULL;
+}
+
+static void
+free_listeners_entry(struct pchash_entry *e)
+{
+    free(pchash_entry_v(e));
+}
+
+static struct list_head *
+get_listeners(purc_variant_t v)
+{
+    struct list_head *listeners = find_listeners(v);
+    if (listeners)
+        return listeners;
+
+    struct pcvariant_heap *heap = listeners_heap();
+    if (heap == NULL)
+        goto failed;
+
+    if (heap->listeners_map == NULL) {
+        heap->listeners_map = pchash_kptr_table_new(LISTENERS_MAP_SIZE,
+                free_listeners_entry);
+        if (heap->listeners_map == NULL)
+            goto failed;
+    }
+
+    listeners = malloc(sizeof(*listeners));
+    if (listeners == NULL)
+        goto failed;
+
+    INIT_LIST_HEAD(listeners);
+    if (pchash_table_insert(heap->listeners_map, v, listeners)) {
+        free(listeners);
+        goto failed;
+    }
+
+    v->flags |= PCVARIANT_FLAG_LISTENERS;
+    return listeners;
+
+failed:
+    pcinst_set_error(PCVARIANT_ERROR_OUT_OF_MEMORY);
+    return NULL;
+}
+
+static void
+put_listeners(purc_variant_t v, struct list_head *listeners)
+{
+    if (list_empty(listeners)) {
+        pchash_table_delete(listeners_heap()->listeners_map, v);
+        v->flags &= ~PCVARIANT_FLAG_LISTENERS;
+    }
+}
+
 static pcvar_listener*
 register_listener(purc_variant_t v, unsigned int flags,
         pcvar_op_t op, pcvar_op_handler handler, void *ctxt)
 {
     struct list_head *listeners;
-    listeners = &v->listeners;
+    listeners = get_listeners(v);
+    if (!listeners)
+        return NULL;
 
     struct pcvar_listener *listener;
     listener = (struct pcvar_listener*)calloc(1, sizeof(*listener));
     if (!listener) {
+        put_listeners(v, listeners);
         pcinst_set_error(PCVARIANT_ERROR_OUT_OF_MEMORY);
         return NULL;
     }
@@ -116,7 +201,9 @@ purc_variant_revoke_listener(purc_variant_t v,
     }
 
     struct list_head *listeners;
-    listeners = &v->listeners;
+    listeners = find_listeners(v);
+    if (!listeners)
+        return false;
 
     struct list_head *p, *n;
     list_for_each_safe(p, n, listeners) {
@@ -127,6 +214,7 @@ purc_variant_revoke_listener(purc_variant_t v,
 
         list_del(p);
         free(curr);
+        put_listeners(v, listeners);
         return true;
     }
 
@@ -144,7 +232,9 @@ bool pcvariant_on_pre_fired(
     PC_ASSERT(op != PCVAR_OPERATION_ALL);
 
     struct list_head *listeners;
-    listeners = &source->listeners;
+    listeners = find_listeners(source);
+    if (!listeners)
+        return true;
 
     struct list_head *p, *n;
     list_for_each_safe(p, n, listeners) {
@@ -175,7 +265,9 @@ void pcvariant_on_post_fired(
     PC_ASSERT(op != PCVAR_OPERATION_ALL);
 
     struct list_head *listeners;
-    listeners = &source->listeners;
+    listeners = find_listeners(source);
+    if (!listeners)
+        return;
 
     struct pcvar_listener *p, *n;
     list_for_each_entry_reverse_safe(p, n, listeners, list_node) {
@@ -204,6 +204,81 @@ arr_node_create(purc_variant_t val)
     return node;
 }
 
+static void
+refresh_extra(purc_variant_t arr)
+{
+    size_t extra = 0;
+    variant_arr_t data = pcvar_arr_get_data(arr);
+    if (data) {
+        extra += sizeof(*data);
+        struct pcutils_array_list *al = &data->al;
+        extra += al->sz * sizeof(*al->nodes);
+        extra += al->nr * sizeof(struct arr_node);
+    }
+    pcvariant_stat_set_extra_size(arr, extra);
+}
+
+static void
+free_private_nodes(struct pcutils_array_list *al)
+{
+    struct arr_node *p, *n;
+    array_list_for_each_entry_reverse_safe(al, p, n, node) {
+        struct pcutils_array_list_node *r;
+        pcutils_array_list_remove(al, p->node.idx, &r);
+        purc_variant_unref(p->val);
+        free(p);
+    }
+
+    pcutils_array_list_reset(al);
+}
+
+int
+pcvar_arr_unshare(purc_variant_t arr)
+{
+    variant_arr_t data = pcvar_arr_get_data(arr);
+    if (!data || data->nr_sharing == 0)
+        return 0;
+
+    variant_arr_t copy = (variant_arr_t)calloc(1, sizeof(*copy));
+    if (!copy) {
+        pcinst_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return -1;
+    }
+
+    struct pcutils_array_list *al = &copy->al;
+    pcutils_array_list_init(al);
+
+    size_t nr = pcutils_array_list_length(&data->al);
+    if (pcutils_array_list_expand(al,
+                nr > ARRAY_LIST_DEFAULT_SIZE ? nr : ARRAY_LIST_DEFAULT_SIZE))
+        goto failed;
+
+    struct arr_node *p;
+    array_list_for_each_entry(&data->al, p, node) {
+        struct arr_node *node = arr_node_create(p->val);
+        if (!node)
+            goto failed;
+
+        if (pcutils_array_list_append(al, &node->node)) {
+            purc_variant_unref(node->val);
+            free(node);
+            goto failed;
+        }
+    }
+
+    // the other sharers keep the original data
+    data->nr_sharing--;
+    arr->sz_ptr[1] = (uintptr_t)copy;
+    refresh_extra(arr);
+    return 0;
+
+failed:
+    free_private_nodes(al);
+    free(copy);
+    pcinst_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    return -1;
+}
+
 static int
 build_rev_update_chain(purc_variant_t arr, struct arr_node *node)
 {
@@ -275,6 +350,9 @@ variant_arr_insert_before(purc_variant_t arr, size_t idx, purc_variant_t val,
         return 0;
     }
 
+    if (pcvar_arr_unshare(arr))
+        return -1;
+
     variant_arr_t data = pcvar_arr_get_data(arr);
     PC_ASSERT(data);
 
@@ -333,20 +411,6 @@ variant_arr_insert_before(purc_variant_t arr, size_t idx, purc_variant_t val,
     return -1;
 }
 
-static void
-refresh_extra(purc_variant_t arr)
-{
-    size_t extra = 0;
-    variant_arr_t data = pcvar_arr_get_data(arr);
-    if (data) {
-        extra += sizeof(*data);
-        struct pcutils_array_list *al = &data->al;
-        extra += al->sz * sizeof(*al->nodes);
-        extra += al->nr * sizeof(struct arr_node);
-    }
-    pcvariant_stat_set_extra_size(arr, extra);
-}
-
 static int
 variant_arr_append(purc_variant_t arr, purc_variant_t val,
         bool check)
@@ -426,6 +490,9 @@ static int
 variant_arr_set(purc_variant_t arr, size_t idx, purc_variant_t val,
         bool check)
 {
+    if (pcvar_arr_unshare(arr))
+        return -1;
+
     variant_arr_t data = pcvar_arr_get_data(arr);
     PC_ASSERT(data);
 
@@ -543,6 +610,9 @@ static int
 variant_arr_remove(purc_variant_t arr, size_t idx,
         bool check)
 {
+    if (pcvar_arr_unshare(arr))
+        return -1;
+
     variant_arr_t data = pcvar_arr_get_data(arr);
     PC_ASSERT(data);
 
@@ -608,6 +678,14 @@ array_release (purc_variant_t arr)
     if (!data)
         return;
 
+    if (data->nr_sharing > 0) {
+        // leave the data to the other sharers
+        data->nr_sharing--;
+        arr->sz_ptr[1] = (uintptr_t)NULL;
+        pcvariant_stat_set_extra_size(arr, 0);
+        return;
+    }
+
     struct pcutils_array_list *al = &data->al;
     struct arr_node *p, *n;
     array_list_for_each_entry_reverse_safe(al, p, n, node) {
@@ -900,6 +978,9 @@ int pcvariant_array_sort(purc_variant_t arr, void *ud,
     if (!arr || arr->type != PURC_VARIANT_TYPE_ARRAY)
         return -1;
 
+    if (pcvar_arr_unshare(arr))
+        return -1;
+
     variant_arr_t data = pcvar_arr_get_data(arr);
 
     struct arr_user_data d = {
@@ -916,9 +997,50 @@ int pcvariant_array_sort(purc_variant_t arr, void *ud,
     return 0;
 }
 
+static bool
+has_container_member(variant_arr_t data)
+{
+    struct arr_node *p;
+    array_list_for_each_entry(&data->al, p, node) {
+        if (IS_CONTAINER(p->val->type))
+            return true;
+    }
+
+    return false;
+}
+
+static purc_variant_t
+share_array(purc_variant_t arr)
+{
+    purc_variant_t var = pcvariant_get(PVT(_ARRAY));
+    if (!var) {
+        pcinst_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return PURC_VARIANT_INVALID;
+    }
+
+    variant_arr_t data = pcvar_arr_get_data(arr);
+    data->nr_sharing++;
+
+    var->type          = PVT(_ARRAY);
+    var->flags         = PCVARIANT_FLAG_EXTRA_SIZE;
+    var->refc          = 1;
+    var->sz_ptr[1]     = (uintptr_t)data;
+
+    refresh_extra(var);
+    return var;
+}
+
 purc_variant_t
 pcvariant_array_clone(purc_variant_t arr, bool recursively)
 {
+    /* The nodes of an array in a set are linked to the reverse update
+       chains of the members, which are bound to the parent. And a deep
+       clone can share the data only if there is no member to clone. */
+    if (!pcvar_container_belongs_to_set(arr) && (!recursively ||
+                !has_container_member(pcvar_arr_get_data(arr)))) {
+        return share_array(arr);
+    }
+
     purc_variant_t var;
     var = purc_variant_make_array(0, PURC_VARIANT_INVALID);
     if (var == PURC_VARIANT_INVALID)
@@ -992,6 +1114,9 @@ pcvar_array_build_rue_downward(purc_variant_t arr)
 {
     PC_ASSERT(purc_variant_is_array(arr));
 
+    if (pcvar_arr_unshare(arr))
+        return -1;
+
     variant_arr_t data = pcvar_arr_get_data(arr);
     if (!data)
         return 0;
@@ -1018,6 +1143,9 @@ pcvar_array_build_edge_to_parent(purc_variant_t arr,
         struct pcvar_rev_update_edge *edge)
 {
     PC_ASSERT(purc_variant_is_array(arr));
+    if (pcvar_arr_unshare(arr))
+        return -1;
+
     variant_arr_t data = pcvar_arr_get_data(arr);
     if (!data)
         return 0;
@@ -1118,6 +1246,7 @@ pcvar_arr_it_first(purc_variant_t arr)
         return it;
 
     struct pcutils_array_list *al = &data->al;
+    it.al = al;
 
     struct pcutils_array_list_node *first;
     first = pcutils_array_list_get_first(al);
@@ -1142,6 +1271,7 @@ pcvar_arr_it_last(purc_variant_t arr)
         return it;
 
     struct pcutils_array_list *al = &data->al;
+    it.al = al;
 
     struct pcutils_array_list_node *last;
     last = pcutils_array_list_get_last(al);
@@ -1158,8 +1288,7 @@ pcvar_arr_it_next(struct arr_iterator *it)
         return;
 
     if (it->next) {
-        variant_arr_t data = pcvar_arr_get_data(it->arr);
-        struct pcutils_array_list *al = &data->al;
+        struct pcutils_array_list *al = it->al;
 
         struct pcutils_array_list_node *next;
         next = &it->next->node;
@@ -1180,8 +1309,7 @@ pcvar_arr_it_prev(struct arr_iterator *it)
         return;
 
     if (it->prev) {
-        variant_arr_t data = pcvar_arr_get_data(it->arr);
-        struct pcutils_array_list *al = &data->al;
+        struct pcutils_array_list *al = it->al;
 
         struct pcutils_array_list_node *prev;
         prev = &it->prev->node;
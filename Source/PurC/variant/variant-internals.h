@@ -104,6 +104,11 @@ pcvar_container_belongs_to_set(purc_variant_t val) WTF_INTERNAL;
 purc_variant_t
 pcvariant_container_clone(purc_variant_t cntr, bool recursively) WTF_INTERNAL;
 
+int
+pcvar_arr_unshare(purc_variant_t arr) WTF_INTERNAL;
+int
+pcvar_obj_unshare(purc_variant_t obj) WTF_INTERNAL;
+
 purc_variant_t
 pcvariant_array_clone(purc_variant_t arr, bool recursively) WTF_INTERNAL;
 purc_variant_t
@@ -172,6 +177,8 @@ pcvar_tuple_build_edge_to_parent(purc_variant_t tuple,
         struct pcvar_rev_update_edge *edge);
 
 
+/* do not keep it across a write to the object, which may unshare the
+   data; pcvrnt_object_iterator pins the data instead */
 struct obj_iterator {
     purc_variant_t                obj;
 
@@ -189,8 +196,11 @@ pcvar_obj_it_next(struct obj_iterator *it);
 void
 pcvar_obj_it_prev(struct obj_iterator *it);
 
+/* walks the list the array held at pcvar_arr_it_first()/_last(); do not
+   keep it across a write to the array, which may unshare the list */
 struct arr_iterator {
     purc_variant_t                arr;
+    struct pcutils_array_list    *al;
 
     struct arr_node              *curr;
     struct arr_node              *next;
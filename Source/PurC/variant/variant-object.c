@@ -224,6 +224,86 @@ obj_node_create(purc_variant_t k, purc_variant_t v)
     return node;
 }
 
+static void
+free_private_nodes(struct rb_node *p)
+{
+    while (p) {
+        struct obj_node *node = container_of(p, struct obj_node, node);
+        free_private_nodes(p->rb_right);
+        p = p->rb_left;
+
+        PURC_VARIANT_SAFE_CLEAR(node->key);
+        PURC_VARIANT_SAFE_CLEAR(node->val);
+        free(node);
+    }
+}
+
+/* copies the subtree with the same shape and colors; no rebalancing */
+static struct rb_node *
+copy_subtree(const struct rb_node *src, struct rb_node *parent)
+{
+    if (src == NULL)
+        return NULL;
+
+    const struct obj_node *sn = container_of(src, struct obj_node, node);
+    struct obj_node *node = obj_node_create(sn->key, sn->val);
+    if (!node)
+        return NULL;
+
+    node->node.rb_color = src->rb_color;
+    node->node.rb_parent = parent;
+
+    if (src->rb_left) {
+        node->node.rb_left = copy_subtree(src->rb_left, &node->node);
+        if (node->node.rb_left == NULL)
+            goto failed;
+    }
+
+    if (src->rb_right) {
+        node->node.rb_right = copy_subtree(src->rb_right, &node->node);
+        if (node->node.rb_right == NULL)
+            goto failed;
+    }
+
+    return &node->node;
+
+failed:
+    free_private_nodes(&node->node);
+    return NULL;
+}
+
+int
+pcvar_obj_unshare(purc_variant_t obj)
+{
+    variant_obj_t data = pcvar_obj_get_data(obj);
+    if (!data || data->nr_sharing == 0)
+        return 0;
+
+    variant_obj_t copy = (variant_obj_t)calloc(1, sizeof(*copy));
+    if (!copy)
+        goto failed;
+
+    copy->kvs = RB_ROOT;
+    if (data->kvs.rb_node) {
+        copy->kvs.rb_node = copy_subtree(data->kvs.rb_node, NULL);
+        if (copy->kvs.rb_node == NULL)
+            goto failed;
+    }
+    copy->size = data->size;
+
+    // the other sharers keep the original data
+    data->nr_sharing--;
+    obj->sz_ptr[1] = (uintptr_t)copy;
+    pcvariant_stat_set_extra_size(obj, OBJ_EXTRA_SIZE(copy));
+    return 0;
+
+failed:
+    if (copy)
+        free(copy);
+    pcinst_set_error(PURC_ERROR_OUT_OF_MEMORY);
+    return -1;
+}
+
 static int
 build_rev_update_chain(purc_variant_t obj, struct obj_node *node)
 {
@@ -294,6 +374,9 @@ static int
 v_object_remove(purc_variant_t obj, const char *key, bool silently,
         bool check)
 {
+    if (pcvar_obj_unshare(obj))
+        return -1;
+
     variant_obj_t data = pcvar_obj_get_data(obj);
     struct rb_root *root = &data->kvs;
     struct rb_node **pnode = &root->rb_node;
@@ -470,6 +553,9 @@ v_object_set(purc_variant_t obj, purc_variant_t key, purc_variant_t val,
         return -1;
     }
 
+    if (pcvar_obj_unshare(obj))
+        return -1;
+
     variant_obj_t data = pcvar_obj_get_data(obj);
     PC_ASSERT(data);
 
@@ -752,6 +838,14 @@ void pcvariant_object_release (purc_variant_t value)
 {
     variant_obj_t data = pcvar_obj_get_data(value);
 
+    if (data->nr_sharing > 0) {
+        // leave the data to the other sharers
+        data->nr_sharing--;
+        value->sz_ptr[1] = (uintptr_t)NULL;
+        pcvariant_stat_set_extra_size(value, 0);
+        return;
+    }
+
     struct rb_root *root = &data->kvs;
 
     struct rb_node *p, *n;
@@ -882,8 +976,38 @@ bool purc_variant_object_size (purc_variant_t obj, size_t *sz)
 
 struct pcvrnt_object_iterator {
     struct obj_iterator it;
+    /* the data walked, pinned as a sharer; NULL if not pinned */
+    variant_obj_t       pinned;
 };
 
+/* An iterator outlives the calls on the object, so it pins the data as one
+   more sharer: a write to the object then gives the object a private copy,
+   and the iterator goes on walking the data it started on. The data of an
+   object in a set is never shared, so the iterator walks it in place. */
+static variant_obj_t
+pin_data(purc_variant_t obj)
+{
+    if (pcvar_container_belongs_to_set(obj))
+        return NULL;
+
+    variant_obj_t data = pcvar_obj_get_data(obj);
+    data->nr_sharing++;
+    return data;
+}
+
+static void
+unpin_data(variant_obj_t data)
+{
+    if (data->nr_sharing > 0) {
+        data->nr_sharing--;
+        return;
+    }
+
+    // the iterator is the last sharer
+    free_private_nodes(data->kvs.rb_node);
+    free(data);
+}
+
 struct pcvrnt_object_iterator*
 pcvrnt_object_iterator_create_begin (purc_variant_t object)
 {
@@ -904,6 +1028,7 @@ pcvrnt_object_iterator_create_begin (purc_variant_t object)
         return NULL;
     }
 
+    it->pinned = pin_data(object);
     it->it = pcvar_obj_it_first(object);
 
     return it;
@@ -928,6 +1053,7 @@ pcvrnt_object_iterator_create_end (purc_variant_t object) {
         return NULL;
     }
 
+    it->pinned = pin_data(object);
     it->it = pcvar_obj_it_last(object);
 
     return it;
@@ -939,6 +1065,9 @@ pcvrnt_object_iterator_release (struct pcvrnt_object_iterator* it)
     if (!it)
         return;
 
+    if (it->pinned)
+        unpin_data(it->pinned);
+
     it->it.obj  = PURC_VARIANT_INVALID;
     it->it.curr = NULL;
     it->it.next = NULL;
@@ -995,9 +1124,49 @@ pcvrnt_object_iterator_get_value(struct pcvrnt_object_iterator* it)
     return it->it.curr->val;
 }
 
+static bool
+has_container_member(variant_obj_t data)
+{
+    struct rb_node *p = pcutils_rbtree_first(&data->kvs);
+    for (; p; p = pcutils_rbtree_next(p)) {
+        struct obj_node *node = container_of(p, struct obj_node, node);
+        if (IS_CONTAINER(node->val->type))
+            return true;
+    }
+
+    return false;
+}
+
+static purc_variant_t
+share_object(purc_variant_t obj)
+{
+    purc_variant_t var = pcvariant_get(PVT(_OBJECT));
+    if (!var) {
+        pcinst_set_error(PURC_ERROR_OUT_OF_MEMORY);
+        return PURC_VARIANT_INVALID;
+    }
+
+    variant_obj_t data = pcvar_obj_get_data(obj);
+    data->nr_sharing++;
+
+    var->type          = PVT(_OBJECT);
+    var->flags         = PCVARIANT_FLAG_EXTRA_SIZE;
+    var->refc          = 1;
+    var->sz_ptr[1]     = (uintptr_t)data;
+
+    pcvariant_stat_set_extra_size(var, OBJ_EXTRA_SIZE(data));
+    return var;
+}
+
 purc_variant_t
 pcvariant_object_clone(purc_variant_t obj, bool recursively)
 {
+    /* See pcvariant_array_clone() for the conditions to share the data */
+    if (!pcvar_container_belongs_to_set(obj) && (!recursively ||
+                !has_container_member(pcvar_obj_get_data(obj)))) {
+        return share_object(obj);
+    }
+
     purc_variant_t var;
     var = purc_variant_make_object(0,
             PURC_VARIANT_INVALID, PURC_VARIANT_INVALID);
@@ -1072,6 +1241,9 @@ int
 pcvar_object_build_rue_downward(purc_variant_t obj)
 {
     PC_ASSERT(purc_variant_is_object(obj));
+    if (pcvar_obj_unshare(obj))
+        return -1;
+
     variant_obj_t data = (variant_obj_t)obj->sz_ptr[1];
     if (!data)
         return 0;
@@ -1101,6 +1273,9 @@ pcvar_object_build_edge_to_parent(purc_variant_t obj,
         struct pcvar_rev_update_edge *edge)
 {
     PC_ASSERT(purc_variant_is_object(obj));
+    if (pcvar_obj_unshare(obj))
+        return -1;
+
     variant_obj_t data = (variant_obj_t)obj->sz_ptr[1];
     if (!data)
         return 0;
@@ -0,0 +1,498 @@
+/*
+ * @file variant-sort.c
+ * @brief Sorting the members of array and set by extracted keys.
+ *
+ * Copyright (C) 2026 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "private/variant.h"
+#include "private/errors.h"
+#include "private/array_list.h"
+#include "purc-errors.h"
+#include "purc-utils.h"
+#include "variant-internals.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* sort runs not longer than this by insertion */
+#define INSERTION_SORT_MAX      16
+
+/* sort a single numeric key by radix from this number of members */
+#define RADIX_SORT_MIN          256
+
+#define MAX_SORT_JOBS           8
+
+union sort_val {
+    double          d;
+    const char     *s;
+};
+
+struct sort_ctxt {
+    const struct pcvariant_sort_key    *keys;
+    size_t                              nr_keys;
+    bool                                desc;
+
+    /* nr_keys values for each member */
+    union sort_val                     *vals;
+};
+
+/* NaN goes after all numbers in either order */
+static inline int
+compare_numbers(double l, double r, bool desc)
+{
+    bool l_nan = isnan(l), r_nan = isnan(r);
+    if (l_nan || r_nan)
+        return l_nan - r_nan;
+
+    int ret = (l > r) - (l < r);
+    return desc ? -ret : ret;
+}
+
+/* NULL (no key) goes before all strings in either order; caseless keys
+   are folded when extracted, so both kinds are compared by strcmp() */
+static inline int
+compare_strings(const char *l, const char *r, bool desc)
+{
+    if (l == NULL || r == NULL)
+        return (l != NULL) - (r != NULL);
+
+    int ret = strcmp(l, r);
+    return desc ? -ret : ret;
+}
+
+static int
+compare_members(const struct sort_ctxt *ctxt, size_t a, size_t b)
+{
+    const union sort_val *l = ctxt->vals + a * ctxt->nr_keys;
+    const union sort_val *r = ctxt->vals + b * ctxt->nr_keys;
+
+    for (size_t i = 0; i < ctxt->nr_keys; i++) {
+        int ret;
+
+        switch (ctxt->keys[i].type) {
+        case PCVARIANT_SORT_KEY_NUMBER:
+            ret = compare_numbers(l[i].d, r[i].d, ctxt->desc);
+            break;
+
+        case PCVARIANT_SORT_KEY_CASE:
+        case PCVARIANT_SORT_KEY_CASELESS:
+        default:
+            ret = compare_strings(l[i].s, r[i].s, ctxt->desc);
+            break;
+        }
+
+        if (ret)
+            return ret;
+    }
+
+    return 0;
+}
+
+static void
+insertion_sort(const struct sort_ctxt *ctxt, size_t *order, size_t nr)
+{
+    for (size_t i = 1; i < nr; i++) {
+        size_t v = order[i];
+        size_t j = i;
+        while (j > 0 && compare_members(ctxt, order[j - 1], v) > 0) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = v;
+    }
+}
+
+/* Merge order[0, half) and order[half, nr); tmp holds at least half. */
+static void
+merge_runs(const struct sort_ctxt *ctxt, size_t *order, size_t half,
+        size_t nr, size_t *tmp)
+{
+    if (compare_members(ctxt, order[half - 1], order[half]) <= 0)
+        return;
+
+    memcpy(tmp, order, half * sizeof(*order));
+
+    size_t i = 0, j = half, k = 0;
+    while (i < half && j < nr) {
+        if (compare_members(ctxt, order[j], tmp[i]) < 0)
+            order[k++] = order[j++];
+        else
+            order[k++] = tmp[i++];
+    }
+
+    while (i < half)
+        order[k++] = tmp[i++];
+}
+
+static void
+merge_sort(const struct sort_ctxt *ctxt, size_t *order, size_t *tmp,
+        size_t nr)
+{
+    if (nr <= INSERTION_SORT_MAX) {
+        insertion_sort(ctxt, order, nr);
+        return;
+    }
+
+    size_t half = nr / 2;
+    merge_sort(ctxt, order, tmp, half);
+    merge_sort(ctxt, order + half, tmp + half, nr - half);
+    merge_runs(ctxt, order, half, nr, tmp);
+}
+
+struct sort_job {
+    const struct sort_ctxt *ctxt;
+    size_t                 *order;
+    size_t                 *tmp;
+    size_t                  nr;
+    pthread_t               thread;
+    bool                    started;
+};
+
+static void *
+sort_job_entry(void *arg)
+{
+    struct sort_job *job = arg;
+    merge_sort(job->ctxt, job->order, job->tmp, job->nr);
+    return NULL;
+}
+
+static size_t
+nr_sort_jobs(size_t nr)
+{
+    if (nr < PCVARIANT_SORT_PARALLEL_MIN)
+        return 1;
+
+    long nr_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t nr_jobs = 1;
+    while (nr_jobs * 2 <= (size_t)nr_cpus && nr_jobs * 2 <= MAX_SORT_JOBS)
+        nr_jobs *= 2;
+
+    return nr_jobs;
+}
+
+/*
+ * Only the extracted keys are touched here, so the runs can be sorted
+ * by the worker threads without knowing anything of the variants.
+ */
+static void
+parallel_merge_sort(const struct sort_ctxt *ctxt, size_t *order,
+        size_t *tmp, size_t nr)
+{
+    size_t nr_jobs = nr_sort_jobs(nr);
+    if (nr_jobs < 2) {
+        merge_sort(ctxt, order, tmp, nr);
+        return;
+    }
+
+    struct sort_job jobs[MAX_SORT_JOBS];
+    size_t bounds[MAX_SORT_JOBS + 1];
+    size_t chunk = nr / nr_jobs;
+
+    for (size_t i = 0; i < nr_jobs; i++)
+        bounds[i] = i * chunk;
+    bounds[nr_jobs] = nr;
+
+    for (size_t i = 0; i < nr_jobs; i++) {
+        jobs[i].ctxt = ctxt;
+        jobs[i].order = order + bounds[i];
+        jobs[i].tmp = tmp + bounds[i];
+        jobs[i].nr = bounds[i + 1] - bounds[i];
+        /* the first run is sorted by the calling thread */
+        jobs[i].started = (i > 0) && pthread_create(&jobs[i].thread, NULL,
+                sort_job_entry, jobs + i) == 0;
+    }
+
+    for (size_t i = 0; i < nr_jobs; i++) {
+        if (!jobs[i].started)
+            sort_job_entry(jobs + i);
+    }
+
+    for (size_t i = 1; i < nr_jobs; i++) {
+        if (jobs[i].started)
+            pthread_join(jobs[i].thread, NULL);
+    }
+
+    for (size_t width = 1; width < nr_jobs; width *= 2) {
+        for (size_t i = 0; i + width < nr_jobs; i += 2 * width) {
+            size_t lo = bounds[i];
+            size_t mid = bounds[i + width];
+            size_t end = i + 2 * width;
+            size_t hi = bounds[end < nr_jobs ? end : nr_jobs];
+            merge_runs(ctxt, order + lo, mid - lo, hi - lo, tmp);
+        }
+    }
+}
+
+struct radix_item {
+    uint64_t        key;
+    size_t          idx;
+};
+
+/* Map a double to an unsigned integer keeping the order; NaN is mapped to
+   the maximum in either order, as compare_numbers() does. */
+static inline uint64_t
+radix_key(double d, bool desc)
+{
+    uint64_t bits;
+
+    if (isnan(d))
+        return UINT64_MAX;
+
+    if (d == 0)
+        d = 0;      /* -0.0 equals to 0.0 */
+    memcpy(&bits, &d, sizeof(bits));
+
+    if (bits & UINT64_C(0x8000000000000000))
+        bits = ~bits;
+    else
+        bits |= UINT64_C(0x8000000000000000);
+
+    return desc ? ~bits : bits;
+}
+
+/* A stable LSD radix sort by bytes; returns -1 if out of memory. */
+static int
+radix_sort(const struct sort_ctxt *ctxt, size_t *order, size_t nr)
+{
+    struct radix_item *base, *items, *tmp;
+    base = malloc(sizeof(*base) * nr * 2);
+    if (base == NULL)
+        return -1;
+    items = base;
+    tmp = base + nr;
+
+    size_t counts[sizeof(uint64_t)][256];
+    memset(counts, 0, sizeof(counts));
+
+    for (size_t i = 0; i < nr; i++) {
+        uint64_t key = radix_key(ctxt->vals[i].d, ctxt->desc);
+        items[i].key = key;
+        items[i].idx = i;
+        for (size_t b = 0; b < sizeof(uint64_t); b++)
+            counts[b][(key >> (b * 8)) & 0xFF]++;
+    }
+
+    for (size_t b = 0; b < sizeof(uint64_t); b++) {
+        size_t *count = counts[b];
+        unsigned shift = b * 8;
+
+        /* skip the byte if all keys have the same one */
+        if (count[(items[0].key >> shift) & 0xFF] == nr)
+            continue;
+
+        size_t offset = 0;
+        for (size_t i = 0; i < 256; i++) {
+            size_t c = count[i];
+            count[i] = offset;
+            offset += c;
+        }
+
+        for (size_t i = 0; i < nr; i++)
+            tmp[count[(items[i].key >> shift) & 0xFF]++] = items[i];
+
+        struct radix_item *t = items;
+        items = tmp;
+        tmp = t;
+    }
+
+    for (size_t i = 0; i < nr; i++)
+        order[i] = items[i].idx;
+
+    free(base);
+    return 0;
+}
+
+static inline purc_variant_t
+member_value(purc_variant_t container, struct pcutils_array_list_node *node)
+{
+    if (container->type == PURC_VARIANT_TYPE_ARRAY)
+        return container_of(node, struct arr_node, node)->val;
+
+    return container_of(node, struct set_node, alnode)->val;
+}
+
+static const char *
+extract_string(purc_variant_t v, char **owned)
+{
+    switch (v->type) {
+    case PURC_VARIANT_TYPE_STRING:
+    case PURC_VARIANT_TYPE_ATOMSTRING:
+    case PURC_VARIANT_TYPE_EXCEPTION:
+        /* no need to copy */
+        return purc_variant_get_string_const(v);
+
+    default:
+        if (purc_variant_stringify_alloc(owned, v) < 0) {
+            *owned = NULL;
+            purc_clr_error();
+        }
+        return *owned;
+    }
+}
+
+/* Fold the ASCII letters to lower case as pcutils_strcasecmp() does;
+   the string is copied only if it has an upper case letter and is not
+   owned yet. Returns NULL if out of memory. */
+static const char *
+fold_string(const char *str, char **owned)
+{
+    const char *p = str;
+    while (*p && !purc_isupper((unsigned char)*p))
+        p++;
+    if (*p == '\0')
+        return str;
+
+    if (*owned == NULL) {
+        *owned = strdup(str);
+        if (*owned == NULL)
+            return NULL;
+        p = *owned + (p - str);
+    }
+
+    for (char *q = (char *)p; *q; q++)
+        *q = purc_tolower((unsigned char)*q);
+    return *owned;
+}
+
+/* Returns -1 if out of memory. */
+static int
+extract_keys(const struct sort_ctxt *ctxt, purc_variant_t member,
+        union sort_val *vals, char **owned)
+{
+    for (size_t i = 0; i < ctxt->nr_keys; i++) {
+        const struct pcvariant_sort_key *key = ctxt->keys + i;
+        purc_variant_t v = member;
+
+        if (key->name) {
+            v = PURC_VARIANT_INVALID;
+            if (member->type == PURC_VARIANT_TYPE_OBJECT) {
+                v = purc_variant_object_get_by_ckey(member, key->name);
+                purc_clr_error();
+            }
+        }
+
+        if (key->type == PCVARIANT_SORT_KEY_NUMBER) {
+            vals[i].d = v ? purc_variant_numerify(v) : 0.0;
+            continue;
+        }
+
+        const char *str = v ? extract_string(v, owned + i) : NULL;
+        if (str && key->type != PCVARIANT_SORT_KEY_CASE) {
+            str = fold_string(str, owned + i);
+            if (str == NULL)
+                return -1;
+        }
+        vals[i].s = str;
+    }
+
+    return 0;
+}
+
+int pcvariant_sort_by_keys(purc_variant_t container,
+        const struct pcvariant_sort_key *keys, size_t nr_keys, bool desc)
+{
+    struct pcutils_array_list *al;
+
+    if (container == PURC_VARIANT_INVALID) {
+        purc_set_error(PURC_ERROR_INVALID_VALUE);
+        return -1;
+    }
+
+    if (container->type == PURC_VARIANT_TYPE_ARRAY) {
+        if (pcvar_arr_unshare(container))
+            return -1;
+        al = &pcvar_arr_get_data(container)->al;
+    }
+    else if (container->type == PURC_VARIANT_TYPE_SET)
+        al = &pcvar_set_get_data(container)->al;
+    else {
+        purc_set_error(PURC_ERROR_WRONG_DATA_TYPE);
+        return -1;
+    }
+
+    size_t nr = al->nr;
+    if (nr < 2 || nr_keys == 0)
+        return 0;
+
+    bool has_string = false;
+    for (size_t i = 0; i < nr_keys; i++) {
+        if (keys[i].type != PCVARIANT_SORT_KEY_NUMBER)
+            has_string = true;
+    }
+
+    int ret = -1;
+    struct sort_ctxt ctxt = { keys, nr_keys, desc, NULL };
+    char **owned = NULL;
+    size_t *order = NULL;
+    size_t *tmp = NULL;
+
+    ctxt.vals = malloc(sizeof(*ctxt.vals) * nr * nr_keys);
+    order = malloc(sizeof(*order) * nr);
+    if (has_string)
+        owned = calloc(nr * nr_keys, sizeof(*owned));
+    if (ctxt.vals == NULL || order == NULL || (has_string && owned == NULL))
+        goto out_of_memory;
+
+    for (size_t i = 0; i < nr; i++) {
+        purc_variant_t member = member_value(container, al->nodes[i]);
+        if (extract_keys(&ctxt, member, ctxt.vals + i * nr_keys,
+                    owned ? owned + i * nr_keys : NULL))
+            goto out_of_memory;
+    }
+
+    if (nr_keys == 1 && keys[0].type == PCVARIANT_SORT_KEY_NUMBER &&
+            nr >= RADIX_SORT_MIN) {
+        if (radix_sort(&ctxt, order, nr))
+            goto out_of_memory;
+    }
+    else {
+        tmp = malloc(sizeof(*tmp) * nr);
+        if (tmp == NULL)
+            goto out_of_memory;
+
+        for (size_t i = 0; i < nr; i++)
+            order[i] = i;
+        parallel_merge_sort(&ctxt, order, tmp, nr);
+    }
+
+    if (pcutils_array_list_permute(al, order))
+        goto out_of_memory;
+
+    ret = 0;
+    goto done;
+
+out_of_memory:
+    purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+
+done:
+    if (owned) {
+        for (size_t i = 0; i < nr * nr_keys; i++)
+            free(owned[i]);
+        free(owned);
+    }
+    free(tmp);
+    free(order);
+    free(ctxt.vals);
+    return ret;
+}
@@ -31,6 +31,7 @@
 #include "private/debug.h"
 #include "private/dvobjs.h"
 #include "private/utils.h"
+#include "private/hashtable.h"
 #include "variant-internals.h"
 
 #include <stdlib.h>
@@ -77,6 +78,11 @@ static pcvariant_release_fn variant_releasers[PURC_VARIANT_TYPE_NR] = {
 _COMPILE_TIME_ASSERT(msgs,
         PCA_TABLESIZE(variant_err_msgs) == PCVARIANT_ERROR_NR);
 
+/* Make sure a variant cell takes no more than 32 bytes on 64-bit platforms */
+_COMPILE_TIME_ASSERT(cell,
+        sizeof(void *) != 8 || sizeof(long double) > 16 ||
+        sizeof(purc_variant) == 32);
+
 #undef _COMPILE_TIME_ASSERT
 
 static struct err_msg_seg _variant_err_msgs_seg = {
@@ -171,6 +177,12 @@ static void _cleanup_instance(struct pcinst *inst)
     assert(heap->v_true.refc == 0);
     assert(heap->v_false.refc == 0);
 
+    if (heap->listeners_map) {
+        assert(pchash_table_length(heap->listeners_map) == 0);
+        pchash_table_free(heap->listeners_map);
+        heap->listeners_map = NULL;
+    }
+
     free(heap);
     inst->variant_heap = NULL;
     inst->org_vrt_heap = NULL;
@@ -194,24 +206,20 @@ static int _init_instance(struct pcinst *curr_inst,
     inst->variant_heap->v_undefined.type = PURC_VARIANT_TYPE_UNDEFINED;
     inst->variant_heap->v_undefined.refc = 0;
     inst->variant_heap->v_undefined.flags = PCVARIANT_FLAG_NOFREE;
-    // INIT_LIST_HEAD(&inst->variant_heap->v_undefined.listeners);
 
     inst->variant_heap->v_null.type = PURC_VARIANT_TYPE_NULL;
     inst->variant_heap->v_null.refc = 0;
     inst->variant_heap->v_null.flags = PCVARIANT_FLAG_NOFREE;
-    // INIT_LIST_HEAD(&inst->variant_heap->v_null.listeners);
 
     inst->variant_heap->v_false.type = PURC_VARIANT_TYPE_BOOLEAN;
     inst->variant_heap->v_false.refc = 0;
     inst->variant_heap->v_false.flags = PCVARIANT_FLAG_NOFREE;
     inst->variant_heap->v_false.b = false;
-    // INIT_LIST_HEAD(&inst->variant_heap->v_false.listeners);
 
     inst->variant_heap->v_true.type = PURC_VARIANT_TYPE_BOOLEAN;
     inst->variant_heap->v_true.refc = 0;
     inst->variant_heap->v_true.flags = PCVARIANT_FLAG_NOFREE;
     inst->variant_heap->v_true.b = true;
-    // INIT_LIST_HEAD(&inst->variant_heap->v_true.listeners);
 
     /* XXX: there are two values of boolean.  */
     struct purc_variant_stat *stat = &(inst->variant_heap->stat);
@@ -475,9 +483,6 @@ purc_variant_t pcvariant_get(enum purc_variant_type type)
     stat->nr_values[type]++;
     stat->nr_total_values++;
 
-    // init listeners
-    INIT_LIST_HEAD(&value->listeners);
-
     return value;
 }
 
@@ -488,9 +493,7 @@ void pcvariant_put(purc_variant_t value)
     struct purc_variant_stat *stat = &(heap->stat);
 
     PC_ASSERT(value);
-    if (IS_CONTAINER(value->type)) {
-        PC_ASSERT(list_empty(&value->listeners));
-    }
+    PC_ASSERT(!(value->flags & PCVARIANT_FLAG_LISTENERS));
 
     // set stat information
     stat->nr_values[value->type]--;
@@ -2543,6 +2546,66 @@ purc_variant_stringify_alloc(char **strp, purc_variant_t value)
     return sz_content;
 }
 
+static void
+do_stringify_count(struct stringify_arg *arg, const void *src, size_t len)
+{
+    if (len == 0)
+        len = strlen(src);
+
+    *(size_t *)arg->arg += len;
+}
+
+size_t
+pcvariant_stringify_length(purc_variant_t value)
+{
+    size_t len = 0;
+    struct stringify_arg arg = {
+        .cb     = do_stringify_count,
+        .arg    = &len,
+        .flags  = 0,
+    };
+
+    variant_stringify(&arg, value);
+    return len;
+}
+
+struct stringify_mem {
+    char                     *p;
+    char                     *end;
+};
+
+static void
+do_stringify_mem(struct stringify_arg *arg, const void *src, size_t len)
+{
+    struct stringify_mem *ud = (struct stringify_mem *)arg->arg;
+
+    if (len == 0)
+        len = strlen(src);
+
+    if (len > (size_t)(ud->end - ud->p))
+        len = ud->end - ud->p;
+
+    memcpy(ud->p, src, len);
+    ud->p += len;
+}
+
+size_t
+pcvariant_stringify_to_mem(char *buf, size_t sz_buf, purc_variant_t value)
+{
+    struct stringify_mem ud = {
+        .p      = buf,
+        .end    = buf + sz_buf,
+    };
+    struct stringify_arg arg = {
+        .cb     = do_stringify_mem,
+        .arg    = &ud,
+        .flags  = 0,
+    };
+
+    variant_stringify(&arg, value);
+    return ud.p - buf;
+}
+
 ssize_t pcvariant_serialize(char *buf, size_t sz, purc_variant_t val)
 {
     PC_ASSERT(val != PURC_VARIANT_INVALID);
@@ -2721,6 +2784,19 @@ pcvariant_container_clone(purc_variant_t ctnr, bool recursively)
     }
 }
 
+int
+pcvariant_container_unshare(purc_variant_t ctnr)
+{
+    switch (ctnr->type) {
+        case PURC_VARIANT_TYPE_ARRAY:
+            return pcvar_arr_unshare(ctnr);
+        case PURC_VARIANT_TYPE_OBJECT:
+            return pcvar_obj_unshare(ctnr);
+        default:
+            return 0;
+    }
+}
+
 purc_variant_t
 purc_variant_container_clone(purc_variant_t ctnr)
 {
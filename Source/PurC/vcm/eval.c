@@ -702,6 +702,223 @@ out:
     return result;
 }
 
+/*
+ * The vDOM, and so the VCM trees, may be shared by the instances running in
+ * different threads (see cache_vdom() in hvml-loader.c). So a tree is folded
+ * once under a lock, and a constant subtree is folded into a literal node,
+ * but never into a variant, which would belong to the heap of one instance.
+ */
+static struct purc_mutex fold_lock;
+
+static bool
+is_literal_node(struct pcvcm_node *node)
+{
+    switch (node->type) {
+    case PCVCM_NODE_TYPE_UNDEFINED:
+    case PCVCM_NODE_TYPE_STRING:
+    case PCVCM_NODE_TYPE_NULL:
+    case PCVCM_NODE_TYPE_BOOLEAN:
+    case PCVCM_NODE_TYPE_NUMBER:
+    case PCVCM_NODE_TYPE_LONG_INT:
+    case PCVCM_NODE_TYPE_ULONG_INT:
+    case PCVCM_NODE_TYPE_LONG_DOUBLE:
+    case PCVCM_NODE_TYPE_BYTE_SEQUENCE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void *
+dup_bytes(const void *bytes, size_t nr_bytes)
+{
+    uint8_t *buf = (uint8_t *)malloc(nr_bytes + 1);
+    if (buf) {
+        memcpy(buf, bytes, nr_bytes);
+        buf[nr_bytes] = 0;
+    }
+    return buf;
+}
+
+/* Turns the node into the literal node of the value; returns false if the
+   value has no literal form */
+static bool
+make_literal(struct pcvcm_node *node, purc_variant_t v)
+{
+    enum pcvcm_node_type type;
+    const void *bytes = NULL;
+    size_t nr_bytes = 0;
+
+    switch (purc_variant_get_type(v)) {
+    case PURC_VARIANT_TYPE_UNDEFINED:
+        type = PCVCM_NODE_TYPE_UNDEFINED;
+        break;
+    case PURC_VARIANT_TYPE_NULL:
+        type = PCVCM_NODE_TYPE_NULL;
+        break;
+    case PURC_VARIANT_TYPE_BOOLEAN:
+        type = PCVCM_NODE_TYPE_BOOLEAN;
+        break;
+    case PURC_VARIANT_TYPE_NUMBER:
+        type = PCVCM_NODE_TYPE_NUMBER;
+        break;
+    case PURC_VARIANT_TYPE_LONGINT:
+        type = PCVCM_NODE_TYPE_LONG_INT;
+        break;
+    case PURC_VARIANT_TYPE_ULONGINT:
+        type = PCVCM_NODE_TYPE_ULONG_INT;
+        break;
+    case PURC_VARIANT_TYPE_LONGDOUBLE:
+        type = PCVCM_NODE_TYPE_LONG_DOUBLE;
+        break;
+    case PURC_VARIANT_TYPE_STRING:
+        type = PCVCM_NODE_TYPE_STRING;
+        bytes = purc_variant_get_string_const_ex(v, &nr_bytes);
+        break;
+    case PURC_VARIANT_TYPE_BSEQUENCE:
+        type = PCVCM_NODE_TYPE_BYTE_SEQUENCE;
+        bytes = purc_variant_get_bytes_const(v, &nr_bytes);
+        break;
+    default:
+        return false;
+    }
+
+    void *buf = NULL;
+    if (bytes && (nr_bytes || type == PCVCM_NODE_TYPE_STRING)) {
+        buf = dup_bytes(bytes, nr_bytes);
+        if (buf == NULL)
+            return false;
+    }
+
+    struct pcvcm_node *child;
+    while ((child = pcvcm_node_first_child(node))) {
+        pcvcm_node_remove_child(node, child);
+        pcvcm_node_destroy(child);
+    }
+
+    node->type = type;
+    node->is_closed = true;
+    switch (type) {
+    case PCVCM_NODE_TYPE_BOOLEAN:
+        node->b = purc_variant_booleanize(v);
+        break;
+    case PCVCM_NODE_TYPE_NUMBER:
+        purc_variant_cast_to_number(v, &node->d, false);
+        break;
+    case PCVCM_NODE_TYPE_LONG_INT:
+        purc_variant_cast_to_longint(v, &node->i64, false);
+        break;
+    case PCVCM_NODE_TYPE_ULONG_INT:
+        purc_variant_cast_to_ulongint(v, &node->u64, false);
+        break;
+    case PCVCM_NODE_TYPE_LONG_DOUBLE:
+        purc_variant_cast_to_longdouble(v, &node->ld, false);
+        break;
+    case PCVCM_NODE_TYPE_STRING:
+    case PCVCM_NODE_TYPE_BYTE_SEQUENCE:
+        node->sz_ptr[0] = nr_bytes;
+        node->sz_ptr[1] = (uintptr_t)buf;
+        break;
+    default:
+        break;
+    }
+
+    return true;
+}
+
+/*
+ * Folds the constant subtrees of the tree into literal nodes.
+ * Returns whether the value of the node depends on nothing but the node.
+ */
+static bool
+fold_constants(struct pcvcm_node *node)
+{
+    bool constant = true;
+
+    struct pcvcm_node *child = pcvcm_node_first_child(node);
+    while (child) {
+        if (!fold_constants(child))
+            constant = false;
+        child = (struct pcvcm_node *)pctree_node_next(&child->tree_node);
+    }
+
+    if (!constant)
+        return false;
+
+    switch (node->type) {
+    case PCVCM_NODE_TYPE_ARRAY:
+    case PCVCM_NODE_TYPE_OBJECT:
+    case PCVCM_NODE_TYPE_CJSONEE_OP_AND:
+    case PCVCM_NODE_TYPE_CJSONEE_OP_OR:
+    case PCVCM_NODE_TYPE_CJSONEE_OP_SEMICOLON:
+        /* no literal form, or evaluated as a part of the CJSONEE */
+        return true;
+
+    case PCVCM_NODE_TYPE_CJSONEE:
+    case PCVCM_NODE_TYPE_FUNC_CONCAT_STRING:
+        break;
+
+    default:
+        return is_literal_node(node);
+    }
+
+    struct pcvcm_eval_ctxt *ctxt = pcvcm_eval_ctxt_create();
+    if (ctxt == NULL)
+        return false;
+
+    purc_variant_t v = eval_vcm(node, ctxt, PURC_VARIANT_INVALID,
+            NULL, NULL, false, false, false);
+    pcvcm_eval_ctxt_destroy(ctxt);
+    if (v == PURC_VARIANT_INVALID) {
+        purc_clr_error();
+        return false;
+    }
+
+    /* the result of a CJSONEE may be a container, which stays unfolded */
+    make_literal(node, v);
+    purc_variant_unref(v);
+    return true;
+}
+
+static void
+fold_tree(struct pcvcm_node *tree)
+{
+    if (__atomic_load_n(&tree->is_folded, __ATOMIC_ACQUIRE) ||
+            fold_lock.native_impl == NULL)
+        return;
+
+    purc_mutex_lock(&fold_lock);
+    if (!tree->is_folded) {
+        fold_constants(tree);
+        __atomic_store_n(&tree->is_folded, true, __ATOMIC_RELEASE);
+    }
+    purc_mutex_unlock(&fold_lock);
+}
+
+static void
+fold_cleanup_once(void)
+{
+    if (fold_lock.native_impl) {
+        purc_mutex_clear(&fold_lock);
+        fold_lock.native_impl = NULL;
+    }
+}
+
+int
+pcvcm_eval_init_once(void)
+{
+    purc_mutex_init(&fold_lock);
+    if (fold_lock.native_impl == NULL)
+        return -1;
+
+    if (atexit(fold_cleanup_once)) {
+        fold_cleanup_once();
+        return -1;
+    }
+
+    return 0;
+}
+
 static int i = 0;
 purc_variant_t pcvcm_eval_full(struct pcvcm_node *tree,
         struct pcvcm_eval_ctxt **ctxt_out, purc_variant_t args,
@@ -731,6 +948,8 @@ purc_variant_t pcvcm_eval_full(struct pcvcm_node *tree,
         goto out;
     }
 
+    fold_tree(tree);
+
     ctxt = pcvcm_eval_ctxt_create();
     if (!ctxt) {
         goto out;
@@ -853,6 +1072,8 @@ purc_variant_t pcvcm_eval_sub_expr_full(struct pcvcm_node *tree,
         goto out;
     }
 
+    fold_tree(tree);
+
     struct pcvcm_eval_stack_frame *frame = push_frame(ctxt, tree, 0);
     if (!frame) {
         goto out;
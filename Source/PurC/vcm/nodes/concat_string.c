@@ -30,19 +30,18 @@
 #include "config.h"
 #include "purc-utils.h"
 #include "purc-errors.h"
-#include "purc-rwstream.h"
 
 #include "private/errors.h"
 #include "private/stack.h"
 #include "private/interpreter.h"
 #include "private/utils.h"
+#include "private/variant.h"
 #include "private/vcm.h"
 
 #include "../eval.h"
 #include "../ops.h"
 
 #define MIN_BUF_SIZE         32
-#define MAX_BUF_SIZE         SIZE_MAX
 
 static int
 after_pushed(struct pcvcm_eval_ctxt *ctxt,
@@ -58,51 +57,57 @@ eval(struct pcvcm_eval_ctxt *ctxt,
         struct pcvcm_eval_stack_frame *frame)
 {
     UNUSED_PARAM(ctxt);
-    UNUSED_PARAM(frame);
     purc_variant_t ret = PURC_VARIANT_INVALID;
-    purc_rwstream_t rws = purc_rwstream_new_buffer(MIN_BUF_SIZE, MAX_BUF_SIZE);
-    if (!rws) {
-        purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
-        goto out;
+
+    /* the only operand is already the result */
+    if (frame->nr_params == 1) {
+        purc_variant_t v = pcutils_array_get(frame->params_result, 0);
+        if (purc_variant_is_type(v, PURC_VARIANT_TYPE_STRING))
+            return purc_variant_ref(v);
     }
 
+    // FIXME: stringify or serialize
+    size_t total = 0;
     for (size_t i = 0; i < frame->nr_params; i++) {
         purc_variant_t v = pcutils_array_get(frame->params_result, i);
+        total += pcvariant_stringify_length(v);
+    }
 
-        // FIXME: stringify or serialize
-        char *buf = NULL;
-        int total = purc_variant_stringify_alloc(&buf, v);
-        if (total) {
-            purc_rwstream_write(rws, buf, total);
+    /* short results are built on the stack and stored in the variant */
+    char stack_buf[MIN_BUF_SIZE];
+    char *buf = stack_buf;
+    if (total >= sizeof(stack_buf)) {
+        buf = malloc(total + 1);
+        if (buf == NULL) {
+            purc_set_error(PURC_ERROR_OUT_OF_MEMORY);
+            goto out;
         }
-        free(buf);
     }
 
-    // do not forget tailing-null-terminator
-    purc_rwstream_write(rws, "", 1);
+    size_t len = 0;
+    for (size_t i = 0; i < frame->nr_params; i++) {
+        purc_variant_t v = pcutils_array_get(frame->params_result, i);
+        len += pcvariant_stringify_to_mem(buf + len, total - len, v);
+    }
+    buf[len] = '\0';
 
-    size_t rw_size = 0;
-    size_t content_size = 0;
-    char *rw_string = purc_rwstream_get_mem_buffer_ex(rws,
-            &content_size, &rw_size, true);
+    if (buf == stack_buf) {
+        ret = purc_variant_make_string_ex(buf, len, false);
+    }
+    else {
+        ret = purc_variant_make_string_reuse_buff(buf, total + 1, false);
+        if (ret == PURC_VARIANT_INVALID)
+            free(buf);
+    }
 
-    if (rw_size && rw_string) {
-        ret = purc_variant_make_string_reuse_buff(rw_string,
-                content_size, false);
-        if (ret == PURC_VARIANT_INVALID) {
-            pcinst_set_error(PURC_ERROR_INVALID_VALUE);
-            ret = PURC_VARIANT_INVALID;
-        }
+    if (ret == PURC_VARIANT_INVALID) {
+        pcinst_set_error(PURC_ERROR_INVALID_VALUE);
     }
 
 out:
-    if (rws) {
-        purc_rwstream_destroy(rws);
-    }
     return ret;
 }
 
-
 static struct pcvcm_eval_stack_frame_ops ops = {
     .after_pushed = after_pushed,
     .select_param = select_param_default,
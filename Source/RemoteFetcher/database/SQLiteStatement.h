@@ -49,6 +49,9 @@ public:
     PURCFETCHER_EXPORT int bindNull(int index);
     PURCFETCHER_EXPORT int bindValue(int index, const SQLValue&);
     PURCFETCHER_EXPORT unsigned bindParameterCount() const;
+    // The name of a parameter with the prefix (`:`, `@`, `$`, or `?`);
+    // the index is 1-based as the bind functions.
+    PURCFETCHER_EXPORT String bindParameterName(int index) const;
 
     PURCFETCHER_EXPORT int step();
     PURCFETCHER_EXPORT int finalize();
@@ -70,7 +70,11 @@
 #include "TextEncoding.h"
 #include <wtf/MainThread.h>
 #include <wtf/glib/RunLoopSourcePriority.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/NeverDestroyed.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include "SQLiteStatement.h"
 
@@ -78,7 +82,12 @@
 namespace PurCFetcher {
 using namespace PurCFetcher;
 
-#define  DEFAULT_READBUFFER_SIZE 8192
+// the rows are sent to the client in chunks of about this size
+#define  LSQL_CHUNK_SIZE            16384
+// the number of databases kept open across requests
+#define  LSQL_DATABASE_CACHE_SIZE   8
+// the number of prepared statements kept for each database
+#define  LSQL_STATEMENT_CACHE_SIZE  32
 
 extern const char* KEY_STATUS_CODE;
 extern const char* KEY_ERROR_MSG;
@@ -99,6 +108,111 @@ const char* INSERT = "insert";
 const char* UPDATE = "update";
 const char* DELETE = "delete";
 
+// An open database shared by the lsql requests, with an LRU cache of
+// the prepared statements; so the repeated queries skip planning.
+class LsqlDatabase : public RefCounted<LsqlDatabase> {
+public:
+    static RefPtr<LsqlDatabase> open(const String& path);
+
+    ~LsqlDatabase()
+    {
+        // finalize the statements before closing the database
+        m_statements.clear();
+        m_database.close();
+    }
+
+    SQLiteDatabase& database() { return m_database; }
+
+    // Returns a prepared statement which is reset, or nullptr on failure.
+    SQLiteStatement* statement(const String& sql);
+
+private:
+    LsqlDatabase() = default;
+
+    bool isSameFile(const struct stat& st) const
+    {
+        return st.st_dev == m_dev && st.st_ino == m_ino;
+    }
+
+    static HashMap<String, RefPtr<LsqlDatabase>>& databases()
+    {
+        static NeverDestroyed<HashMap<String, RefPtr<LsqlDatabase>>> map;
+        return map;
+    }
+
+    static ListHashSet<String>& databaseLRU()
+    {
+        static NeverDestroyed<ListHashSet<String>> lru;
+        return lru;
+    }
+
+    SQLiteDatabase m_database;
+    dev_t m_dev { 0 };
+    ino_t m_ino { 0 };
+
+    HashMap<String, std::unique_ptr<SQLiteStatement>> m_statements;
+    ListHashSet<String> m_statementLRU;
+};
+
+RefPtr<LsqlDatabase> LsqlDatabase::open(const String& path)
+{
+    struct stat st;
+    if (stat(path.utf8().data(), &st))
+        return nullptr;
+
+    auto& map = databases();
+    auto& lru = databaseLRU();
+
+    auto it = map.find(path);
+    if (it != map.end()) {
+        // the file may have been replaced since it was opened
+        if (it->value->isSameFile(st)) {
+            lru.appendOrMoveToLast(path);
+            return it->value;
+        }
+
+        map.remove(it);
+        lru.remove(path);
+    }
+
+    auto db = adoptRef(*new LsqlDatabase());
+    if (!db->m_database.open(path))
+        return nullptr;
+    db->m_database.disableThreadingChecks();
+    db->m_dev = st.st_dev;
+    db->m_ino = st.st_ino;
+
+    // a request still using an evicted database keeps it open till done
+    if (map.size() >= LSQL_DATABASE_CACHE_SIZE)
+        map.remove(lru.takeFirst());
+    map.add(path, db.copyRef());
+    lru.add(path);
+
+    return db;
+}
+
+SQLiteStatement* LsqlDatabase::statement(const String& sql)
+{
+    auto it = m_statements.find(sql);
+    if (it != m_statements.end()) {
+        m_statementLRU.appendOrMoveToLast(sql);
+        it->value->reset();
+        return it->value.get();
+    }
+
+    auto statement = makeUnique<SQLiteStatement>(m_database, sql);
+    if (statement->prepare() != SQLITE_OK)
+        return nullptr;
+
+    if (m_statements.size() >= LSQL_STATEMENT_CACHE_SIZE)
+        m_statements.remove(m_statementLRU.takeFirst());
+
+    SQLiteStatement* result = statement.get();
+    m_statements.add(sql, WTFMove(statement));
+    m_statementLRU.add(sql);
+    return result;
+}
+
 NetworkDataTaskLsql::NetworkDataTaskLsql(NetworkSession& session, NetworkDataTaskClient& client, const ResourceRequest& requestWithCredentials, StoredCredentialsPolicy storedCredentialsPolicy, ContentSniffingPolicy shouldContentSniff, PurCFetcher::ContentEncodingSniffingPolicy, bool shouldClearReferrerOnHTTPSToHTTPRedirect, bool dataTaskIsForMainFrameNavigation)
     : NetworkDataTask(session, client, requestWithCredentials, storedCredentialsPolicy, shouldClearReferrerOnHTTPSToHTTPRedirect, dataTaskIsForMainFrameNavigation)
     , m_formatArray(false)
@@ -170,20 +284,18 @@ void NetworkDataTaskLsql::dispatchDidCompleteWithError(const ResourceError& erro
     m_networkLoadMetrics.markComplete();
 
     m_client->didCompleteWithError(error, m_networkLoadMetrics);
-    if (m_database.isOpen())
-        m_database.close();
+    m_database = nullptr;
 }
 
 void NetworkDataTaskLsql::dispatchDidReceiveResponse()
 {
-    if (m_database.isOpen())
-        m_database.close();
     m_networkLoadMetrics.responseStart = MonotonicTime::now() - m_startTime;
     m_response.setURL(m_currentRequest.url());
     const char* contentType = "application/json";
     m_response.setMimeType(extractMIMETypeFromMediaType(contentType));
     m_response.setTextEncodingName(extractCharsetFromMediaType(contentType));
-    m_response.setExpectedContentLength(m_responseBuffer.size());
+    // the rows are streamed; the length is not known in advance
+    m_response.setExpectedContentLength(-1);
     m_response.setHTTPHeaderField(HTTPHeaderName::AccessControlAllowOrigin, "*");
     m_response.setHTTPHeaderField(HTTPHeaderName::Expires, "-1");
     m_response.setHTTPHeaderField(HTTPHeaderName::CacheControl, "no-cache");
@@ -194,13 +306,14 @@ void NetworkDataTaskLsql::dispatchDidReceiveResponse()
 
     didReceiveResponse(ResourceResponse(m_response), NegotiatedLegacyTLS::No, [this, protectedThis = makeRef(*this)](PolicyAction policyAction) {
         if (m_state == State::Canceling || m_state == State::Completed) {
+            m_database = nullptr;
             return;
         }
 
         switch (policyAction) {
         case PolicyAction::Use:
             {
-                m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
+                streamResponse();
                 dispatchDidCompleteWithError({ });
             }
             break;
@@ -208,6 +321,7 @@ void NetworkDataTaskLsql::dispatchDidReceiveResponse()
         case PolicyAction::Ignore:
         case PolicyAction::Download:
         case PolicyAction::StopAllLoads:
+            m_database = nullptr;
             break;
         }
     });
@@ -222,7 +336,7 @@ void NetworkDataTaskLsql::createRequest(PurCFetcher::ResourceRequest&& request)
 void NetworkDataTaskLsql::sendRequest()
 {
     runCmdInner();
-    buildResponse();
+    runCommands();
     dispatchDidReceiveResponse();
 }
 
@@ -252,91 +366,105 @@ void NetworkDataTaskLsql::runCmdInner()
         m_exitCode = 127;
         m_statusCode = 404;
         m_errorMsg = "Not Found";
+        m_sqlVec.clear();
         return;
     }
 
-    if (!m_database.open(path)) {
+    m_database = LsqlDatabase::open(path);
+    if (!m_database) {
 #if 0
         printf("Failed to open databasePath %s.", path.utf8().data());
 #endif
         m_exitCode = 127;
         m_statusCode = 404;
         m_errorMsg = "Failed to open database " + path + ".";
+        m_sqlVec.clear();
         return;
     }
-    m_database.disableThreadingChecks();
 
     m_statusCode = 200;
-#if 1
-    int size = m_sqlVec.size();
-    for (int i = 0; i < size; i++)
-    {
-        String& sql = m_sqlVec[i];
-        if (sql.startsWithIgnoringASCIICase(SELECT))
-        {
-            runSqlSelect(sql);
-        }
-        else if (sql.startsWithIgnoringASCIICase(INSERT))
-        {
-            runSqlInsert(sql);
-        }
-        else if (sql.startsWithIgnoringASCIICase(UPDATE))
-        {
-            runSqlUpdate(sql);
-        }
-        else if (sql.startsWithIgnoringASCIICase(DELETE))
-        {
-            runSqlDelete(sql);
-        }
-    }
-#endif
 
+    // keep the statements to run only; see runCommands()
+    m_sqlVec.removeAllMatching([](const String& sql) {
+        return sql.isEmpty() || !(sql.startsWithIgnoringASCIICase(SELECT)
+                || sql.startsWithIgnoringASCIICase(INSERT)
+                || sql.startsWithIgnoringASCIICase(UPDATE)
+                || sql.startsWithIgnoringASCIICase(DELETE));
+    });
 }
 
-void NetworkDataTaskLsql::runSqlSelect(String sql)
+SQLiteStatement* NetworkDataTaskLsql::cachedStatement(const String& sql)
 {
-    if (sql.isEmpty())
-        return;
+    SQLiteStatement* statement = m_database->statement(sql);
+    if (!statement)
+        return nullptr;
+
+    // bind the named parameters (`:name` or `@name`) with the query
+    // parameters; `$name` has been replaced in parseSqlQuery().
+    unsigned count = statement->bindParameterCount();
+    for (unsigned i = 1; i <= count; i++) {
+        String name = statement->bindParameterName(i);
+        if (name.length() < 2 || (name[0] != ':' && name[0] != '@'))
+            continue;
+
+        auto findResult = m_paramMap.find(name.substring(1));
+        if (findResult != m_paramMap.end())
+            statement->bindText(i, findResult->value);
+    }
 
+    return statement;
+}
+
+SqlResult NetworkDataTaskLsql::runSqlSelect(const String& sql)
+{
     SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK) {
+    sr.rowsAffected = 0;
+
+    SQLiteStatement* statement = cachedStatement(sql);
+    if (!statement) {
         sr.statusCode = 500;
         sr.errorMsg = "Failed to prepare : " + sql;
 #if 0
         printf("Failed to prepare statement.\n");
 #endif
-        m_sqlResults.append(sr);
-        return;
+        return sr;
     }
 
     sr.statusCode = 200;
+    m_sqlResultColumnNames.clear();
 
     int result;
-    while ((result = statement.step()) == SQLITE_ROW) {
-        int columnCount = statement.columnCount();
+    while ((result = statement->step()) == SQLITE_ROW) {
+        int columnCount = statement->columnCount();
         Vector<SQLValueH> columns;
+        columns.reserveInitialCapacity(columnCount);
         for (int i = 0; i < columnCount; i++)
         {
             if ((int)m_sqlResultColumnNames.size() <= i)
             {
-                String key = statement.getColumnName(i);
+                String key = statement->getColumnName(i);
                 m_sqlResultColumnNames.append(key);
             }
 
-            columns.append(statement.getColumnValueH(i));
+            columns.uncheckedAppend(statement->getColumnValueH(i));
         }
-        sr.rowsVec.append(columns);
+
+        if (sr.rowsAffected > 0)
+            appendToResponse(","_s);
+        if (m_formatArray)
+            appendToResponse(formatAsArray(columns)->toJSONString());
+        else
+            appendToResponse(formatAsDict(columns)->toJSONString());
+        sr.rowsAffected++;
 
         if (m_state == State::Canceling)
         {
             sr.statusCode = 503;
             sr.errorMsg = "Canceling";
-            m_sqlResults.append(sr);
-            return;
+            statement->reset();
+            return sr;
         }
     }
-    sr.rowsAffected = sr.rowsVec.size();
 
     if (result != SQLITE_DONE)
     {
@@ -346,87 +474,92 @@ void NetworkDataTaskLsql::runSqlSelect(String sql)
         printf("Failed to read in all origins from the database.\n");
 #endif
     }
-    m_sqlResults.append(sr);
+
+    // release the read lock held by the statement
+    statement->reset();
+    return sr;
 }
 
-void NetworkDataTaskLsql::runSqlInsert(String sql)
+SqlResult NetworkDataTaskLsql::runSqlCommand(const String& sql)
 {
-    if (sql.isEmpty())
-        return;
-
     SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK
-            || statement.step() != SQLITE_DONE) {
+    sr.rowsAffected = 0;
+
+    SQLiteStatement* statement = cachedStatement(sql);
+    if (!statement || statement->step() != SQLITE_DONE) {
         sr.statusCode = 500;
         sr.errorMsg = "Failed to prepare : " + sql;
 #if 0
         printf("Failed to prepare statement.\n");
 #endif
-        m_sqlResults.append(sr);
-        return;
+        if (statement)
+            statement->reset();
+        return sr;
     }
 
     sr.statusCode = 200;
-    sr.rowsAffected = m_database.lastChanges();
-    m_sqlResults.append(sr);
+    sr.rowsAffected = m_database->database().lastChanges();
+    statement->reset();
+    return sr;
 }
 
-void NetworkDataTaskLsql::runSqlUpdate(String sql)
+static String jsonString(const String& string)
 {
-    if (sql.isEmpty())
-        return;
+    if (string.isEmpty())
+        return "null"_s;
+    return JSON::Value::create(string)->toJSONString();
+}
 
-    SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK
-            || statement.step() != SQLITE_DONE) {
-        sr.statusCode = 500;
-        sr.errorMsg = "Failed to prepare : " + sql;
-#if 0
-        printf("Failed to prepare statement.\n");
-#endif
-        m_sqlResults.append(sr);
+void NetworkDataTaskLsql::appendToResponse(const String& string)
+{
+    CString utf8 = string.utf8();
+    m_responseBuffer.append(utf8.data(), utf8.length());
+    if (!m_holdResponse && m_responseBuffer.size() >= LSQL_CHUNK_SIZE)
+        flushResponse();
+}
+
+void NetworkDataTaskLsql::flushResponse()
+{
+    if (m_responseBuffer.isEmpty())
         return;
-    }
 
-    sr.statusCode = 200;
-    sr.rowsAffected = m_database.lastChanges();
-    m_sqlResults.append(sr);
+    m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
+    m_responseBuffer = Vector<char>();
+    m_responseBuffer.reserveInitialCapacity(LSQL_CHUNK_SIZE);
 }
 
-void NetworkDataTaskLsql::runSqlDelete(String sql)
+// Streams the rows of a statement as the `rows` member, then the members
+// of the result; for a single statement, the result is the response.
+void NetworkDataTaskLsql::streamRows(const String& sql, bool single)
 {
-    if (sql.isEmpty())
-        return;
+    appendToResponse(makeString("{\"", KEY_ROWS, "\":["));
 
     SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK
-            || statement.step() != SQLITE_DONE) {
-        sr.statusCode = 500;
-        sr.errorMsg = "Failed to prepare : " + sql;
-#if 0
-        printf("Failed to prepare statement.\n");
-#endif
-        m_sqlResults.append(sr);
-        return;
-    }
-
-    sr.statusCode = 200;
-    sr.rowsAffected = m_database.lastChanges();
-    m_sqlResults.append(sr);
+    if (sql.startsWithIgnoringASCIICase(SELECT))
+        sr = runSqlSelect(sql);
+    else
+        sr = runSqlCommand(sql);
+
+    appendToResponse("],"_s);
+    if (single)
+        appendToResponse(makeString("\"", KEY_STATUS_CODE, "\":", sr.statusCode, ","));
+    appendToResponse(makeString("\"", KEY_ERROR_MSG, "\":", jsonString(sr.errorMsg),
+                ",\"", KEY_ROWSAFFECTED, "\":", sr.rowsAffected, "}"));
 }
 
-void NetworkDataTaskLsql::buildResponse()
+// Runs the statements till the last one changing the database, whatever
+// the response policy turns out to be; their output is held till the
+// response is used. The SELECT statements after them are run when streaming.
+void NetworkDataTaskLsql::runCommands()
 {
-    auto result = JSON::Object::create();
+    m_responseBuffer.reserveInitialCapacity(LSQL_CHUNK_SIZE);
 
-    int resultSize = m_sqlResults.size();
+    int resultSize = m_sqlVec.size();
     switch (resultSize)
     {
     case 0:
         {
+            auto result = JSON::Object::create();
             result->setInteger(KEY_STATUS_CODE, m_statusCode);
 
             if (m_errorMsg.isEmpty())
@@ -437,76 +570,48 @@ void NetworkDataTaskLsql::buildResponse()
             result->setInteger(KEY_ROWSAFFECTED, m_readLines.size());
             auto array = JSON::Array::create();
             result->setArray(KEY_ROWS, WTFMove(array));
+            appendToResponse(result->toJSONString());
         }
-        break;
+        return;
 
     case 1:
-        {
-            SqlResult& sqlResult = m_sqlResults[0];
-            result->setInteger(KEY_STATUS_CODE, sqlResult.statusCode);
-            if (sqlResult.errorMsg.isEmpty())
-                result->setValue(KEY_ERROR_MSG, JSON::Value::null());
-            else
-                result->setString(KEY_ERROR_MSG, sqlResult.errorMsg);
-            result->setInteger(KEY_ROWSAFFECTED, sqlResult.rowsAffected);
-
-            int rowSize = sqlResult.rowsVec.size();
-            auto array = JSON::Array::create();
-            for (int i = 0; i < rowSize; i++)
-            {
-                if (m_formatArray)
-                {
-                    array->pushValue(formatAsArray(sqlResult.rowsVec[i]));
-                }
-                else
-                {
-                    array->pushValue(formatAsDict(sqlResult.rowsVec[i]));
-                }
-            }
-            result->setArray(KEY_ROWS, WTFMove(array));
-        }
         break;
 
     default:
-        {
-            result->setInteger(KEY_STATUS_CODE, 200);
-            auto resultArray = JSON::Array::create();
-            for (int j = 0; j < resultSize; j++)
-            {
-                SqlResult& sqlResult = m_sqlResults[j];
-                auto res = JSON::Object::create();
+        appendToResponse(makeString("{\"", KEY_STATUS_CODE, "\":200,\"",
+                    KEY_RESULT, "\":["));
+        break;
+    }
 
-                if (sqlResult.errorMsg.isEmpty())
-                    res->setValue(KEY_ERROR_MSG, JSON::Value::null());
-                else
-                    res->setString(KEY_ERROR_MSG, sqlResult.errorMsg);
-                res->setInteger(KEY_ROWSAFFECTED, sqlResult.rowsAffected);
+    size_t end = 0;
+    for (size_t i = 0; i < m_sqlVec.size(); i++) {
+        if (!m_sqlVec[i].startsWithIgnoringASCIICase(SELECT))
+            end = i + 1;
+    }
 
-                int rowSize = sqlResult.rowsVec.size();
-                auto array = JSON::Array::create();
-                for (int i = 0; i < rowSize; i++)
-                {
-                    if (m_formatArray)
-                    {
-                        array->pushValue(formatAsArray(sqlResult.rowsVec[i]));
-                    }
-                    else
-                    {
-                        array->pushValue(formatAsDict(sqlResult.rowsVec[i]));
-                    }
-                }
-                res->setArray(KEY_ROWS, WTFMove(array));
-                resultArray->pushObject(WTFMove(res));
-            }
-            result->setArray(KEY_RESULT, WTFMove(resultArray));
-        }
-        break;
+    m_holdResponse = true;
+    runStatements(end);
+    m_holdResponse = false;
+}
+
+void NetworkDataTaskLsql::runStatements(size_t end)
+{
+    bool single = m_sqlVec.size() == 1;
+    for (; m_nextStatement < end; m_nextStatement++) {
+        if (m_nextStatement > 0)
+            appendToResponse(","_s);
+        streamRows(m_sqlVec[m_nextStatement], single);
     }
+}
 
-    String json = result->toJSONString();
+void NetworkDataTaskLsql::streamResponse()
+{
+    runStatements(m_sqlVec.size());
+    if (m_sqlVec.size() > 1)
+        appendToResponse("]}"_s);
 
-    m_responseBuffer.clear();
-    m_responseBuffer.append(json.characters8(), json.length());
+    flushResponse();
+    m_database = nullptr;
 }
 
 Ref<JSON::Value> NetworkDataTaskLsql::formatAsArray(Vector<SQLValueH>& lineColumns)
@@ -69,9 +69,11 @@ public:
     int statusCode;
     String errorMsg;
     int rowsAffected;
-    Vector<Vector<SQLValueH>> rowsVec;
 };
 
+class SQLiteStatement;
+class LsqlDatabase;
+
 class NetworkDataTaskLsql final : public NetworkDataTask {
 public:
     static Ref<NetworkDataTask> create(NetworkSession& session, NetworkDataTaskClient& client, const PurCFetcher::ResourceRequest& request, PurCFetcher::StoredCredentialsPolicy storedCredentialsPolicy, PurCFetcher::ContentSniffingPolicy shouldContentSniff, PurCFetcher::ContentEncodingSniffingPolicy shouldContentEncodingSniff, bool shouldClearReferrerOnHTTPSToHTTPRedirect, bool dataTaskIsForMainFrameNavigation)
@@ -99,12 +101,16 @@ private:
 
     void runCmdInner();
 
-    void runSqlSelect(String sql);
-    void runSqlInsert(String sql);
-    void runSqlUpdate(String sql);
-    void runSqlDelete(String sql);
+    SqlResult runSqlSelect(const String& sql);
+    SqlResult runSqlCommand(const String& sql);
+    SQLiteStatement* cachedStatement(const String& sql);
 
-    void buildResponse();
+    void runCommands();
+    void runStatements(size_t end);
+    void streamResponse();
+    void streamRows(const String& sql, bool single);
+    void appendToResponse(const String&);
+    void flushResponse();
 
     void parseQueryString(String query);
     void parseSqlQuery(String sqlQuery);
@@ -118,7 +124,6 @@ private:
 
     MonotonicTime m_startTime;
     PurCFetcher::NetworkLoadMetrics m_networkLoadMetrics;
-    Vector<char> m_readBuffer;
     Vector<char> m_responseBuffer;
     Vector<String> m_readLines;
 
@@ -128,13 +133,14 @@ private:
 
     HashMap<String, String> m_paramMap;
 
-    PurCFetcher::SQLiteDatabase m_database;
+    RefPtr<LsqlDatabase> m_database;
     Vector<String> m_sqlVec;
     Vector<String> m_sqlResultColumnNames;
-    Vector<SqlResult> m_sqlResults;
 
     bool m_formatArray;
     String m_sqlQuery;
+    size_t m_nextStatement { 0 };
+    bool m_holdResponse { false };
 };
 
 } // namespace PurCFetcher
@@ -42,6 +42,7 @@
 #include "NetworkSession.h"
 #include "ResourceLoadInfo.h"
 #include "SharedBufferDataReference.h"
+#include "SharedMemory.h"
 #include "WebCoreArgumentCoders.h"
 #include "WebErrors.h"
 //#include "WebPageMessages.h"
@@ -142,6 +143,11 @@ static int send_json_file(unsigned char * buffer, int length)
     return length_write;
 }
 
+// The bodies expected to be at least this large are written into one shared
+// memory region as they arrive, instead of being copied into the messages
+// chunk by chunk.
+static const size_t sharedMemoryBodyThreshold = 256 * 1024;
+
 struct NetworkResourceLoader::SynchronousLoadData {
     WTF_MAKE_STRUCT_FAST_ALLOCATED;
 
@@ -722,6 +728,11 @@ void NetworkResourceLoader::didReceiveResponse(ResourceResponse&& receivedRespon
     if (m_parameters.pageHasResourceLoadClient)
         m_connection->networkProcess().parentProcessConnection()->send(Messages::NetworkProcessProxy::ResourceLoadDidReceiveResponse(m_parameters.webPageProxyID, resourceLoadInfo(), response), 0);
 
+    // Write a large body into a shared memory region sized from Content-Length.
+    if (!isSynchronous() && !m_parameters.request.getJsonType() && !m_response.isMultipart()
+            && m_response.expectedContentLength() >= static_cast<long long>(sharedMemoryBodyThreshold))
+        startSharedMemoryBody(m_response.expectedContentLength());
+
     if (willWaitForContinueDidReceiveResponse) {
         m_responseCompletionHandler = WTFMove(completionHandler);
         return;
@@ -760,6 +771,14 @@ void NetworkResourceLoader::didReceiveBuffer(Ref<SharedBuffer>&& buffer, int rep
     // FIXME: At least on OS X Yosemite we always get -1 from the resource handle.
     unsigned encodedDataLength = reportedEncodedDataLength >= 0 ? reportedEncodedDataLength : buffer->size();
 
+    if (m_sharedBody) {
+        if (writeBufferToSharedMemory(buffer, encodedDataLength))
+            return;
+        // The body overran its Content-Length; the client copies what it got
+        // in the region and goes on with the messages.
+        m_sharedBody = nullptr;
+    }
+
     if (m_bufferedData) {
         m_bufferedData->append(buffer.get());
         m_bufferedDataEncodedDataLength += encodedDataLength;
@@ -796,6 +815,7 @@ void NetworkResourceLoader::didFinishLoading(const NetworkLoadMetrics& networkLo
     if (isSynchronous())
         sendReplyToSynchronousRequest(*m_synchronousLoadData, m_bufferedData.get());
     else {
+        m_sharedBody = nullptr;
         if (m_bufferedData && !m_bufferedData->isEmpty()) {
             // FIXME: Pass a real value or remove the encoded data size feature.
             sendBuffer(*m_bufferedData, -1);
@@ -1143,8 +1163,9 @@ void NetworkResourceLoader::sendBuffer(SharedBuffer& buffer, size_t encodedDataL
     printf("+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ NetworkResourceLoader::sendBuffer.\n");
 #endif
 
-    if(!m_parameters.request.getJsonType())
+    if(!m_parameters.request.getJsonType()) {
         send(Messages::WebResourceLoader::DidReceiveSharedBuffer({ buffer }, encodedDataLength));
+    }
     else
     {
         if(m_httpresponsecode == 200)
@@ -1154,6 +1175,47 @@ void NetworkResourceLoader::sendBuffer(SharedBuffer& buffer, size_t encodedDataL
     }
 }
 
+void NetworkResourceLoader::startSharedMemoryBody(size_t expectedLength)
+{
+    // One more byte for the terminating null byte, so the client can use
+    // the mapped body as a C string as it does with its memory buffers.
+    auto sharedMemory = SharedMemory::allocate(expectedLength + 1);
+    if (!sharedMemory) {
+        RELEASE_LOG_ERROR_IF_ALLOWED("startSharedMemoryBody: Failed to allocate shared memory (size=%zu)", expectedLength);
+        return;
+    }
+
+    SharedMemory::Handle handle;
+    if (!sharedMemory->createHandle(handle, SharedMemory::Protection::ReadOnly)) {
+        RELEASE_LOG_ERROR_IF_ALLOWED("startSharedMemoryBody: Failed to create the handle of shared memory");
+        return;
+    }
+
+    send(Messages::WebResourceLoader::DidReceiveSharedMemory(handle, expectedLength, 0));
+    m_sharedBody = WTFMove(sharedMemory);
+    m_sharedBodyCapacity = expectedLength;
+    m_sharedBodySize = 0;
+}
+
+bool NetworkResourceLoader::writeBufferToSharedMemory(const SharedBuffer& buffer, size_t encodedDataLength)
+{
+    ASSERT(m_sharedBody);
+    if (buffer.size() > m_sharedBodyCapacity - m_sharedBodySize)
+        return false;
+
+    char* const sharedMemoryPtr = static_cast<char*>(m_sharedBody->data()) + m_sharedBodySize;
+    size_t position = 0;
+    while (buffer.size() > position) {
+        auto data = buffer.getSomeData(position);
+        memcpy(sharedMemoryPtr + position, data.data(), data.size());
+        position += data.size();
+    }
+    m_sharedBodySize += position;
+
+    send(Messages::WebResourceLoader::DidWriteSharedMemory(position, encodedDataLength));
+    return true;
+}
+
 void NetworkResourceLoader::tryStoreAsCacheEntry()
 {
 #ifdef gengyue
@@ -54,6 +54,7 @@ class NetworkConnectionToWebProcess;
 class NetworkLoad;
 class NetworkLoadChecker;
 class ServiceWorkerFetchTask;
+class SharedMemory;
 class WebSWServerConnection;
 
 enum class NegotiatedLegacyTLS : bool;
@@ -183,6 +184,8 @@ private:
     void startBufferingTimerIfNeeded();
     void bufferingTimerFired();
     void sendBuffer(PurCFetcher::SharedBuffer&, size_t encodedDataLength);
+    void startSharedMemoryBody(size_t expectedLength);
+    bool writeBufferToSharedMemory(const PurCFetcher::SharedBuffer&, size_t encodedDataLength);
 
     void consumeSandboxExtensions();
     void invalidateSandboxExtensions();
@@ -217,6 +220,9 @@ private:
 
     size_t m_bufferedDataEncodedDataLength { 0 };
     RefPtr<PurCFetcher::SharedBuffer> m_bufferedData;
+    RefPtr<PurCFetcher::SharedMemory> m_sharedBody;
+    size_t m_sharedBodyCapacity { 0 };
+    size_t m_sharedBodySize { 0 };
     unsigned m_redirectCount { 0 };
 
     std::unique_ptr<SynchronousLoadData> m_synchronousLoadData;
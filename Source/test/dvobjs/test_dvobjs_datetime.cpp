@@ -20,6 +20,7 @@
 #include "purc/purc.h"
 
 #include "private/variant.h"
+#include "private/dvobjs.h"
 #include "../helpers.h"
 
 #include <stdio.h>
@@ -817,3 +818,98 @@ TEST(dvobjs, broken_down_time)
     purc_cleanup();
 }
 
+
+struct tz_localtime_case {
+    const char *timezone;
+    time_t      t;
+    int         hour;
+    int         isdst;
+    long        gmtoff;
+};
+
+struct tz_mktime_case {
+    const char *timezone;
+    int         year, mon, mday, hour, min;
+    int         isdst_hint;
+    time_t      expected;
+};
+
+TEST(dvobjs, tzinfo)
+{
+    static const struct tz_localtime_case lt_cases[] = {
+        /* past the last transition: the rule in the footer applies */
+        { "America/New_York", 4102444800, 19, 0, -18000 },  // 2100-01-01
+        { "America/New_York", 4118083200, 20, 1, -14400 },  // 2100-07-01
+        /* the southern hemisphere: DST across the new year */
+        { "Australia/Sydney", 1705276800, 11, 1, 39600 },   // 2024-01-15
+        { "Australia/Sydney", 1720483200, 10, 0, 36000 },   // 2024-07-09
+        { "Australia/Sydney", 4102444800, 11, 1, 39600 },   // 2100-01-01
+        { "Australia/Sydney", 4118083200, 10, 0, 36000 },   // 2100-07-01
+        { "America/Santiago", 4102444800, 21, 1, -10800 },  // 2100-01-01
+        { "America/Santiago", 4118083200, 20, 0, -14400 },  // 2100-07-01
+    };
+
+    static const struct tz_mktime_case mk_cases[] = {
+        /* 01:30 happens twice */
+        { "America/New_York", 2024, 11, 3, 1, 30, -1, 1730611800 },
+        { "America/New_York", 2024, 11, 3, 1, 30,  0, 1730615400 },
+        { "America/New_York", 2024, 11, 3, 1, 30,  1, 1730611800 },
+        /* 02:30 is skipped */
+        { "America/New_York", 2024, 3, 10, 2, 30, -1, 1710055800 },
+        { "America/New_York", 2024, 3, 10, 2, 30,  0, 1710055800 },
+        { "America/New_York", 2024, 3, 10, 2, 30,  1, 1710052200 },
+        /* the same in the footer rule */
+        { "America/New_York", 2099, 11, 1, 1, 30, -1, 4097194200 },
+        { "America/New_York", 2099, 11, 1, 1, 30,  0, 4097197800 },
+        { "America/New_York", 2099, 11, 1, 1, 30,  1, 4097194200 },
+        { "America/New_York", 2099, 3, 8, 2, 30, -1, 4076638200 },
+        { "America/New_York", 2099, 3, 8, 2, 30,  0, 4076638200 },
+        { "America/New_York", 2099, 3, 8, 2, 30,  1, 4076634600 },
+        /* the same in the southern hemisphere */
+        { "Australia/Sydney", 2024, 4, 7, 2, 30, -1, 1712421000 },
+        { "Australia/Sydney", 2024, 4, 7, 2, 30,  0, 1712421000 },
+        { "Australia/Sydney", 2024, 4, 7, 2, 30,  1, 1712417400 },
+        { "Australia/Sydney", 2024, 10, 6, 2, 30, -1, 1728145800 },
+        { "Australia/Sydney", 2024, 10, 6, 2, 30,  0, 1728145800 },
+        { "Australia/Sydney", 2024, 10, 6, 2, 30,  1, 1728142200 },
+    };
+
+    int ret = purc_init_ex(PURC_MODULE_EJSON, "cn.fmsfot.hvml.test",
+            "dvobjs", NULL);
+    ASSERT_EQ (ret, PURC_ERROR_OK);
+
+    for (size_t i = 0; i < PCA_TABLESIZE(lt_cases); i++) {
+        const struct pcdvobjs_tzinfo *tzi;
+        tzi = pcdvobjs_get_tzinfo(lt_cases[i].timezone);
+        ASSERT_NE(tzi, nullptr);
+
+        struct tm tm;
+        pcdvobjs_tzinfo_localtime(tzi, lt_cases[i].t, &tm);
+        ASSERT_EQ(tm.tm_hour, lt_cases[i].hour) << "case " << i;
+        ASSERT_EQ(tm.tm_isdst, lt_cases[i].isdst) << "case " << i;
+        ASSERT_EQ(tm.tm_gmtoff, lt_cases[i].gmtoff) << "case " << i;
+    }
+
+    for (size_t i = 0; i < PCA_TABLESIZE(mk_cases); i++) {
+        const struct pcdvobjs_tzinfo *tzi;
+        tzi = pcdvobjs_get_tzinfo(mk_cases[i].timezone);
+        ASSERT_NE(tzi, nullptr);
+
+        struct tm tm = { };
+        tm.tm_year = mk_cases[i].year - 1900;
+        tm.tm_mon = mk_cases[i].mon - 1;
+        tm.tm_mday = mk_cases[i].mday;
+        tm.tm_hour = mk_cases[i].hour;
+        tm.tm_min = mk_cases[i].min;
+        tm.tm_isdst = mk_cases[i].isdst_hint;
+        ASSERT_EQ(pcdvobjs_tzinfo_mktime(tzi, &tm), mk_cases[i].expected)
+            << "case " << i;
+    }
+
+    /* a failed load is cached and keeps failing */
+    ASSERT_EQ(pcdvobjs_get_tzinfo("Nowhere/No_Such_Zone"), nullptr);
+    ASSERT_EQ(pcdvobjs_get_tzinfo("Nowhere/No_Such_Zone"), nullptr);
+    ASSERT_EQ(pcdvobjs_get_tzinfo("../etc/passwd"), nullptr);
+
+    purc_cleanup();
+}
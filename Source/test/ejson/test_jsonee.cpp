@@ -211,6 +211,46 @@ TEST_P(ejson_parser_vcm_eval, parse_and_serialize)
     pcejson_destroy(parser);
 }
 
+TEST_P(ejson_parser_vcm_eval, parse_in_chunks)
+{
+    const char* json = get_json();
+    const char* comp = get_comp();
+    int error_code = get_error();
+
+    struct pcejson* parser = pcejson_parse_chunk_begin(32);
+    ASSERT_NE (parser, nullptr) << "Test Case : "<< get_name();
+
+    purc_clr_error();
+
+    // small chunks to split the UTF-8 characters and the tokens
+    size_t sz = strlen (json);
+    for (size_t i = 0; i < sz; i += 3) {
+        size_t n = (sz - i) < 3 ? (sz - i) : 3;
+        if (pcejson_parse_chunk(parser, json + i, n))
+            break;
+    }
+
+    struct pcvcm_node* root = NULL;
+    pcejson_parse_chunk_end(parser, &root);
+    int error = purc_get_last_error();
+    ASSERT_EQ (error, error_code) << "Test Case : "<< get_name();
+
+    if (error_code != PCEJSON_SUCCESS) {
+        ASSERT_EQ (root, nullptr) << "Test Case : "<< get_name();
+    }
+    else {
+        ASSERT_NE (root, nullptr) << "Test Case : "<< get_name();
+
+        size_t nr_buf = 0;
+        char* buf = pcvcm_node_to_string(root, &nr_buf);
+        ASSERT_STREQ(buf, comp) << "Test Case : "<< get_name();
+        free(buf);
+    }
+
+    pcvcm_node_destroy (root);
+    pcejson_destroy(parser);
+}
+
 char* read_file (const char* file)
 {
     FILE* fp = fopen (file, "r");
@@ -110,3 +110,49 @@ TEST(exe_char, files)
     ASSERT_TRUE(ok);
 }
 
+
+TEST(exe_char, rule_cache)
+{
+    purc_instance_extra_info info = {};
+    int r = purc_init_ex(PURC_MODULE_HVML, "cn.fmsoft.hvml.test",
+            "exe_char", &info);
+    ASSERT_EQ(r, PURC_ERROR_OK);
+
+    purc_exec_ops_t ops;
+    ASSERT_TRUE(purc_get_executor("CHAR", &ops));
+
+    const char *rule = "CHAR: FROM 1 TO 3";
+    purc_variant_t input = purc_variant_make_string("hello", false);
+    ASSERT_NE(input, PURC_VARIANT_INVALID);
+
+    // the parsed rule is shared by the instances running the same rule
+    purc_exec_inst_t inst1, inst2;
+    inst1 = ops->create(PURC_EXEC_TYPE_CHOOSE, input, true);
+    inst2 = ops->create(PURC_EXEC_TYPE_CHOOSE, input, true);
+    ASSERT_NE(inst1, nullptr);
+    ASSERT_NE(inst2, nullptr);
+
+    purc_variant_t v1 = ops->choose(inst1, rule);
+    purc_variant_t v2 = ops->choose(inst2, rule);
+    ASSERT_NE(v1, PURC_VARIANT_INVALID);
+    ASSERT_NE(v2, PURC_VARIANT_INVALID);
+    EXPECT_TRUE(purc_variant_is_equal_to(v1, v2));
+    purc_variant_unref(v2);
+
+    // a bad rule fails without dropping the rule parsed before
+    v2 = ops->choose(inst2, "CHAR: FROM");
+    EXPECT_EQ(v2, PURC_VARIANT_INVALID);
+    ops->destroy(inst2);
+
+    // the first instance outlives the second one
+    v2 = ops->choose(inst1, rule);
+    ASSERT_NE(v2, PURC_VARIANT_INVALID);
+    EXPECT_TRUE(purc_variant_is_equal_to(v1, v2));
+    purc_variant_unref(v2);
+    ops->destroy(inst1);
+
+    purc_variant_unref(v1);
+    purc_variant_unref(input);
+
+    ASSERT_TRUE(purc_cleanup());
+}
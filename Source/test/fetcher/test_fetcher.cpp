@@ -24,6 +24,7 @@
 #include "purc/purc-runloop.h"
 
 #include "../helpers.h"
+#include "fetchers/fetcher-internal.h"
 
 #include <gtest/gtest.h>
 #include <wtf/RunLoop.h>
@@ -38,6 +39,14 @@
 
 #include <gio/gio.h>
 
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if ENABLE(LSQL)
+#include <sqlite3.h>
+#endif
+
 TEST(fetcher, cleanup)
 {
     do {
@@ -170,6 +179,165 @@ TEST(fetcher, Instance)
     PurCInstance purc("cn.fmsoft.hybridos.sample", "pcfetcher");
 }
 
+/* plays the fetcher: creates a region holding @capacity bytes of content
+   and the terminating null byte, as DidReceiveSharedMemory hands over */
+static int create_shared_region(size_t capacity)
+{
+    char path[] = "/tmp/pcfetcher-shared-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd >= 0) {
+        unlink(path);
+        if (ftruncate(fd, capacity + 1)) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    return fd;
+}
+
+/* plays the fetcher: appends @data to the region, as DidWriteSharedMemory
+   tells */
+static void write_shared_region(int fd, struct pcfetcher_shared_body *body,
+        const char *data)
+{
+    size_t len = strlen(data);
+    ASSERT_EQ(pwrite(fd, data, len, body->size), (ssize_t)len);
+
+    const char *got = pcfetcher_shared_body_advance(body, len);
+    ASSERT_NE(got, nullptr);
+    /* the client sees the bytes as they arrive, for the chunk handler */
+    ASSERT_EQ(memcmp(got, data, len), 0);
+}
+
+TEST(fetcher, shared_memory_body)
+{
+    PurCInstance purc("cn.fmsoft.hybridos.sample", "pcfetcher");
+
+    struct pcfetcher_shared_body body;
+    pcfetcher_shared_body_init(&body);
+    ASSERT_FALSE(pcfetcher_shared_body_attached(&body));
+
+    /* the body arrives in pieces and the client takes it at finish */
+    int fd = create_shared_region(16);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(pcfetcher_shared_body_attach(&body, dup(fd), 16), 0);
+    ASSERT_TRUE(pcfetcher_shared_body_attached(&body));
+
+    write_shared_region(fd, &body, "hello, ");
+    write_shared_region(fd, &body, "world");
+    ASSERT_EQ(body.size, 12U);
+
+    purc_rwstream_t rws = pcfetcher_shared_body_take(&body);
+    ASSERT_NE(rws, nullptr);
+    ASSERT_FALSE(pcfetcher_shared_body_attached(&body));
+
+    size_t sz_content = 0;
+    const char *content = (const char *)purc_rwstream_get_mem_buffer(rws,
+            &sz_content);
+    ASSERT_EQ(sz_content, 12U);
+    ASSERT_STREQ(content, "hello, world");
+    purc_rwstream_destroy(rws);
+    close(fd);
+
+    /* the body overruns its Content-Length; the client copies what it got
+       and goes on with the messages */
+    fd = create_shared_region(8);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(pcfetcher_shared_body_attach(&body, dup(fd), 8), 0);
+
+    write_shared_region(fd, &body, "hello");
+    ASSERT_EQ(pcfetcher_shared_body_advance(&body, 6), nullptr);
+    ASSERT_EQ(body.size, 5U);
+
+    rws = pcfetcher_shared_body_copy(&body);
+    ASSERT_NE(rws, nullptr);
+    ASSERT_FALSE(pcfetcher_shared_body_attached(&body));
+    ASSERT_EQ(purc_rwstream_write(rws, ", world", 7), 7);
+
+    content = (const char *)purc_rwstream_get_mem_buffer(rws, &sz_content);
+    ASSERT_EQ(sz_content, 12U);
+    ASSERT_EQ(memcmp(content, "hello, world", 12), 0);
+    purc_rwstream_destroy(rws);
+    close(fd);
+
+    /* a failed load drops the region */
+    fd = create_shared_region(8);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(pcfetcher_shared_body_attach(&body, dup(fd), 8), 0);
+    pcfetcher_shared_body_detach(&body);
+    ASSERT_FALSE(pcfetcher_shared_body_attached(&body));
+    ASSERT_EQ(pcfetcher_shared_body_advance(&body, 1), nullptr);
+    close(fd);
+}
+
+#if ENABLE(LSQL)                /* { */
+#define LSQL_TEST_DB        "/tmp/purc-test-lsql-write.db"
+
+static int lsql_count_rows(void)
+{
+    sqlite3 *db;
+    sqlite3_stmt *stmt;
+    int nr = -1;
+
+    if (sqlite3_open(LSQL_TEST_DB, &db) != SQLITE_OK)
+        return -1;
+    if (sqlite3_prepare_v2(db, "SELECT count(*) FROM t", -1, &stmt,
+                NULL) == SQLITE_OK) {
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+            nr = sqlite3_column_int(stmt, 0);
+        sqlite3_finalize(stmt);
+    }
+    sqlite3_close(db);
+    return nr;
+}
+
+static void lsql_response_handler(purc_variant_t request_id, void* ctxt,
+        const struct pcfetcher_resp_header *resp_header,
+        purc_rwstream_t resp)
+{
+    UNUSED_PARAM(request_id);
+    UNUSED_PARAM(resp_header);
+    *(bool *)ctxt = true;
+    if (resp)
+        purc_rwstream_destroy(resp);
+}
+
+/* the writes of an lsql fetch land even if its response is not used */
+TEST(fetcher, lsql_write_ignored)
+{
+    sqlite3 *db;
+    unlink(LSQL_TEST_DB);
+    ASSERT_EQ(sqlite3_open(LSQL_TEST_DB, &db), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(db, "CREATE TABLE t (x INTEGER)", NULL, NULL,
+                NULL), SQLITE_OK);
+    sqlite3_close(db);
+
+    PurCInstance purc(true);
+    ASSERT_TRUE(purc);
+
+    bool handled = false;
+    purc_variant_t request = pcfetcher_request_async(
+            "lsql://" LSQL_TEST_DB "?sqlquery=INSERT%20INTO%20t%20VALUES%20(1)",
+            PCFETCHER_REQUEST_METHOD_GET, NULL, 10,
+            lsql_response_handler, &handled, NULL, NULL);
+    ASSERT_NE(request, PURC_VARIANT_INVALID);
+
+    /* nobody reads the response */
+    pcfetcher_cancel_async(request);
+
+    int nr = 0;
+    for (int i = 0; i < 100 && nr != 1; i++) {
+        pcfetcher_check_response(50);
+        nr = lsql_count_rows();
+    }
+    ASSERT_EQ(nr, 1);
+    ASSERT_TRUE(handled);
+
+    purc_variant_unref(request);
+    unlink(LSQL_TEST_DB);
+}
+#endif                          /* } */
+
 #if 0                        /* { */
 TEST(fetcher, init_cleanup)
 {
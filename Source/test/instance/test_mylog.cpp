@@ -21,6 +21,10 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
 #include <gtest/gtest.h>
 
 #define ATOM_BITS_NR        (sizeof(purc_atom_t) << 3)
@@ -62,3 +66,99 @@ TEST(instance, mylog)
     purc_cleanup();
 }
 
+
+#define NR_LOG_THREADS      8
+#define NR_LOG_RECORDS      2000
+
+static void* log_thread_entry(void* arg)
+{
+    int nr = (int)(intptr_t)arg;
+    char runner_name[32];
+
+    sprintf(runner_name, "log%d", nr);
+    int ret = purc_init_ex(PURC_MODULE_VARIANT, "cn.fmsoft.hvml.purc",
+            runner_name, NULL);
+    if (ret != PURC_ERROR_OK)
+        return NULL;
+
+    purc_enable_log(true, false);
+    for (int i = 0; i < NR_LOG_RECORDS; i++) {
+        purc_log_info("record %d\n", i);
+    }
+
+    /* the pending records must be written out by purc_cleanup() */
+    purc_cleanup();
+    return NULL;
+}
+
+/* several instances logging to files through the writer thread at once */
+TEST(instance, mylog_threads)
+{
+    pthread_t threads[NR_LOG_THREADS];
+    char path[PATH_MAX + 1];
+
+    for (int i = 0; i < NR_LOG_THREADS; i++) {
+        char runner_name[32];
+        sprintf(runner_name, "log%d", i);
+        snprintf(path, sizeof(path), PURC_LOG_FILE_PATH_FORMAT,
+                "cn.fmsoft.hvml.purc", runner_name);
+        unlink(path);
+    }
+
+    for (int i = 0; i < NR_LOG_THREADS; i++) {
+        ASSERT_EQ(pthread_create(&threads[i], NULL, log_thread_entry,
+                    (void *)(intptr_t)i), 0);
+    }
+
+    for (int i = 0; i < NR_LOG_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (int i = 0; i < NR_LOG_THREADS; i++) {
+        char runner_name[32];
+        sprintf(runner_name, "log%d", i);
+        snprintf(path, sizeof(path), PURC_LOG_FILE_PATH_FORMAT,
+                "cn.fmsoft.hvml.purc", runner_name);
+
+        char endpoint[PURC_LEN_ENDPOINT_NAME + 1];
+        purc_assemble_endpoint_name(PCRDR_LOCALHOST, "cn.fmsoft.hvml.purc",
+                runner_name, endpoint);
+
+        FILE *fp = fopen(path, "r");
+        ASSERT_NE(fp, nullptr) << path;
+
+        /* the records are in order, prefixed with the monotonic time and
+           the endpoint name; the ring may overflow if the writer thread
+           falls behind, but every dropped record is reported */
+        char line[1024];
+        size_t len_ep = strlen(endpoint);
+        int last = -1;
+        size_t nr_recv = 0, nr_dropped = 0;
+        while (fgets(line, sizeof(line), fp)) {
+            long sec, usec;
+            int rec;
+            size_t dropped;
+
+            ASSERT_EQ(sscanf(line, "%ld.%ld ", &sec, &usec), 2) << line;
+            const char *p = strchr(line, ' ');
+            ASSERT_NE(p, nullptr) << line;
+            p++;
+            ASSERT_EQ(strncmp(p, endpoint, len_ep), 0) << line;
+            p += len_ep;
+
+            if (sscanf(p, " INFO >> record %d\n", &rec) == 1) {
+                ASSERT_GT(rec, last) << line;
+                last = rec;
+                nr_recv++;
+            }
+            else {
+                ASSERT_EQ(sscanf(p, " WARN >> %zu log records dropped\n",
+                            &dropped), 1) << line;
+                nr_dropped += dropped;
+            }
+        }
+        fclose(fp);
+
+        ASSERT_EQ(nr_recv + nr_dropped, (size_t)NR_LOG_RECORDS) << path;
+    }
+}
@@ -23,6 +23,11 @@
 #include "private/debug.h"
 #include "../helpers.h"
 
+#include <stdio.h>
+#include <unistd.h>
+
+#include <string>
+
 #include <gtest/gtest.h>
 
 
@@ -639,3 +644,286 @@ TEST(interpreter, basic)
     purc_run(NULL);
 }
 
+
+static const char *update_batch =
+    "<!DOCTYPE hvml>"
+    "<hvml target=\"html\">"
+    "    <body>"
+    "        <ul>"
+    "            <li class=\"row\">A</li>"
+    "            <li class=\"row\">B</li>"
+    "            <li class=\"row\">C</li>"
+    "            <li class=\"row\">D</li>"
+    "        </ul>"
+    ""
+    "        <observe on=\"$CRTN\" for=\"idle\">"
+    "            <forget on=\"$CRTN\" for=\"idle\" />"
+    "            <update on=\"$DOC.query('.row')\" at=\"attr.data-state\" with=\"done\" />"
+    "            <exit with=\"[$DOC.query('.row').at(0).attr('data-state'), $DOC.query('.row').at(3).attr('data-state')]\" />"
+    "        </observe>"
+    "    </body>"
+    "</hvml>";
+
+#define UPDATE_BATCH_LOG    "/tmp/purc-test-update-batch.log"
+
+static purc_variant_t update_batch_result;
+
+static int update_batch_cond_handler(purc_cond_t event, purc_coroutine_t cor,
+        void *data)
+{
+    (void)cor;
+    if (event == PURC_COND_COR_EXITED) {
+        struct purc_cor_exit_info *info = (struct purc_cor_exit_info *)data;
+        if (info->result)
+            update_batch_result = purc_variant_ref(info->result);
+    }
+    return 0;
+}
+
+/* the same change on several elements goes to renderer in one request */
+TEST(interpreter, update_batch)
+{
+    unlink(UPDATE_BATCH_LOG);
+
+    {
+        unsigned int modules =
+            (PURC_MODULE_HVML | PURC_MODULE_PCRDR) & ~PURC_HAVE_FETCHER;
+
+        struct purc_instance_extra_info info = { };
+        info.renderer_comm = PURC_RDRCOMM_HEADLESS;
+        info.renderer_uri = "file://" UPDATE_BATCH_LOG;
+        info.workspace_name = "main";
+
+        PurCInstance purc(modules, "cn.fmsoft.hybridos.test",
+                "test_update_batch", &info);
+        ASSERT_TRUE(purc);
+
+        purc_vdom_t vdom = purc_load_hvml_from_string(update_batch);
+        ASSERT_NE(vdom, nullptr);
+
+        purc_renderer_extra_info extra_info = {};
+        extra_info.title = "update_batch";
+        purc_coroutine_t co = purc_schedule_vdom(vdom,
+                0, PURC_VARIANT_INVALID, PCRDR_PAGE_TYPE_PLAINWIN,
+                "main", NULL, "update_batch", &extra_info, NULL, NULL);
+        ASSERT_NE(co, nullptr);
+
+        purc_run((purc_cond_handler)update_batch_cond_handler);
+
+        /* the eDOM has the change on all elements */
+        ASSERT_NE(update_batch_result, nullptr);
+        purc_variant_t expected = purc_variant_make_from_json_string(
+                "[\"done\", \"done\"]", 16);
+        ASSERT_TRUE(purc_variant_is_equal_to(update_batch_result, expected));
+        purc_variant_unref(expected);
+        purc_variant_unref(update_batch_result);
+        update_batch_result = PURC_VARIANT_INVALID;
+    }
+
+    /* the renderer got one request listing the four elements */
+    FILE *fp = fopen(UPDATE_BATCH_LOG, "r");
+    ASSERT_NE(fp, nullptr);
+
+    char line[1024];
+    char element[1024] = "";
+    int nr_requests = 0;
+    bool in_request = false;
+    while (fgets(line, sizeof(line), fp)) {
+        if (strcmp(line, ">>>\n") == 0) {
+            in_request = true;
+            element[0] = 0;
+        }
+        else if (strcmp(line, ">>>END\n") == 0) {
+            in_request = false;
+        }
+        else if (in_request && strncmp(line, "element:", 8) == 0) {
+            strcpy(element, line + 8);
+        }
+        else if (in_request &&
+                strcmp(line, "property:attr.data-state\n") == 0) {
+            nr_requests++;
+            ASSERT_EQ(strncmp(element, "handles/", 8), 0) << element;
+
+            int nr_handles = 1;
+            for (const char *p = element; *p; p++) {
+                if (*p == ',')
+                    nr_handles++;
+            }
+            ASSERT_EQ(nr_handles, 4) << element;
+        }
+    }
+    fclose(fp);
+
+    ASSERT_EQ(nr_requests, 1);
+}
+
+static pcrdr_msg *
+send_headless_request(pcrdr_conn *conn, pcrdr_msg_target target,
+        uint64_t target_value, const char *operation,
+        pcrdr_msg_element_type element_type, const char *element_value)
+{
+    pcrdr_msg *request = pcrdr_make_request_message(target, target_value,
+            operation, NULL, NULL, element_type, element_value,
+            element_value ? "attr.data-state" : NULL,
+            element_value ? PCRDR_MSG_DATA_TYPE_PLAIN :
+                PCRDR_MSG_DATA_TYPE_VOID,
+            element_value ? "done" : NULL, element_value ? 4 : 0);
+    if (request == NULL)
+        return NULL;
+
+    pcrdr_msg *response = NULL;
+    pcrdr_send_request_and_wait_response(conn, request, 1, &response);
+    pcrdr_release_message(request);
+    return response;
+}
+
+/* a failed request on several elements tells which element failed */
+TEST(interpreter, update_batch_failure)
+{
+    unsigned int modules =
+        (PURC_MODULE_HVML | PURC_MODULE_PCRDR) & ~PURC_HAVE_FETCHER;
+
+    struct purc_instance_extra_info info = { };
+    info.renderer_comm = PURC_RDRCOMM_HEADLESS;
+    info.renderer_uri = "file://" UPDATE_BATCH_LOG;
+
+    PurCInstance purc(modules, "cn.fmsoft.hybridos.test",
+            "test_update_batch", &info);
+    ASSERT_TRUE(purc);
+
+    pcrdr_conn *conn = purc_get_conn_to_renderer();
+    ASSERT_NE(conn, nullptr);
+
+    pcrdr_msg *response;
+    response = send_headless_request(conn, PCRDR_MSG_TARGET_WORKSPACE, 0,
+            PCRDR_OPERATION_CREATEPLAINWINDOW, PCRDR_MSG_ELEMENT_TYPE_VOID,
+            NULL);
+    ASSERT_NE(response, nullptr);
+    ASSERT_EQ(response->retCode, PCRDR_SC_OK);
+    uint64_t window = response->resultValue;
+    pcrdr_release_message(response);
+
+    response = send_headless_request(conn, PCRDR_MSG_TARGET_PLAINWINDOW,
+            window, PCRDR_OPERATION_LOAD, PCRDR_MSG_ELEMENT_TYPE_VOID, NULL);
+    ASSERT_NE(response, nullptr);
+    ASSERT_EQ(response->retCode, PCRDR_SC_OK);
+    uint64_t dom = response->resultValue;
+    pcrdr_release_message(response);
+
+    response = send_headless_request(conn, PCRDR_MSG_TARGET_DOM, dom,
+            PCRDR_OPERATION_UPDATE, PCRDR_MSG_ELEMENT_TYPE_HANDLES,
+            "1a,2b,3c");
+    ASSERT_NE(response, nullptr);
+    ASSERT_EQ(response->retCode, PCRDR_SC_OK);
+    pcrdr_release_message(response);
+
+    /* the result value is the index of the first element failed */
+    response = send_headless_request(conn, PCRDR_MSG_TARGET_DOM, dom,
+            PCRDR_OPERATION_UPDATE, PCRDR_MSG_ELEMENT_TYPE_HANDLES,
+            "1a,2b,0,zz");
+    ASSERT_NE(response, nullptr);
+    ASSERT_EQ(response->retCode, PCRDR_SC_BAD_REQUEST);
+    ASSERT_EQ(response->resultValue, 2U);
+    pcrdr_release_message(response);
+}
+
+#define WRITE_CHUNKS_LOG    "/tmp/purc-test-write-chunks.log"
+#define NR_WRITE_ROWS       2000
+
+static std::string
+write_chunks_row(int i)
+{
+    char head[16];
+    snprintf(head, sizeof(head), "row-%04d:", i);
+    return std::string("<li>") + head + std::string(100, 'a' + i % 26) +
+        "</li>";
+}
+
+/* a page of several chunks reaches the renderer intact */
+TEST(interpreter, write_chunks)
+{
+    unlink(WRITE_CHUNKS_LOG);
+
+    std::string hvml = "<!DOCTYPE hvml><hvml target=\"html\"><body><ul>";
+    for (int i = 0; i < NR_WRITE_ROWS; i++) {
+        hvml += write_chunks_row(i);
+    }
+    hvml += "</ul></body></hvml>";
+
+    {
+        unsigned int modules =
+            (PURC_MODULE_HVML | PURC_MODULE_PCRDR) & ~PURC_HAVE_FETCHER;
+
+        struct purc_instance_extra_info info = { };
+        info.renderer_comm = PURC_RDRCOMM_HEADLESS;
+        info.renderer_uri = "file://" WRITE_CHUNKS_LOG;
+        info.workspace_name = "main";
+
+        PurCInstance purc(modules, "cn.fmsoft.hybridos.test",
+                "test_write_chunks", &info);
+        ASSERT_TRUE(purc);
+
+        purc_vdom_t vdom = purc_load_hvml_from_string(hvml.c_str());
+        ASSERT_NE(vdom, nullptr);
+
+        purc_renderer_extra_info extra_info = {};
+        extra_info.title = "write_chunks";
+        purc_coroutine_t co = purc_schedule_vdom(vdom,
+                0, PURC_VARIANT_INVALID, PCRDR_PAGE_TYPE_PLAINWIN,
+                "main", NULL, "write_chunks", &extra_info, NULL, NULL);
+        ASSERT_NE(co, nullptr);
+
+        purc_run(NULL);
+    }
+
+    /* join the data of writeBegin, writeMore, and writeEnd requests */
+    FILE *fp = fopen(WRITE_CHUNKS_LOG, "r");
+    ASSERT_NE(fp, nullptr);
+
+    std::string log;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        log.append(buf, n);
+    }
+    fclose(fp);
+
+    std::string content;
+    int nr_writes = 0;
+    size_t pos = 0;
+    while ((pos = log.find(">>>\ntype:request\n", pos)) != std::string::npos) {
+        size_t op = log.find("operation:", pos);
+        ASSERT_NE(op, std::string::npos);
+        size_t op_end = log.find('\n', op);
+        std::string operation = log.substr(op + 10, op_end - op - 10);
+
+        size_t len = log.find("dataLen:", op_end);
+        ASSERT_NE(len, std::string::npos);
+        size_t data = log.find("\n \n", len);
+        ASSERT_NE(data, std::string::npos);
+        size_t data_len = strtoul(log.c_str() + len + 8, NULL, 10);
+        data += 3;
+
+        if (operation == PCRDR_OPERATION_WRITEBEGIN ||
+                operation == PCRDR_OPERATION_WRITEMORE ||
+                operation == PCRDR_OPERATION_WRITEEND) {
+            content.append(log, data, data_len);
+            nr_writes++;
+        }
+        pos = data + data_len;
+    }
+
+    /* writeBegin, writeMore at least once, and writeEnd */
+    ASSERT_GE(nr_writes, 3);
+
+    pos = 0;
+    for (int i = 0; i < NR_WRITE_ROWS; i++) {
+        std::string row = write_chunks_row(i);
+        size_t found = content.find(row, pos);
+        ASSERT_NE(found, std::string::npos) << "row " << i;
+        pos = found + row.length();
+        /* no chunk is sent twice */
+        ASSERT_EQ(content.find(row, pos), std::string::npos) << "row " << i;
+    }
+    ASSERT_NE(content.find("</html>", pos), std::string::npos);
+}
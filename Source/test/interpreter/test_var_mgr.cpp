@@ -0,0 +1,151 @@
+/*
+** Copyright (C) 2022 FMSoft <https://www.fmsoft.cn>
+**
+** This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+**
+** This program is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public License
+** along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "purc/purc.h"
+#include "private/var-mgr.h"
+#include "private/utils.h"
+#include "../helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#define NR_NAMES        1000
+
+static size_t
+home_slot(const std::string &name, size_t nr_slots)
+{
+    return pcutils_hash_hash((const unsigned char *)name.c_str(),
+            name.length()) & (nr_slots - 1);
+}
+
+static void
+check_lookups(pcvarmgr_t mgr, const std::vector<std::string> &names,
+        const std::vector<bool> &removed)
+{
+    size_t nr_vars = 0;
+    for (size_t i = 0; i < names.size(); i++) {
+        const char *name = names[i].c_str();
+        purc_variant_t v = pcvarmgr_get(mgr, name);
+        purc_variant_t o = purc_variant_object_get_by_ckey(mgr->object,
+                name);
+        if (removed[i]) {
+            ASSERT_EQ(v, PURC_VARIANT_INVALID) << name;
+            ASSERT_EQ(o, PURC_VARIANT_INVALID) << name;
+            continue;
+        }
+
+        uint64_t u = 0;
+        ASSERT_NE(v, PURC_VARIANT_INVALID) << name;
+        ASSERT_EQ(v, o) << name;
+        ASSERT_TRUE(purc_variant_cast_to_ulongint(v, &u, false)) << name;
+        ASSERT_EQ(u, i) << name;
+        nr_vars++;
+    }
+
+    ASSERT_EQ(mgr->nr_vars, nr_vars);
+    purc_clr_error();
+}
+
+/* removals in the middle of the collision clusters of the name index */
+TEST(var_mgr, index)
+{
+    PurCInstance purc("cn.fmsoft.hvml.test", "var_mgr", false);
+    ASSERT_TRUE(purc);
+
+    pcvarmgr_t mgr = pcvarmgr_create();
+    ASSERT_NE(mgr, nullptr);
+
+    std::vector<std::string> names;
+    std::vector<bool> removed(NR_NAMES, false);
+    for (size_t i = 0; i < NR_NAMES; i++) {
+        names.push_back("var" + std::to_string(i));
+
+        purc_variant_t v = purc_variant_make_ulongint(i);
+        ASSERT_TRUE(pcvarmgr_add(mgr, names[i].c_str(), v));
+        purc_variant_unref(v);
+    }
+    check_lookups(mgr, names, removed);
+
+    /* the names sharing a home slot, in the order of insertion */
+    std::map<size_t, std::vector<size_t>> clusters;
+    for (size_t i = 0; i < NR_NAMES; i++) {
+        clusters[home_slot(names[i], mgr->nr_slots)].push_back(i);
+    }
+
+    /* remove the middle names of the slots shared by three names or more,
+     * and the first name of every third slot otherwise */
+    size_t nr_middles = 0;
+    for (auto &c : clusters) {
+        const std::vector<size_t> &idx = c.second;
+        if (idx.size() >= 3) {
+            for (size_t j = 1; j + 1 < idx.size(); j++) {
+                removed[idx[j]] = true;
+                nr_middles++;
+            }
+        }
+        else if (c.first % 3 == 0) {
+            removed[idx[0]] = true;
+        }
+    }
+    ASSERT_GT(nr_middles, 0);
+
+    for (size_t i = 0; i < NR_NAMES; i++) {
+        if (removed[i]) {
+            ASSERT_TRUE(pcvarmgr_remove(mgr, names[i].c_str()));
+            /* removing a missing name fails */
+            ASSERT_FALSE(pcvarmgr_remove(mgr, names[i].c_str()));
+        }
+    }
+    check_lookups(mgr, names, removed);
+
+    /* add the removed names back; their slots may be taken by the entries
+     * shifted back on removal */
+    for (size_t i = 0; i < NR_NAMES; i++) {
+        if (removed[i]) {
+            purc_variant_t v = purc_variant_make_ulongint(i);
+            ASSERT_TRUE(pcvarmgr_add(mgr, names[i].c_str(), v));
+            purc_variant_unref(v);
+            removed[i] = false;
+        }
+    }
+    check_lookups(mgr, names, removed);
+
+    /* replacing a value keeps one entry for the name */
+    for (size_t i = 0; i < NR_NAMES; i += 7) {
+        purc_variant_t v = purc_variant_make_ulongint(i);
+        ASSERT_TRUE(pcvarmgr_add(mgr, names[i].c_str(), v));
+        purc_variant_unref(v);
+    }
+    check_lookups(mgr, names, removed);
+
+    /* remove all, walking backward */
+    for (size_t i = NR_NAMES; i > 0; i--) {
+        ASSERT_TRUE(pcvarmgr_remove(mgr, names[i - 1].c_str()));
+        removed[i - 1] = true;
+        if (i % 100 == 0)
+            check_lookups(mgr, names, removed);
+    }
+    check_lookups(mgr, names, removed);
+
+    pcvarmgr_destroy(mgr);
+}
@@ -30,6 +30,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
 
 
 void create_temp_file(const char* file, const char* buf, size_t buf_len)
@@ -884,6 +885,52 @@ TEST(buffer_rwstream, seek_read)
     ASSERT_EQ(ret, 0);
 }
 
+/* test mmap rwstream */
+TEST(mmap_rwstream, read_seek)
+{
+    char tmp_file[] = "/tmp/rwstream_mmap.txt";
+    char buf[] = "This is test file. 这是测试文件。";
+    size_t buf_len = strlen(buf);
+    /* include the terminating null byte in the file */
+    create_temp_file(tmp_file, buf, buf_len + 1);
+
+    int fd = open(tmp_file, O_RDONLY);
+    ASSERT_GE(fd, 0);
+
+    purc_rwstream_t rws = purc_rwstream_new_from_mmap (fd, buf_len + 2);
+    ASSERT_EQ(rws, nullptr);
+
+    rws = purc_rwstream_new_from_mmap (fd, buf_len);
+    close(fd);
+    ASSERT_NE(rws, nullptr);
+
+    size_t sz_content = 0;
+    const char *mem = (const char *)purc_rwstream_get_mem_buffer (rws,
+            &sz_content);
+    ASSERT_EQ(sz_content, buf_len);
+    ASSERT_STREQ(mem, buf);
+
+    char read_buf[64] = {0};
+    ssize_t read_len = purc_rwstream_read (rws, read_buf, 4);
+    ASSERT_EQ(read_len, 4);
+    ASSERT_STREQ(read_buf, "This");
+
+    off_t pos = purc_rwstream_seek (rws, -3, SEEK_END);
+    ASSERT_EQ(pos, (off_t)buf_len - 3);
+
+    memset(read_buf, 0, sizeof(read_buf));
+    read_len = purc_rwstream_read (rws, read_buf, sizeof(read_buf));
+    ASSERT_EQ(read_len, 3);
+    ASSERT_STREQ(read_buf, "。");
+
+    /* the stream is read-only */
+    ASSERT_EQ(purc_rwstream_write (rws, "x", 1), -1);
+
+    int ret = purc_rwstream_destroy (rws);
+    ASSERT_EQ(ret, 0);
+    remove_temp_file(tmp_file);
+}
+
 #if HAVE(GLIB)
 /* test gio fd rwstream */
 TEST(gio_rwstream, new_destroy)
@@ -27,6 +27,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <gtest/gtest.h>
+#include <regex.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -147,3 +148,62 @@ TEST(regex, match_info)
     pcregex_destroy(regex);
 }
 
+
+TEST(regex, cache)
+{
+    int ret = purc_init_ex(PURC_MODULE_UTILS, "cn.fmsoft.hybridos.test",
+            "test_regex_cache", NULL);
+    ASSERT_EQ(ret, PURC_ERROR_OK);
+
+    const struct purc_regex_cache_stat *stat = purc_regex_cache_stat();
+    ASSERT_NE(stat, nullptr);
+    size_t nr_misses = stat->nr_misses;
+    size_t nr_hits = stat->nr_hits;
+
+    struct pcregex_cached *c1, *c2, *c3;
+    c1 = pcregex_cache_get_posix("^[a-z]+[0-9]*$", REG_EXTENDED);
+    ASSERT_NE(c1, nullptr);
+    ASSERT_EQ(regexec(pcregex_cached_posix(c1), "abc123", 0, NULL, 0), 0);
+    ASSERT_NE(regexec(pcregex_cached_posix(c1), "123abc", 0, NULL, 0), 0);
+
+    c2 = pcregex_cache_get_posix("^[a-z]+[0-9]*$", REG_EXTENDED);
+    ASSERT_EQ(c1, c2);
+    ASSERT_EQ(stat->nr_misses, nr_misses + 1);
+    ASSERT_EQ(stat->nr_hits, nr_hits + 1);
+
+    /* different flags make a different entry */
+    c3 = pcregex_cache_get_posix("^[a-z]+[0-9]*$",
+            REG_EXTENDED | REG_ICASE);
+    ASSERT_NE(c3, nullptr);
+    ASSERT_NE(c1, c3);
+    ASSERT_EQ(regexec(pcregex_cached_posix(c3), "ABC123", 0, NULL, 0), 0);
+
+    /* a bad pattern is not cached */
+    ASSERT_EQ(pcregex_cache_get_posix("a[b", REG_EXTENDED), nullptr);
+
+    pcregex_cached_release(c3);
+    pcregex_cached_release(c2);
+
+    /* the pinned entry survives the evictions */
+    char pattern[32];
+    for (int i = 0; i < PCREGEX_CACHE_CAPACITY * 2; i++) {
+        snprintf(pattern, sizeof(pattern), "^x%d$", i);
+        struct pcregex_cached *c = pcregex_cache_get_posix(pattern,
+                REG_EXTENDED);
+        ASSERT_NE(c, nullptr);
+        pcregex_cached_release(c);
+    }
+    ASSERT_LE(stat->nr_entries, (size_t)PCREGEX_CACHE_CAPACITY);
+    ASSERT_GT(stat->nr_evictions, 0);
+    ASSERT_EQ(regexec(pcregex_cached_posix(c1), "xyz", 0, NULL, 0), 0);
+    pcregex_cached_release(c1);
+
+    /* pcregex_is_match() goes through the cache too */
+    nr_misses = stat->nr_misses;
+    nr_hits = stat->nr_hits;
+    pcregex_is_match("^[A-Za-z_][A-Za-z0-9_]*$", "abc");
+    pcregex_is_match("^[A-Za-z_][A-Za-z0-9_]*$", "def");
+    ASSERT_EQ(stat->nr_misses + stat->nr_hits, nr_misses + nr_hits + 2);
+
+    purc_cleanup();
+}
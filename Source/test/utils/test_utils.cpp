@@ -27,6 +27,7 @@
 #include "private/rbtree.h"
 #include "private/atom-buckets.h"
 #include "private/sorted-array.h"
+#include "private/timer-wheel.h"
 #include "private/url.h"
 
 #include "../helpers.h"
@@ -1851,6 +1852,130 @@ TEST(utils, fibonacci_number)
     ASSERT_EQ(fib, 0);
 }
 
+struct wheel_timer {
+    struct pcutils_timer    timer;
+    uint64_t                expected;
+    uint64_t                fired_at;
+    int                     nr_fired;
+};
+
+static uint64_t wheel_clock;
+
+static void wheel_timer_fired(struct pcutils_timer *timer)
+{
+    struct wheel_timer *wt = (struct wheel_timer *)timer;
+    wt->fired_at = wheel_clock;
+    wt->nr_fired++;
+}
+
+TEST(utils, timer_wheel)
+{
+    static const uint64_t delays[] = {
+        0, 1, 63, 64, 65, 4095, 4096, 4097, 262143, 262144,
+        16777215, 16777216, 20000000,
+    };
+    const size_t nr = PCA_TABLESIZE(delays);
+    struct wheel_timer timers[PCA_TABLESIZE(delays)] = { };
+
+    uint64_t start = 123456789;
+    struct pcutils_timer_wheel *wheel = pcutils_timer_wheel_new(start);
+    ASSERT_NE(wheel, nullptr);
+
+    for (size_t i = 0; i < nr; i++) {
+        pcutils_timer_init(&timers[i].timer, wheel_timer_fired);
+        timers[i].expected = start + delays[i];
+        pcutils_timer_wheel_arm(wheel, &timers[i].timer, timers[i].expected);
+    }
+    ASSERT_EQ(pcutils_timer_wheel_count(wheel), nr);
+
+    /* cancel one and re-arm another one to an earlier time */
+    pcutils_timer_wheel_cancel(wheel, &timers[5].timer);
+    timers[5].expected = 0;
+    timers[8].expected = start + 100;
+    pcutils_timer_wheel_arm(wheel, &timers[8].timer, timers[8].expected);
+    ASSERT_EQ(pcutils_timer_wheel_count(wheel), nr - 1);
+
+    wheel_clock = start;
+    while (pcutils_timer_wheel_count(wheel) > 0) {
+        uint64_t next = pcutils_timer_wheel_next_expiry(wheel);
+        ASSERT_NE(next, PCUTILS_TIMER_NEVER);
+        ASSERT_GE(next, wheel_clock);
+
+        wheel_clock = next;
+        pcutils_timer_wheel_advance(wheel, wheel_clock);
+    }
+
+    for (size_t i = 0; i < nr; i++) {
+        if (timers[i].expected == 0) {
+            ASSERT_EQ(timers[i].nr_fired, 0);
+        }
+        else {
+            ASSERT_EQ(timers[i].nr_fired, 1);
+            ASSERT_EQ(timers[i].fired_at, timers[i].expected);
+        }
+    }
+
+    ASSERT_EQ(pcutils_timer_wheel_next_expiry(wheel), PCUTILS_TIMER_NEVER);
+    pcutils_timer_wheel_destroy(wheel);
+}
+
+TEST(utils, timer_wheel_100k)
+{
+    const size_t nr = 100000;
+    struct wheel_timer *timers =
+        (struct wheel_timer *)calloc(nr, sizeof(struct wheel_timer));
+    ASSERT_NE(timers, nullptr);
+
+    uint64_t start = 0;
+    struct pcutils_timer_wheel *wheel = pcutils_timer_wheel_new(start);
+
+    struct timespec begin;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    srandom(1);
+    for (size_t i = 0; i < nr; i++) {
+        pcutils_timer_init(&timers[i].timer, wheel_timer_fired);
+        timers[i].expected = start + 1 + random() % 600000;
+        pcutils_timer_wheel_arm(wheel, &timers[i].timer, timers[i].expected);
+    }
+    double t_arm = purc_get_elapsed_seconds(&begin, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    for (size_t i = 0; i < nr; i += 2) {
+        pcutils_timer_wheel_cancel(wheel, &timers[i].timer);
+        timers[i].expected = 0;
+    }
+    double t_cancel = purc_get_elapsed_seconds(&begin, NULL);
+    ASSERT_EQ(pcutils_timer_wheel_count(wheel), nr / 2);
+
+    /* advance the wheel as the scheduler does: every 10ms */
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    size_t nr_fired = 0;
+    for (wheel_clock = start; pcutils_timer_wheel_count(wheel) > 0;
+            wheel_clock += 10) {
+        nr_fired += pcutils_timer_wheel_advance(wheel, wheel_clock);
+    }
+    double t_fire = purc_get_elapsed_seconds(&begin, NULL);
+    ASSERT_EQ(nr_fired, nr / 2);
+
+    for (size_t i = 0; i < nr; i++) {
+        if (timers[i].expected == 0) {
+            ASSERT_EQ(timers[i].nr_fired, 0);
+        }
+        else {
+            ASSERT_EQ(timers[i].nr_fired, 1);
+            ASSERT_GE(timers[i].fired_at, timers[i].expected);
+            ASSERT_LT(timers[i].fired_at, timers[i].expected + 10);
+        }
+    }
+
+    fprintf(stderr, "timer wheel with %u timers: arm %.3fs, cancel %.3fs, "
+            "fire %.3fs\n", (unsigned)nr, t_arm, t_cancel, t_fire);
+
+    pcutils_timer_wheel_destroy(wheel);
+    free(timers);
+}
+
 TEST(utils, build_query_array)
 {
     purc_variant_t v;
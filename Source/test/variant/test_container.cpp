@@ -20,6 +20,7 @@
 #include "purc/purc.h"
 
 #include "private/hvml.h"
+#include "private/variant.h"
 #include "private/utils.h"
 #include "purc/purc-rwstream.h"
 #include "hvml/hvml-token.h"
@@ -546,3 +547,160 @@ TEST(variant, clone)
     PURC_VARIANT_SAFE_CLEAR(set);
 }
 
+static void
+expect_ejson(purc_variant_t v, const char *s)
+{
+    purc_variant_t expected = pcejson_parser_parse_string(s, 0, 0);
+    ASSERT_NE(expected, nullptr);
+
+    int diff = purc_variant_compare_ex(v, expected,
+            PCVARIANT_COMPARE_OPT_AUTO);
+    if (diff) {
+        PRINT_VARIANT(v);
+        PRINT_VARIANT(expected);
+        ADD_FAILURE() << "unexpected value" << std::endl;
+    }
+
+    purc_variant_unref(expected);
+}
+
+TEST(variant, clone_copy_on_write)
+{
+    PurCInstance purc("cn.fmsoft.hybridos.test", "purc_variant", false);
+
+    purc_variant_t arr, obj, c1, c2, v;
+
+    arr = pcejson_parser_parse_string("[1, 2, 3]", 0, 0);
+    ASSERT_NE(arr, nullptr);
+
+    // the clones share the data until one of them is changed
+    c1 = purc_variant_container_clone(arr);
+    c2 = purc_variant_container_clone(c1);
+    ASSERT_NE(c1, PURC_VARIANT_INVALID);
+    ASSERT_NE(c2, PURC_VARIANT_INVALID);
+
+    v = purc_variant_make_longint(4);
+    ASSERT_TRUE(purc_variant_array_append(c1, v));
+    ASSERT_TRUE(purc_variant_array_set(arr, 0, v));
+    purc_variant_unref(v);
+    expect_ejson(arr, "[4, 2, 3]");
+    expect_ejson(c1, "[1, 2, 3, 4]");
+    expect_ejson(c2, "[1, 2, 3]");
+
+    ASSERT_TRUE(purc_variant_array_remove(c2, 1));
+    expect_ejson(c2, "[1, 3]");
+    purc_variant_unref(c2);
+
+    // the last sharer clears the data which it owns now
+    c2 = purc_variant_container_clone(c1);
+    purc_variant_unref(c1);
+    ASSERT_TRUE(pcvariant_array_clear(c2, false));
+    expect_ejson(c2, "[]");
+    purc_variant_unref(c2);
+    purc_variant_unref(arr);
+
+    obj = pcejson_parser_parse_string("{a: 1, b: 2, c: [1, 2]}", 0, 0);
+    ASSERT_NE(obj, nullptr);
+
+    c1 = purc_variant_container_clone(obj);
+    ASSERT_NE(c1, PURC_VARIANT_INVALID);
+    ASSERT_TRUE(purc_variant_object_remove_by_static_ckey(c1, "a", false));
+    v = purc_variant_make_longint(3);
+    ASSERT_TRUE(purc_variant_object_set_by_static_ckey(obj, "b", v));
+    purc_variant_unref(v);
+    expect_ejson(obj, "{a: 1, b: 3, c: [1, 2]}");
+    expect_ejson(c1, "{b: 2, c: [1, 2]}");
+
+    // a deep clone shares the data of the members without containers
+    c2 = purc_variant_container_clone_recursively(obj);
+    ASSERT_NE(c2, PURC_VARIANT_INVALID);
+    v = purc_variant_object_get_by_ckey(c2, "c");
+    ASSERT_NE(v, PURC_VARIANT_INVALID);
+    ASSERT_NE(v, purc_variant_object_get_by_ckey(obj, "c"));
+    ASSERT_TRUE(purc_variant_array_remove(v, 0));
+    expect_ejson(c2, "{a: 1, b: 3, c: [2]}");
+    expect_ejson(obj, "{a: 1, b: 3, c: [1, 2]}");
+
+    // adding a sharer to a set makes its data private
+    purc_variant_t set = purc_variant_make_set_by_ckey(0, "b", NULL);
+    ASSERT_NE(set, PURC_VARIANT_INVALID);
+    purc_variant_unref(c1);
+    c1 = purc_variant_container_clone(obj);
+    ASSERT_NE(c1, PURC_VARIANT_INVALID);
+    ASSERT_TRUE(purc_variant_set_add(set, c1, true));
+    v = purc_variant_make_longint(5);
+    ASSERT_TRUE(purc_variant_object_set_by_static_ckey(c1, "b", v));
+    purc_variant_unref(v);
+    expect_ejson(obj, "{a: 1, b: 3, c: [1, 2]}");
+
+    purc_variant_unref(set);
+    purc_variant_unref(c2);
+    purc_variant_unref(c1);
+    purc_variant_unref(obj);
+}
+
+static std::string
+iterate_keys(struct pcvrnt_object_iterator *it)
+{
+    std::string keys;
+    do {
+        purc_variant_t k = pcvrnt_object_iterator_get_key(it);
+        keys += purc_variant_get_string_const(k);
+    } while (pcvrnt_object_iterator_next(it));
+
+    return keys;
+}
+
+TEST(variant, iterate_shared_object)
+{
+    PurCInstance purc("cn.fmsoft.hybridos.test", "purc_variant", false);
+
+    purc_variant_t obj, c1, v;
+    struct pcvrnt_object_iterator *it;
+
+    obj = pcejson_parser_parse_string("{a: 1, b: 2, c: 3}", 0, 0);
+    ASSERT_NE(obj, nullptr);
+
+    // the iterator keeps walking the data which the object had
+    c1 = purc_variant_container_clone(obj);
+    ASSERT_NE(c1, PURC_VARIANT_INVALID);
+    it = pcvrnt_object_iterator_create_begin(obj);
+    ASSERT_NE(it, nullptr);
+    v = purc_variant_make_longint(4);
+    ASSERT_TRUE(purc_variant_object_set_by_static_ckey(obj, "d", v));
+    purc_variant_unref(v);
+    ASSERT_TRUE(purc_variant_object_remove_by_static_ckey(obj, "b", false));
+
+    // the other sharer goes away; the iterator owns the data now
+    purc_variant_unref(c1);
+    ASSERT_EQ(iterate_keys(it), "abc");
+    pcvrnt_object_iterator_release(it);
+    expect_ejson(obj, "{a: 1, c: 3, d: 4}");
+
+    // so does it when the object is changed under a private iterator
+    it = pcvrnt_object_iterator_create_begin(obj);
+    ASSERT_NE(it, nullptr);
+    ASSERT_TRUE(purc_variant_object_remove_by_static_ckey(obj, "c", false));
+    c1 = purc_variant_container_clone(obj);
+    ASSERT_NE(c1, PURC_VARIANT_INVALID);
+    ASSERT_TRUE(purc_variant_object_remove_by_static_ckey(obj, "a", false));
+    ASSERT_EQ(iterate_keys(it), "acd");
+    pcvrnt_object_iterator_release(it);
+    expect_ejson(obj, "{d: 4}");
+    expect_ejson(c1, "{a: 1, d: 4}");
+
+    // the object goes away before the iterator
+    it = pcvrnt_object_iterator_create_end(c1);
+    ASSERT_NE(it, nullptr);
+    purc_variant_unref(c1);
+    ASSERT_EQ(std::string(purc_variant_get_string_const(
+                    pcvrnt_object_iterator_get_key(it))), "d");
+    ASSERT_TRUE(pcvrnt_object_iterator_prev(it));
+    ASSERT_EQ(std::string(purc_variant_get_string_const(
+                    pcvrnt_object_iterator_get_key(it))), "a");
+    ASSERT_FALSE(pcvrnt_object_iterator_prev(it));
+    pcvrnt_object_iterator_release(it);
+
+    purc_variant_unref(obj);
+}
+
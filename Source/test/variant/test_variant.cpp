@@ -1589,3 +1589,71 @@ TEST(variant, reuse_buff)
     purc_cleanup ();
 }
 
+
+static bool
+count_grow(purc_variant_t src, pcvar_op_t op, void *ctxt,
+        size_t nr_args, purc_variant_t *argv)
+{
+    (void)src;
+    (void)op;
+    (void)nr_args;
+    (void)argv;
+
+    (*(int *)ctxt)++;
+    return true;
+}
+
+TEST(variant, compact_cell)
+{
+    purc_instance_extra_info info = {};
+    int ret = purc_init_ex(PURC_MODULE_VARIANT, "cn.fmsfot.hvml.test",
+            "variant", &info);
+    ASSERT_EQ (ret, PURC_ERROR_OK);
+
+    if (sizeof(void *) == 8 && sizeof(long double) <= 16) {
+        ASSERT_EQ(sizeof(purc_variant), 32);
+    }
+
+    // the long double value shares the space with the other payloads
+    long double ld = 1.0L / 3.0L;
+    purc_variant_t v = purc_variant_make_longdouble(ld);
+    ASSERT_NE(v, nullptr);
+    long double got = 0;
+    ASSERT_TRUE(purc_variant_cast_to_longdouble(v, &got, false));
+    ASSERT_EQ(got, ld);
+    purc_variant_unref(v);
+
+    // the longest short string
+    const char *str = "0123456789abcde";
+    v = purc_variant_make_string(str, false);
+    ASSERT_NE(v, nullptr);
+    ASSERT_STREQ(purc_variant_get_string_const(v), str);
+    purc_variant_unref(v);
+
+    // the listeners are kept out of the cell
+    int nr_grows = 0;
+    purc_variant_t arr = purc_variant_make_array(0, PURC_VARIANT_INVALID);
+    ASSERT_NE(arr, nullptr);
+    ASSERT_EQ(arr->flags & PCVARIANT_FLAG_LISTENERS, 0);
+
+    struct pcvar_listener *listener;
+    listener = purc_variant_register_post_listener(arr,
+            PCVAR_OPERATION_GROW, count_grow, &nr_grows);
+    ASSERT_NE(listener, nullptr);
+    ASSERT_NE(arr->flags & PCVARIANT_FLAG_LISTENERS, 0);
+
+    v = purc_variant_make_ulongint(1);
+    ASSERT_TRUE(purc_variant_array_append(arr, v));
+    ASSERT_EQ(nr_grows, 1);
+
+    ASSERT_TRUE(purc_variant_revoke_listener(arr, listener));
+    ASSERT_EQ(arr->flags & PCVARIANT_FLAG_LISTENERS, 0);
+
+    ASSERT_TRUE(purc_variant_array_append(arr, v));
+    ASSERT_EQ(nr_grows, 1);
+
+    purc_variant_unref(v);
+    purc_variant_unref(arr);
+
+    purc_cleanup ();
+}
@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <math.h>
 #include <gtest/gtest.h>
 
 TEST(variant_array, init_with_1_str)
@@ -533,3 +534,187 @@ TEST(variant_array, sort)
     ASSERT_STREQ(inbuf, outbuf);
 }
 
+
+TEST(variant_array, sort_by_keys)
+{
+    purc_instance_extra_info info = {};
+    int ret = 0;
+    bool cleanup = false;
+
+    ret = purc_init_ex (PURC_MODULE_VARIANT, "cn.fmsoft.hybridos.test",
+            "test_init", &info);
+    ASSERT_EQ(ret, PURC_ERROR_OK);
+
+    // a single numeric key large enough to be sorted by radix
+    const size_t nr = 1000;
+    purc_variant_t arr = purc_variant_make_array(0, PURC_VARIANT_INVALID);
+    ASSERT_NE(arr, nullptr);
+    for (size_t i = 0; i < nr; i++) {
+        double d = (double)((i * 7919) % nr) - 500.5;
+        purc_variant_t t = (i % 2) ? purc_variant_make_number(d) :
+            purc_variant_make_longint((int64_t)d);
+        ASSERT_TRUE(purc_variant_array_append(arr, t));
+        purc_variant_unref(t);
+    }
+
+    struct pcvariant_sort_key key = { NULL, PCVARIANT_SORT_KEY_NUMBER };
+    ASSERT_EQ(pcvariant_sort_by_keys(arr, &key, 1, true), 0);
+    for (size_t i = 1; i < nr; i++) {
+        double l = purc_variant_numerify(purc_variant_array_get(arr, i - 1));
+        double r = purc_variant_numerify(purc_variant_array_get(arr, i));
+        ASSERT_GE(l, r);
+    }
+    purc_variant_unref(arr);
+
+    // multiple keys of objects; the sort is stable
+    const struct {
+        const char *name;
+        int64_t age;
+    } persons[] = {
+        { "b", 2 }, { "A", 2 }, { "a", 1 }, { "B", 1 }, { "a", 2 },
+    };
+
+    arr = purc_variant_make_array(0, PURC_VARIANT_INVALID);
+    ASSERT_NE(arr, nullptr);
+    for (size_t i = 0; i < PCA_TABLESIZE(persons); i++) {
+        purc_variant_t name = purc_variant_make_string(persons[i].name, false);
+        purc_variant_t age = purc_variant_make_longint(persons[i].age);
+        purc_variant_t id = purc_variant_make_ulongint(i);
+        purc_variant_t obj = purc_variant_make_object_by_static_ckey(3,
+                "name", name, "age", age, "id", id);
+        ASSERT_NE(obj, nullptr);
+        ASSERT_TRUE(purc_variant_array_append(arr, obj));
+        purc_variant_unref(obj);
+        purc_variant_unref(id);
+        purc_variant_unref(age);
+        purc_variant_unref(name);
+    }
+
+    struct pcvariant_sort_key keys[] = {
+        { "name", PCVARIANT_SORT_KEY_CASELESS },
+        { "age", PCVARIANT_SORT_KEY_NUMBER },
+    };
+    ASSERT_EQ(pcvariant_sort_by_keys(arr, keys, PCA_TABLESIZE(keys), false), 0);
+
+    const int64_t ids[] = { 2, 1, 4, 3, 0 };
+    for (size_t i = 0; i < PCA_TABLESIZE(ids); i++) {
+        purc_variant_t id;
+        id = purc_variant_object_get_by_ckey(
+                purc_variant_array_get(arr, i), "id");
+        ASSERT_EQ((int64_t)purc_variant_numerify(id), ids[i]);
+    }
+    purc_variant_unref(arr);
+
+    // NaN goes last by radix and by merge, in either order
+    const size_t sizes[] = { 10, 300 };
+    for (size_t n = 0; n < PCA_TABLESIZE(sizes); n++) {
+        for (int desc = 0; desc < 2; desc++) {
+            arr = purc_variant_make_array(0, PURC_VARIANT_INVALID);
+            ASSERT_NE(arr, nullptr);
+            for (size_t i = 0; i < sizes[n]; i++) {
+                purc_variant_t t = purc_variant_make_number(
+                        (i % 3) ? (double)((i * 7) % 11) : NAN);
+                ASSERT_TRUE(purc_variant_array_append(arr, t));
+                purc_variant_unref(t);
+            }
+
+            ASSERT_EQ(pcvariant_sort_by_keys(arr, &key, 1, desc), 0);
+            size_t nr_nans = (sizes[n] + 2) / 3;
+            for (size_t i = 0; i < sizes[n]; i++) {
+                double d = purc_variant_numerify(purc_variant_array_get(arr, i));
+                ASSERT_EQ(!!isnan(d), i >= sizes[n] - nr_nans);
+                if (i > 0 && !isnan(d)) {
+                    double prev = purc_variant_numerify(
+                            purc_variant_array_get(arr, i - 1));
+                    if (desc)
+                        ASSERT_GE(prev, d);
+                    else
+                        ASSERT_LE(prev, d);
+                }
+            }
+            purc_variant_unref(arr);
+        }
+    }
+
+    // the members without the string key go first in either order
+    const char *names[] = { "b", NULL, "a", NULL, "c" };
+    for (int desc = 0; desc < 2; desc++) {
+        arr = purc_variant_make_array(0, PURC_VARIANT_INVALID);
+        ASSERT_NE(arr, nullptr);
+        for (size_t i = 0; i < PCA_TABLESIZE(names); i++) {
+            purc_variant_t id = purc_variant_make_ulongint(i);
+            purc_variant_t obj = purc_variant_make_object_by_static_ckey(1,
+                    "id", id);
+            if (names[i]) {
+                purc_variant_t name = purc_variant_make_string(names[i], false);
+                purc_variant_object_set_by_static_ckey(obj, "name", name);
+                purc_variant_unref(name);
+            }
+            ASSERT_TRUE(purc_variant_array_append(arr, obj));
+            purc_variant_unref(obj);
+            purc_variant_unref(id);
+        }
+
+        ASSERT_EQ(pcvariant_sort_by_keys(arr, keys, 1, desc), 0);
+        const int64_t asc_ids[] = { 1, 3, 2, 0, 4 };
+        const int64_t desc_ids[] = { 1, 3, 4, 0, 2 };
+        for (size_t i = 0; i < PCA_TABLESIZE(names); i++) {
+            purc_variant_t id;
+            id = purc_variant_object_get_by_ckey(
+                    purc_variant_array_get(arr, i), "id");
+            ASSERT_EQ((int64_t)purc_variant_numerify(id),
+                    desc ? desc_ids[i] : asc_ids[i]);
+        }
+        purc_variant_unref(arr);
+    }
+
+    // enough members to be sorted by threads; the merged runs keep the
+    // order and the members with equal keys keep their original order
+    const size_t nr_big = PCVARIANT_SORT_PARALLEL_MIN * 2 + 123;
+    for (int desc = 0; desc < 2; desc++) {
+        arr = purc_variant_make_array(0, PURC_VARIANT_INVALID);
+        ASSERT_NE(arr, nullptr);
+        for (size_t i = 0; i < nr_big; i++) {
+            char buf[16];
+            snprintf(buf, sizeof(buf), (i % 2) ? "KEY%03zu" : "key%03zu",
+                    (i * 7919) % 500);
+            purc_variant_t name = purc_variant_make_string(buf, false);
+            purc_variant_t id = purc_variant_make_ulongint(i);
+            purc_variant_t obj = purc_variant_make_object_by_static_ckey(2,
+                    "name", name, "id", id);
+            ASSERT_NE(obj, nullptr);
+            ASSERT_TRUE(purc_variant_array_append(arr, obj));
+            purc_variant_unref(obj);
+            purc_variant_unref(id);
+            purc_variant_unref(name);
+        }
+
+        ASSERT_EQ(pcvariant_sort_by_keys(arr, keys, 1, desc), 0);
+        ASSERT_EQ(purc_variant_array_get_size(arr), nr_big);
+        for (size_t i = 1; i < nr_big; i++) {
+            purc_variant_t l = purc_variant_array_get(arr, i - 1);
+            purc_variant_t r = purc_variant_array_get(arr, i);
+            int cmp = pcutils_strcasecmp(
+                    purc_variant_get_string_const(
+                        purc_variant_object_get_by_ckey(l, "name")),
+                    purc_variant_get_string_const(
+                        purc_variant_object_get_by_ckey(r, "name")));
+            if (desc)
+                ASSERT_GE(cmp, 0) << i;
+            else
+                ASSERT_LE(cmp, 0) << i;
+
+            if (cmp == 0) {
+                double l_id = purc_variant_numerify(
+                        purc_variant_object_get_by_ckey(l, "id"));
+                double r_id = purc_variant_numerify(
+                        purc_variant_object_get_by_ckey(r, "id"));
+                ASSERT_LT(l_id, r_id) << i;
+            }
+        }
+        purc_variant_unref(arr);
+    }
+
+    cleanup = purc_cleanup ();
+    ASSERT_EQ (cleanup, true);
+}
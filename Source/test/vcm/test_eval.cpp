@@ -20,6 +20,7 @@
 #include "purc/purc.h"
 #include "private/vcm.h"
 
+#include <pthread.h>
 #include <gtest/gtest.h>
 
 purc_variant_t find_var(void* ctxt, const char* name)
@@ -117,3 +118,123 @@ TEST_P(test_vcm_eval, eval_silently)
 
 INSTANTIATE_TEST_SUITE_P(vcm_eval, test_vcm_eval,
         testing::ValuesIn(test_cases));
+
+TEST(vcm_eval, constant_folding)
+{
+    purc_init_ex(PURC_MODULE_EJSON, "cn.fmsoft.hybridos.test",
+            "vcm_eval", NULL);
+
+    const char *jsonee = "[ 'a', 1, [ 'b', 2 ], { 'c': 3 } ]";
+    struct purc_ejson_parsing_tree *ptree;
+    ptree = purc_variant_ejson_parse_string(jsonee, strlen(jsonee));
+    ASSERT_NE(ptree, nullptr);
+
+    purc_variant_t first = purc_ejson_parsing_tree_evalute(ptree, NULL,
+            PURC_VARIANT_INVALID, false);
+    ASSERT_NE(first, nullptr);
+
+    /* changing the first result must not change the later ones */
+    purc_variant_t inner = purc_variant_array_get(first, 2);
+    purc_variant_t v = purc_variant_make_longint(4);
+    ASSERT_TRUE(purc_variant_array_append(inner, v));
+    ASSERT_TRUE(purc_variant_array_append(first, v));
+    purc_variant_unref(v);
+
+    purc_variant_t second = purc_ejson_parsing_tree_evalute(ptree, NULL,
+            PURC_VARIANT_INVALID, false);
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(purc_variant_array_get_size(second), 4);
+    inner = purc_variant_array_get(second, 2);
+    ASSERT_EQ(purc_variant_array_get_size(inner), 2);
+
+    purc_variant_unref(first);
+    purc_variant_unref(second);
+    purc_ejson_parsing_tree_destroy(ptree);
+
+    purc_cleanup();
+}
+
+#define NR_FOLD_THREADS     4
+
+struct fold_arg {
+    struct purc_ejson_parsing_tree *ptree;
+    char runner[16];
+    bool ok;
+};
+
+static bool
+check_folded(struct purc_ejson_parsing_tree *ptree)
+{
+    for (int i = 0; i < 100; i++) {
+        purc_variant_t v = purc_ejson_parsing_tree_evalute(ptree, NULL,
+                PURC_VARIANT_INVALID, false);
+        if (v == PURC_VARIANT_INVALID)
+            return false;
+
+        double d = 0;
+        bool ok = purc_variant_array_get_size(v) == 3 &&
+            strcmp(purc_variant_get_string_const(
+                        purc_variant_array_get(v, 0)), "b") == 0 &&
+            purc_variant_cast_to_number(purc_variant_array_get(v, 1),
+                    &d, false) && d == 2 &&
+            strcmp(purc_variant_get_string_const(
+                        purc_variant_array_get(v, 2)), "x") == 0;
+        purc_variant_unref(v);
+        if (!ok)
+            return false;
+    }
+
+    return true;
+}
+
+static void *
+fold_thread_entry(void *arg)
+{
+    struct fold_arg *my_arg = (struct fold_arg *)arg;
+
+    my_arg->ok = false;
+    if (purc_init_ex(PURC_MODULE_EJSON, "cn.fmsoft.hybridos.test",
+                my_arg->runner, NULL) == PURC_ERROR_OK) {
+        my_arg->ok = check_folded(my_arg->ptree);
+        purc_cleanup();
+    }
+
+    return NULL;
+}
+
+TEST(vcm_eval, constant_folding_shared)
+{
+    purc_init_ex(PURC_MODULE_EJSON, "cn.fmsoft.hybridos.test",
+            "vcm_eval", NULL);
+
+    const char *jsonee = "[ {{ 'a' ; 'b' }}, {{ 1 ; 2 }}, 'x' ]";
+    struct purc_ejson_parsing_tree *ptree;
+    ptree = purc_variant_ejson_parse_string(jsonee, strlen(jsonee));
+    ASSERT_NE(ptree, nullptr);
+
+    /* the instances fold and evaluate the same tree at the same time */
+    pthread_t threads[NR_FOLD_THREADS];
+    struct fold_arg args[NR_FOLD_THREADS];
+    for (int i = 0; i < NR_FOLD_THREADS; i++) {
+        args[i].ptree = ptree;
+        snprintf(args[i].runner, sizeof(args[i].runner), "fold%d", i);
+        ASSERT_EQ(pthread_create(&threads[i], NULL, fold_thread_entry,
+                    &args[i]), 0);
+    }
+    for (int i = 0; i < NR_FOLD_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        ASSERT_TRUE(args[i].ok);
+    }
+
+    /* the folded tree outlives the instances which folded it */
+    ASSERT_TRUE(check_folded(ptree));
+
+    /* the CJSONEEs are literals now */
+    char *s = pcvcm_node_to_string((struct pcvcm_node *)ptree, NULL);
+    ASSERT_NE(s, nullptr);
+    ASSERT_EQ(strstr(s, "{{"), nullptr);
+    free(s);
+
+    purc_ejson_parsing_tree_destroy(ptree);
+    purc_cleanup();
+}